@@ -0,0 +1,124 @@
+#include "AIScheduler.h"
+#include "BlockGrid.h"
+#include "Enemy.h"
+#include "StateSerializer.h"
+#include <algorithm>
+
+AIScheduler::AIScheduler() : AIScheduler(Settings()) {
+}
+
+AIScheduler::AIScheduler(const Settings& settings)
+    : settings(settings), cursor(0), plansGranted(0), plansDeferred(0),
+      measuredMicros(0.0), fieldSource(), fieldGeneration(0), fieldValid(false) {
+    std::fill(tunnelDistance, tunnelDistance + CELLS, UNREACHED);
+}
+
+void AIScheduler::beginTick(const std::vector<Enemy>& enemies, const BlockGrid& terrain,
+                            Coordinate player) {
+    if (!fieldValid || player != fieldSource || terrain.getGeneration() != fieldGeneration) {
+        buildField(terrain, player);
+    }
+
+    int count = static_cast<int>(enemies.size());
+    grants.assign(enemies.size(), 0);
+    plansGranted = 0;
+    plansDeferred = 0;
+    measuredMicros = 0.0;
+    if (count == 0) {
+        cursor = 0;
+        return;
+    }
+
+    int budget = settings.budgetMicros;
+    int firstDeferred = -1;
+    for (int offset = 0; offset < count; ++offset) {
+        int index = (cursor + offset) % count;
+        const Enemy& enemy = enemies[index];
+        if (!enemy.isActive() || enemy.getIsDestroyed() || enemy.getTimeUntilMove() > 0.0f) {
+            continue;
+        }
+
+        const EnemyLogic& logic = enemy.getLogic();
+        int interval = intervalFor(tierFor(pathDistance(enemy.getPosition())));
+        if (logic.hasPlan() && logic.getMovesSincePlan() + 1 < interval) {
+            continue;
+        }
+
+        if (budget < settings.planCostMicros) {
+            plansDeferred++;
+            if (firstDeferred < 0) {
+                firstDeferred = index;
+            }
+            continue;
+        }
+        grants[index] = 1;
+        budget -= settings.planCostMicros;
+        plansGranted++;
+    }
+
+    // Whoever missed out goes first next tick
+    cursor = firstDeferred >= 0 ? firstDeferred : cursor % count;
+}
+
+int AIScheduler::pathDistance(Coordinate cell) const {
+    if (!cell.isWithinBounds()) {
+        return cell.manhattanDistance(fieldSource);
+    }
+    std::int16_t distance = tunnelDistance[cell.toIndex()];
+    return distance != UNREACHED ? distance : cell.manhattanDistance(fieldSource);
+}
+
+AITier AIScheduler::tierFor(int distance) const {
+    if (distance <= settings.nearDistance) return AITier::NEAR;
+    if (distance <= settings.midDistance) return AITier::MID;
+    return AITier::FAR;
+}
+
+int AIScheduler::intervalFor(AITier tier) const {
+    switch (tier) {
+        case AITier::NEAR: return 1;
+        case AITier::MID: return std::max(1, settings.midInterval);
+        case AITier::FAR: return std::max(1, settings.farInterval);
+    }
+    return 1;
+}
+
+void AIScheduler::buildField(const BlockGrid& terrain, Coordinate player) {
+    std::fill(tunnelDistance, tunnelDistance + CELLS, UNREACHED);
+    fieldSource = player;
+    fieldGeneration = terrain.getGeneration();
+    fieldValid = true;
+    if (!player.isWithinBounds()) {
+        return;
+    }
+
+    // The player's own cell seeds the search even while they are digging
+    std::int16_t queue[CELLS];
+    int head = 0;
+    int tail = 0;
+    tunnelDistance[player.toIndex()] = 0;
+    queue[tail++] = static_cast<std::int16_t>(player.toIndex());
+
+    while (head < tail) {
+        int index = queue[head++];
+        Coordinate cell(index / Coordinate::WORLD_COLS, index % Coordinate::WORLD_COLS);
+        for (Direction dir : DirectionTable::CARDINALS) {
+            Coordinate next = cell + directionOffset(dir);
+            if (!next.isWithinBounds() || terrain.isLocationBlocked(next)) continue;
+            int nextIndex = next.toIndex();
+            if (tunnelDistance[nextIndex] != UNREACHED) continue;
+            tunnelDistance[nextIndex] = static_cast<std::int16_t>(tunnelDistance[index] + 1);
+            queue[tail++] = static_cast<std::int16_t>(nextIndex);
+        }
+    }
+}
+
+void AIScheduler::serialize(StateWriter& writer) const {
+    writer.write(cursor);
+}
+
+void AIScheduler::deserialize(StateReader& reader) {
+    reader.read(cursor);
+    cursor = std::max(0, cursor);
+    fieldValid = false;
+}
@@ -0,0 +1,132 @@
+#ifndef AISCHEDULER_H
+#define AISCHEDULER_H
+
+#include "Coordinate.h"
+#include <cstdint>
+#include <vector>
+
+class BlockGrid;
+class Enemy;
+class StateWriter;
+class StateReader;
+
+/**
+ * @file AIScheduler.h
+ * @brief Level-of-detail tiers and a per-tick budget for enemy planning
+ */
+
+/**
+ * @enum AITier
+ * @brief How often an enemy runs its full decision
+ */
+enum class AITier {
+    NEAR = 0,   ///< Plans every move
+    MID = 1,    ///< Plans every midInterval moves
+    FAR = 2     ///< Plans every farInterval moves
+};
+
+/**
+ * @class AIScheduler
+ * @brief Decides each tick which enemies run EnemyLogic and which coast
+ *
+ * Tiers come from path distance to the player: a BFS through tunnels
+ * from the player's cell (rebuilt only when the player moves or the
+ * terrain changes), or the straight-line Manhattan distance for enemies
+ * off the player's tunnels, which phase through earth.
+ *
+ * Per tick:
+ * - An enemy that can move this tick is due to plan when it has no
+ *   previous direction or has reused it for its tier's interval
+ * - Due enemies are granted plans round-robin from a cursor until the
+ *   budget runs out; the rest reuse their last direction and the cursor
+ *   starts at the first of them next tick, so nobody starves
+ * - With thousands of enemies the per-tick planning cost stays at the
+ *   budget and far enemies simply keep going straight for longer
+ *
+ * Budget:
+ * - Expressed in microseconds, but each plan is charged a fixed cost
+ *   (Settings::planCostMicros) rather than its measured time, so which
+ *   enemies plan depends only on game state - replays, rollback and
+ *   batched training stay deterministic on any machine
+ * - The measured planning time is still reported (getMeasuredMicros())
+ *   for tuning planCostMicros
+ *
+ * The round-robin cursor is part of the saved game state.
+ */
+class AIScheduler {
+public:
+    struct Settings {
+        int nearDistance = 6;       ///< Path distance up to this is NEAR
+        int midDistance = 14;       ///< Up to this is MID, beyond is FAR
+        int midInterval = 2;        ///< Moves per plan for MID
+        int farInterval = 4;        ///< Moves per plan for FAR
+        int budgetMicros = 200;     ///< Planning budget per tick
+        int planCostMicros = 10;    ///< Charged per plan (worst-case tunnel BFS)
+    };
+
+    AIScheduler();
+    explicit AIScheduler(const Settings& settings);
+
+    /**
+     * @brief Pick the enemies that plan this tick
+     * @param enemies All enemies (index = enemy id)
+     * @param terrain Current terrain
+     * @param player Player cell
+     */
+    void beginTick(const std::vector<Enemy>& enemies, const BlockGrid& terrain,
+                   Coordinate player);
+
+    /**
+     * @brief Check whether an enemy may run its full decision this tick
+     */
+    bool shouldReplan(int enemy) const {
+        return enemy >= 0 && enemy < static_cast<int>(grants.size()) && grants[enemy] != 0;
+    }
+
+    /**
+     * @brief Add measured planning time (for reporting only)
+     */
+    void recordPlanTime(double micros) { measuredMicros += micros; }
+
+    /**
+     * @brief Path distance from a cell to the player (after beginTick)
+     */
+    int pathDistance(Coordinate cell) const;
+
+    AITier tierFor(int distance) const;
+
+    /**
+     * @brief Moves per plan for a tier
+     */
+    int intervalFor(AITier tier) const;
+
+    int getPlansGranted() const { return plansGranted; }
+    int getPlansDeferred() const { return plansDeferred; }
+    int getCursor() const { return cursor; }
+    double getMeasuredMicros() const { return measuredMicros; }
+    const Settings& getSettings() const { return settings; }
+
+    void serialize(StateWriter& writer) const;
+    void deserialize(StateReader& reader);
+
+private:
+    static const int CELLS = Coordinate::WORLD_ROWS * Coordinate::WORLD_COLS;
+    static constexpr std::int16_t UNREACHED = -1;
+
+    Settings settings;
+    std::vector<std::uint8_t> grants;   ///< Per enemy: 1 = plan this tick
+    int cursor;                         ///< First enemy offered budget next tick
+    int plansGranted;
+    int plansDeferred;
+    double measuredMicros;
+
+    // Tunnel distance from the player, cached on (player cell, terrain generation)
+    std::int16_t tunnelDistance[CELLS];
+    Coordinate fieldSource;
+    unsigned int fieldGeneration;
+    bool fieldValid;
+
+    void buildField(const BlockGrid& terrain, Coordinate player);
+};
+
+#endif // AISCHEDULER_H
@@ -0,0 +1,222 @@
+#include "BatchEnvironment.h"
+#include "GameSimulation.h"
+#include "GameClock.h"
+#include "GameRandom.h"
+#include "GameLog.h"
+#include "GameConstants.h"
+#include <algorithm>
+
+using namespace GameConstants;
+using namespace ObservationLayout;
+
+BatchEnvironment::BatchEnvironment(const Settings& settings)
+    : generateLevels(settings.generateLevels), 
+      worlds(std::max(1, settings.worlds)),
+      observationBuffer(worlds.size() * WORLD_SIZE, 0.0f),
+      rewardBuffer(worlds.size(), 0.0f),
+      doneBuffer(worlds.size(), 1),
+      job(Job::STEP), jobSeeds(nullptr), jobActions(nullptr), jobBegin(0), jobEnd(0),
+      nextWorld(0), worldsLeft(0), stopping(false) {
+    int threads = settings.workers > 0 ? settings.workers
+                                       : static_cast<int>(std::thread::hardware_concurrency());
+    threads = std::max(1, std::min(threads, size()));
+    for (int i = 0; i < threads; ++i) {
+        workers.emplace_back(&BatchEnvironment::workerLoop, this);
+    }
+}
+
+BatchEnvironment::~BatchEnvironment() {
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        stopping = true;
+    }
+    jobReady.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void BatchEnvironment::reset(std::span<const std::uint64_t> seeds) {
+    if (static_cast<int>(seeds.size()) < size()) return;
+    jobSeeds = seeds.data();
+    runJob(Job::RESET, 0, size());
+}
+
+void BatchEnvironment::resetWorld(int world, std::uint64_t seed) {
+    if (world < 0 || world >= size()) return;
+    // Through the pool too, so the caller's clock and random state stay untouched
+    jobSeeds = &seed;
+    runJob(Job::RESET, world, world + 1);
+}
+
+void BatchEnvironment::step(std::span<const int> actions) {
+    if (static_cast<int>(actions.size()) < size()) return;
+    jobActions = actions.data();
+    runJob(Job::STEP, 0, size());
+}
+
+const GameSimulation& BatchEnvironment::simulation(int world) const {
+    return *worlds[world].simulation;
+}
+
+InputFrame BatchEnvironment::actionInput(int action) {
+    InputFrame input;
+    switch (action) {
+        case UP:    input.held = InputFrame::bit(InputButton::UP); break;
+        case DOWN:  input.held = InputFrame::bit(InputButton::DOWN); break;
+        case LEFT:  input.held = InputFrame::bit(InputButton::LEFT); break;
+        case RIGHT: input.held = InputFrame::bit(InputButton::RIGHT); break;
+        case FIRE:  input.pressed = InputFrame::bit(InputButton::FIRE); break;
+        default:    break;
+    }
+    return input;
+}
+
+void BatchEnvironment::runJob(Job type, int begin, int end) {
+    std::unique_lock<std::mutex> lock(poolMutex);
+    job = type;
+    jobBegin = begin;
+    jobEnd = end;
+    nextWorld = begin;
+    worldsLeft = end - begin;
+    jobReady.notify_all();
+    jobDone.wait(lock, [this] { return worldsLeft == 0; });
+}
+
+void BatchEnvironment::workerLoop() {
+    GameLog::setQuiet(true);
+    
+    while (true) {
+        int index;
+        Job type;
+        std::uint64_t seed = 0;
+        int action = NOOP;
+        {
+            // One world per claim: stepping a world costs far more than the lock
+            std::unique_lock<std::mutex> lock(poolMutex);
+            jobReady.wait(lock, [this] { return stopping || nextWorld < jobEnd; });
+            if (stopping) return;
+            index = nextWorld++;
+            type = job;
+            if (type == Job::RESET) {
+                seed = jobSeeds[index - jobBegin];
+            } else {
+                action = jobActions[index];
+            }
+        }
+        
+        if (type == Job::RESET) {
+            resetOne(index, seed);
+        } else {
+            stepOne(index, action);
+        }
+        
+        std::lock_guard<std::mutex> lock(poolMutex);
+        if (--worldsLeft == 0) {
+            jobDone.notify_all();
+        }
+    }
+}
+
+void BatchEnvironment::resetOne(int index, std::uint64_t seed) {
+    World& world = worlds[index];
+    GameRandom::seed(seed);
+    GameClock::setFixedStep(SIMULATION_TICK, 0.0);
+    
+    world.simulation = std::make_unique<GameSimulation>(generateLevels);
+    InputFrame start;
+    start.pressed = InputFrame::bit(InputButton::CONFIRM);
+    world.simulation->step(start);
+    world.simulation->getEvents().clear();
+    world.snapshot.terrainValid = false;
+    
+    leaveWorld(world);
+    world.lastScore = world.simulation->getScore();
+    rewardBuffer[index] = 0.0f;
+    doneBuffer[index] = world.simulation->getState() == GameState::PLAYING ? 0 : 1;
+    writeObservation(index);
+}
+
+void BatchEnvironment::stepOne(int index, int action) {
+    World& world = worlds[index];
+    rewardBuffer[index] = 0.0f;
+    if (doneBuffer[index] || !world.simulation) return;
+    
+    enterWorld(world);
+    world.simulation->step(actionInput(action));
+    world.simulation->getEvents().clear();
+    leaveWorld(world);
+    
+    int score = world.simulation->getScore();
+    rewardBuffer[index] = static_cast<float>(score - world.lastScore);
+    world.lastScore = score;
+    doneBuffer[index] = world.simulation->getState() == GameState::PLAYING ? 0 : 1;
+    writeObservation(index);
+}
+
+void BatchEnvironment::enterWorld(const World& world) const {
+    GameRandom::setState(world.randomState);
+    GameClock::setFixedStep(SIMULATION_TICK, world.clockTime);
+}
+
+void BatchEnvironment::leaveWorld(World& world) const {
+    world.randomState = GameRandom::getState();
+    world.clockTime = GameClock::now();
+}
+
+void BatchEnvironment::writeObservation(int index) {
+    World& world = worlds[index];
+    enterWorld(world);
+    world.simulation->captureSnapshot(world.snapshot);
+    const RenderSnapshot& snap = world.snapshot;
+    
+    float* out = observationBuffer.data() + static_cast<std::size_t>(index) * WORLD_SIZE;
+    std::fill(out, out + SCALAR_OFFSET, 0.0f);
+    auto mark = [out](Plane plane, Coordinate cell) {
+        if (cell.isWithinBounds()) {
+            out[plane * PLANE_SIZE + cell.toIndex()] = 1.0f;
+        }
+    };
+    
+    for (int row = 0; row < Coordinate::WORLD_ROWS; ++row) {
+        for (int col = 0; col < Coordinate::WORLD_COLS; ++col) {
+            if (snap.blocked[row][col]) {
+                out[EARTH * PLANE_SIZE + row * Coordinate::WORLD_COLS + col] = 1.0f;
+            }
+        }
+    }
+    
+    mark(PLAYER, snap.player.position);
+    for (int i = 0; i < snap.enemyCount; ++i) {
+        const RenderSnapshot::EnemyView& enemy = snap.enemies[i];
+        if (!enemy.active || enemy.destroyed) continue;
+        mark(enemy.type == EnemyType::GREEN_DRAGON ? DRAGON : MONSTER, enemy.position);
+    }
+    for (int i = 0; i < snap.rockCount; ++i) {
+        if (snap.rocks[i].active) {
+            mark(ROCK, snap.rocks[i].position);
+        }
+    }
+    for (int i = 0; i < snap.powerUpCount; ++i) {
+        mark(POWERUP, snap.powerUps[i].position);
+    }
+    for (int h = 0; h < snap.harpoonCount; ++h) {
+        for (int i = 0; i < snap.harpoons[h].segmentCount; ++i) {
+            mark(HARPOON, snap.harpoons[h].segments[i]);
+        }
+    }
+    for (int f = 0; f < snap.fireCount; ++f) {
+        for (int i = 0; i < snap.fires[f].trailLength; ++i) {
+            mark(ObservationLayout::FIRE, snap.fires[f].trail[i]);
+        }
+    }
+    
+    float* scalars = out + SCALAR_OFFSET;
+    scalars[LEVEL] = static_cast<float>(snap.hud.level);
+    scalars[SCORE] = static_cast<float>(snap.hud.score);
+    scalars[LIVES] = static_cast<float>(snap.hud.lives);
+    scalars[LEVEL_TIME] = snap.hud.levelTimer;
+    scalars[CAN_FIRE] = snap.hud.canFireHarpoon ? 1.0f : 0.0f;
+    scalars[HARPOON_PROGRESS] = snap.hud.harpoonProgress;
+    scalars[PLAYING] = snap.state == GameState::PLAYING ? 1.0f : 0.0f;
+}
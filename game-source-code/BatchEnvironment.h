@@ -0,0 +1,197 @@
+#ifndef BATCHENVIRONMENT_H
+#define BATCHENVIRONMENT_H
+
+#include "Coordinate.h"
+#include "InputManager.h"
+#include "RenderSnapshot.h"
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+class GameSimulation;
+
+/**
+ * @file BatchEnvironment.h
+ * @brief Steps many headless games at once for bot training
+ */
+
+/**
+ * @namespace ObservationLayout
+ * @brief Shape of one world's observation in the batch buffer
+ *
+ * One world = PLANES bitplanes of WORLD_ROWS x WORLD_COLS floats
+ * (row-major, plane after plane) followed by SCALARS floats.
+ * A plane cell is 1.0 where the thing is present, else 0.0.
+ */
+namespace ObservationLayout {
+    enum Plane {
+        EARTH,      ///< Solid earth
+        PLAYER,     ///< Player cell
+        MONSTER,    ///< Live non-dragon enemy
+        DRAGON,     ///< Live fire-breathing enemy
+        ROCK,       ///< Rock (resting or falling)
+        POWERUP,    ///< Power-up pickup
+        HARPOON,    ///< Harpoon segment
+        FIRE,       ///< Fireball or its trail
+        PLANES
+    };
+
+    enum Scalar {
+        LEVEL,            ///< Current level number
+        SCORE,            ///< Score
+        LIVES,            ///< Lives left
+        LEVEL_TIME,       ///< Seconds into the level
+        CAN_FIRE,         ///< 1 if the harpoon is ready
+        HARPOON_PROGRESS, ///< Harpoon cooldown progress (0-1)
+        PLAYING,          ///< 1 while in PLAYING state
+        SCALARS
+    };
+
+    const int PLANE_SIZE = Coordinate::WORLD_ROWS * Coordinate::WORLD_COLS;
+    const int SCALAR_OFFSET = PLANES * PLANE_SIZE;
+    const int WORLD_SIZE = SCALAR_OFFSET + SCALARS; ///< Floats per world
+}
+
+/**
+ * @class BatchEnvironment
+ * @brief Vectorised reset/step API over N independent GameSimulations
+ *
+ * Usage:
+ * @code
+ * BatchEnvironment env(settings);
+ * env.reset(seeds);                 // one seed per world
+ * while (training) {
+ *     env.step(actions);            // one BatchEnvironment::Action per world
+ *     read env.observations(), env.rewards(), env.dones();
+ * }
+ * @endcode
+ *
+ * Each world plays one level: it is done when the level is cleared, the
+ * game is over, or won. Reward is the score gained this step. A done
+ * world ignores further actions until it is reset (resetWorld()).
+ *
+ * Threading:
+ * - Worlds are stepped on a fixed pool of worker threads; the calling
+ *   thread only waits, as with LevelEvaluator
+ * - GameClock and GameRandom are thread_local, so each world keeps its
+ *   own clock and random state and loads them onto whichever worker
+ *   steps it - results depend only on seeds and actions, not on
+ *   scheduling or worker count
+ *
+ * Memory:
+ * - Observations, rewards and dones are preallocated contiguous arrays
+ * - step() itself allocates nothing once warmed up: no per-step buffers,
+ *   threads or tasks (the pool and per-world snapshots live for the whole
+ *   batch), and enemy planning reuses each simulation's path buffers
+ * - reset() builds new simulations and levels, so it does allocate
+ */
+class BatchEnvironment {
+public:
+    enum Action {
+        NOOP,
+        UP,
+        DOWN,
+        LEFT,
+        RIGHT,
+        FIRE,
+        ACTION_COUNT
+    };
+
+    struct Settings {
+        int worlds = 8;              ///< Games in the batch
+        int workers = 0;             ///< Threads (0 = hardware concurrency)
+        bool generateLevels = false; ///< Procedural levels past the map files (slow reset)
+    };
+
+    explicit BatchEnvironment(const Settings& settings);
+    ~BatchEnvironment();
+
+    BatchEnvironment(const BatchEnvironment&) = delete;
+    BatchEnvironment& operator=(const BatchEnvironment&) = delete;
+
+    /**
+     * @brief Start a fresh game in every world
+     * @param seeds One seed per world (same seed = same game)
+     */
+    void reset(std::span<const std::uint64_t> seeds);
+
+    /**
+     * @brief Start a fresh game in one world (e.g. after it is done)
+     */
+    void resetWorld(int world, std::uint64_t seed);
+
+    /**
+     * @brief Advance every live world by one simulation tick
+     * @param actions One Action per world
+     */
+    void step(std::span<const int> actions);
+
+    int size() const { return static_cast<int>(worlds.size()); }
+    int workerCount() const { return static_cast<int>(workers.size()); }
+
+    /**
+     * @brief All observations, world after world (size() * WORLD_SIZE floats)
+     */
+    std::span<const float> observations() const { return observationBuffer; }
+
+    std::span<const float> observation(int world) const {
+        return std::span<const float>(observationBuffer).subspan(
+            static_cast<std::size_t>(world) * ObservationLayout::WORLD_SIZE,
+            ObservationLayout::WORLD_SIZE);
+    }
+
+    std::span<const float> rewards() const { return rewardBuffer; }
+    std::span<const std::uint8_t> dones() const { return doneBuffer; }
+
+    const GameSimulation& simulation(int world) const;
+
+    /**
+     * @brief Input frame an action stands for
+     */
+    static InputFrame actionInput(int action);
+
+private:
+    struct World {
+        std::unique_ptr<GameSimulation> simulation;
+        std::uint64_t randomState = 0;
+        double clockTime = 0.0;
+        int lastScore = 0;
+        RenderSnapshot snapshot;
+    };
+
+    enum class Job { RESET, STEP };
+
+    bool generateLevels;
+    std::vector<World> worlds;
+    std::vector<float> observationBuffer;
+    std::vector<float> rewardBuffer;
+    std::vector<std::uint8_t> doneBuffer;
+
+    // Current job; all fields are guarded by poolMutex
+    Job job;
+    const std::uint64_t* jobSeeds;
+    const int* jobActions;
+    int jobBegin;
+    int jobEnd;
+    int nextWorld;       ///< Next unclaimed world of the job
+    int worldsLeft;      ///< Claimed or not, still unfinished
+    bool stopping;
+    std::mutex poolMutex;
+    std::condition_variable jobReady;
+    std::condition_variable jobDone;
+    std::vector<std::thread> workers;
+
+    void runJob(Job type, int begin, int end);
+    void workerLoop();
+    void resetOne(int index, std::uint64_t seed);
+    void stepOne(int index, int action);
+    void writeObservation(int index);
+    void enterWorld(const World& world) const;
+    void leaveWorld(World& world) const;
+};
+
+#endif // BATCHENVIRONMENT_H
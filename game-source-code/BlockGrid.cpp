@@ -1,8 +1,11 @@
 #include "BlockGrid.h"
+#include "StateSerializer.h"
+#include "GameLog.h"
+#include "LevelLayout.h"
 #include <fstream>
-#include <iostream>
+#include <utility>
 
-BlockGrid::BlockGrid() {
+BlockGrid::BlockGrid() : generation(0), reloadGeneration(0) {
     initializeDefaultMap();
 }
 
@@ -14,21 +17,114 @@ bool BlockGrid::isLocationBlocked(Coordinate spot) const {
 }
 
 void BlockGrid::clearPassageAt(Coordinate spot) {
-    if (spot.isInPlayableArea()) {
+    if (spot.isInPlayableArea() && isBlocked[spot.row][spot.col]) {
         isBlocked[spot.row][spot.col] = false;
+        addTunnelCell(spot);
+        generation++;
+        changeLog.push(CellChange{generation, spot});
+    }
+}
+
+bool BlockGrid::getChangesSince(unsigned int since, std::vector<Coordinate>& cells) const {
+    cells.clear();
+    if (since > generation || since < reloadGeneration) {
+        return false;
+    }
+    // Logged generations are consecutive; a gap before the oldest means overflow
+    unsigned int oldest = changeLog.empty() ? generation + 1 : changeLog[0].generation;
+    if (oldest > since + 1) {
+        return false;
+    }
+    for (std::size_t i = 0; i < changeLog.size(); ++i) {
+        if (changeLog[i].generation > since) {
+            cells.push_back(changeLog[i].cell);
+        }
+    }
+    return true;
+}
+
+void BlockGrid::markWholeMapChanged() {
+    changeLog.clear();
+    reloadGeneration = generation;
+}
+
+bool BlockGrid::areConnected(Coordinate a, Coordinate b) const {
+    int first = getTunnelId(a);
+    return first >= 0 && first == getTunnelId(b);
+}
+
+int BlockGrid::getTunnelId(Coordinate spot) const {
+    if (!spot.isInPlayableArea() || isBlocked[spot.row][spot.col]) {
+        return -1;
+    }
+    return findTunnelRoot(spot.row * MAP_COLS + spot.col);
+}
+
+int BlockGrid::getTunnelSize(Coordinate spot) const {
+    int root = getTunnelId(spot);
+    return root >= 0 ? tunnelSize[root] : 0;
+}
+
+int BlockGrid::findTunnelRoot(int index) const {
+    while (tunnelParent[index] != index) {
+        tunnelParent[index] = tunnelParent[tunnelParent[index]];
+        index = tunnelParent[index];
+    }
+    return index;
+}
+
+void BlockGrid::joinTunnels(int first, int second) {
+    int rootA = findTunnelRoot(first);
+    int rootB = findTunnelRoot(second);
+    if (rootA == rootB) {
+        return;
+    }
+    if (tunnelSize[rootA] < tunnelSize[rootB]) {
+        std::swap(rootA, rootB);
+    }
+    tunnelParent[rootB] = static_cast<short>(rootA);
+    tunnelSize[rootA] = static_cast<short>(tunnelSize[rootA] + tunnelSize[rootB]);
+}
+
+void BlockGrid::addTunnelCell(Coordinate spot) {
+    int index = spot.row * MAP_COLS + spot.col;
+    tunnelParent[index] = static_cast<short>(index);
+    tunnelSize[index] = 1;
+    
+    const Coordinate neighbours[] = {Coordinate(-1, 0), Coordinate(1, 0),
+                                     Coordinate(0, -1), Coordinate(0, 1)};
+    for (const auto& offset : neighbours) {
+        Coordinate next = spot + offset;
+        if (next.isInPlayableArea() && !isBlocked[next.row][next.col]) {
+            joinTunnels(index, next.row * MAP_COLS + next.col);
+        }
+    }
+}
+
+void BlockGrid::rebuildConnectivity() {
+    for (int i = 0; i < MAP_ROWS * MAP_COLS; ++i) {
+        tunnelParent[i] = -1;
+        tunnelSize[i] = 0;
+    }
+    for (int row = Coordinate::PLAYABLE_START_ROW; row < MAP_ROWS; ++row) {
+        for (int col = 0; col < MAP_COLS; ++col) {
+            if (!isBlocked[row][col]) {
+                addTunnelCell(Coordinate(row, col));
+            }
+        }
     }
 }
 
 void BlockGrid::importMapFromFile(const std::string& filepath) {
     std::ifstream file(filepath);
     if (!file.is_open()) {
-        std::cout << "Map file not found: " << filepath << std::endl;
-        std::cout << "Using procedural default map instead" << std::endl;
+        GameLog::info() << "Map file not found: " << filepath << std::endl;
+        GameLog::info() << "Using procedural default map instead" << std::endl;
         initializeDefaultMap();
         return;
     }
     
-    std::cout << "Loading map from: " << filepath << std::endl;
+    GameLog::info() << "Loading map from: " << filepath << std::endl;
     
     playerSpawns.clear();
     enemySpawns.clear();
@@ -74,16 +170,76 @@ void BlockGrid::importMapFromFile(const std::string& filepath) {
     }
     
     file.close();
+    rebuildConnectivity();
+    generation++;
+    markWholeMapChanged();
     
     if (playerSpawns.empty() && enemySpawns.empty() && rockSpawns.empty()) {
-        std::cout << "Map file contained no spawn data, using defaults" << std::endl;
+        GameLog::info() << "Map file contained no spawn data, using defaults" << std::endl;
         initializeDefaultMap();
     } else {
-        std::cout << "Map loaded successfully" << std::endl;
+        GameLog::info() << "Map loaded successfully" << std::endl;
     }
 }
 
+bool BlockGrid::validateMapFile(const std::string& filepath, std::string& error) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        error = "cannot open " + filepath;
+        return false;
+    }
+    
+    std::string line;
+    int lineNumber = 0;
+    int row = 0;
+    int playerSpawnCount = 0;
+    
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        
+        std::string where = "line " + std::to_string(lineNumber) + ": ";
+        if (row >= MAP_ROWS) {
+            error = where + "more than " + std::to_string(MAP_ROWS) + " rows";
+            return false;
+        }
+        if (static_cast<int>(line.length()) < MAP_COLS) {
+            error = where + "row has " + std::to_string(line.length()) + 
+                    " cells, needs " + std::to_string(MAP_COLS);
+            return false;
+        }
+        for (int col = 0; col < MAP_COLS; ++col) {
+            char cell = line[col];
+            if (std::string("01PER").find(cell) == std::string::npos) {
+                error = where + "unknown cell '" + std::string(1, cell) + 
+                        "' at column " + std::to_string(col);
+                return false;
+            }
+            if (cell == 'P') playerSpawnCount++;
+        }
+        row++;
+    }
+    
+    if (row == 0) {
+        error = "no map rows";
+        return false;
+    }
+    if (playerSpawnCount == 0) {
+        error = "no player spawn (P)";
+        return false;
+    }
+    return true;
+}
+
 void BlockGrid::initializeDefaultMap() {
+    generation++;
+    markWholeMapChanged();
+    
     for (int row = 0; row < MAP_ROWS; ++row) {
         for (int col = 0; col < MAP_COLS; ++col) {
             if (row < Coordinate::PLAYABLE_START_ROW) {
@@ -129,6 +285,24 @@ void BlockGrid::initializeDefaultMap() {
     for (int col = 0; col < Coordinate::WORLD_COLS; ++col) {
         isBlocked[Coordinate::WORLD_ROWS-1][col] = false;
     }
+    
+    rebuildConnectivity();
+}
+
+void BlockGrid::applyLayout(const LevelLayout& layout) {
+    for (int row = 0; row < MAP_ROWS; ++row) {
+        for (int col = 0; col < MAP_COLS; ++col) {
+            isBlocked[row][col] = row >= Coordinate::PLAYABLE_START_ROW && 
+                                  layout.blocked[row][col];
+        }
+    }
+    
+    playerSpawns = layout.playerSpawns;
+    enemySpawns = layout.enemySpawns;
+    rockSpawns = layout.rockSpawns;
+    rebuildConnectivity();
+    generation++;
+    markWholeMapChanged();
 }
 
 bool BlockGrid::isAreaBlocked(Coordinate topLeft, Coordinate bottomRight) const {
@@ -178,3 +352,38 @@ std::vector<Coordinate> BlockGrid::getEnemySpawns() const {
 std::vector<Coordinate> BlockGrid::getRockSpawns() const {
     return rockSpawns;
 }
+
+void BlockGrid::serialize(StateWriter& writer) const {
+    unsigned char packed[(MAP_ROWS * MAP_COLS + 7) / 8] = {};
+    for (int i = 0; i < MAP_ROWS * MAP_COLS; ++i) {
+        if (isBlocked[i / MAP_COLS][i % MAP_COLS]) {
+            packed[i / 8] |= static_cast<unsigned char>(1u << (i % 8));
+        }
+    }
+    writer.writeBytes(packed, sizeof(packed));
+    
+    const std::vector<Coordinate>* spawnLists[] = {&playerSpawns, &enemySpawns, &rockSpawns};
+    for (const auto* spawns : spawnLists) {
+        writer.write(static_cast<std::uint32_t>(spawns->size()));
+        writer.writeBytes(spawns->data(), spawns->size() * sizeof(Coordinate));
+    }
+}
+
+void BlockGrid::deserialize(StateReader& reader) {
+    unsigned char packed[(MAP_ROWS * MAP_COLS + 7) / 8];
+    reader.readBytes(packed, sizeof(packed));
+    for (int i = 0; i < MAP_ROWS * MAP_COLS; ++i) {
+        isBlocked[i / MAP_COLS][i % MAP_COLS] = (packed[i / 8] >> (i % 8)) & 1u;
+    }
+    
+    std::vector<Coordinate>* spawnLists[] = {&playerSpawns, &enemySpawns, &rockSpawns};
+    for (auto* spawns : spawnLists) {
+        spawns->resize(reader.readCount(MAP_ROWS * MAP_COLS));
+        reader.readPositions(spawns->data(), spawns->size());
+    }
+    
+    // Restoring is a terrain change; keep the counter monotonic
+    rebuildConnectivity();
+    generation++;
+    markWholeMapChanged();
+}
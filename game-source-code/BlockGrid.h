@@ -2,9 +2,14 @@
 #define BLOCKGRID_H
 
 #include "Coordinate.h"
+#include "FixedRing.h"
 #include <string>
 #include <vector>
 
+class StateWriter;
+class StateReader;
+struct LevelLayout;
+
 /**
  * @file BlockGrid.h
  * @brief Manages terrain state and tunnel system
@@ -22,6 +27,18 @@
  * - Rows 0-2: HUD area (always clear)
  * - Rows 3-19: Playable area (earth and tunnels)
  * 
+ * Tunnel connectivity:
+ * - Clear playable cells are grouped into tunnels with a union-find
+ * - clearPassageAt() merges the new cell with its open neighbours
+ *   (near O(1)); whole-map loads rebuild the index once
+ * - areConnected() answers "can I walk there without digging"
+ * 
+ * Change log:
+ * - Every single-cell change is logged with its generation in a small
+ *   ring, so caches built at generation G can ask getChangesSince(G)
+ *   and repair only what was dug instead of rebuilding
+ * - Whole-map changes (loads, layouts, restores) clear the log
+ * 
  * @note This is the single source of truth for terrain state
  */
 class BlockGrid {
@@ -33,6 +50,20 @@ private:
     std::vector<Coordinate> playerSpawns;  ///< Player spawn positions from map
     std::vector<Coordinate> enemySpawns;   ///< Enemy spawn positions from map
     std::vector<Coordinate> rockSpawns;    ///< Rock spawn positions from map
+    unsigned int generation;               ///< Bumped on every terrain change
+    
+    /// Union-find parent per cell index (row * MAP_COLS + col); -1 = earth.
+    /// Mutable so const queries can compress paths.
+    mutable short tunnelParent[MAP_ROWS * MAP_COLS];
+    short tunnelSize[MAP_ROWS * MAP_COLS];  ///< Cells in tunnel (valid at roots)
+
+    struct CellChange {
+        unsigned int generation = 0;  ///< Generation right after the change
+        Coordinate cell;
+    };
+    static const int CHANGE_LOG_SIZE = 64;
+    FixedRing<CellChange, CHANGE_LOG_SIZE> changeLog; ///< Recent single-cell changes
+    unsigned int reloadGeneration;         ///< Generation of the last whole-map change
 
 public:
     /**
@@ -96,11 +127,30 @@ public:
      */
     void importMapFromFile(const std::string& filepath);
     
+    /**
+     * @brief Check a map file before it replaces a live level
+     * @param filepath Path to .txt map file
+     * @param error Receives the first problem (with line number)
+     * @return true if importMapFromFile() would load it as written
+     * 
+     * Rejects unknown cell characters (the importer would silently
+     * turn them into earth), short or extra rows, and maps without a
+     * player spawn. Columns past 30 are ignored like the importer does.
+     */
+    static bool validateMapFile(const std::string& filepath, std::string& error);
+    
     /**
      * @brief Initialize with procedural default terrain
      * @note Creates basic tunnel network with vertical and horizontal passages
      */
     void initializeDefaultMap();
+    
+    /**
+     * @brief Replace terrain and spawn points with a generated layout
+     * @param layout Layout from LevelGenerator
+     * @note HUD rows are always cleared regardless of layout contents
+     */
+    void applyLayout(const LevelLayout& layout);
 
     /**
      * @brief Get player spawn positions from loaded map
@@ -131,6 +181,64 @@ public:
      * @return int Total columns (30)
      */
     int getCols() const { return MAP_COLS; }
+    
+    /**
+     * @brief Get terrain change counter
+     * @return unsigned int Increases whenever any cell changes
+     * @note Equal generations guarantee identical terrain
+     */
+    unsigned int getGeneration() const { return generation; }
+    
+    /**
+     * @brief Collect cells changed after a generation
+     * @param since Generation a cache was built at
+     * @param cells Receives the changed cells, oldest first (cleared first)
+     * @return false if not known - the whole map changed or the log no
+     *         longer reaches back that far - and the cache must rebuild
+     */
+    bool getChangesSince(unsigned int since, std::vector<Coordinate>& cells) const;
+    
+    /**
+     * @brief Check whether two cells lie in the same open tunnel
+     * @param a First cell
+     * @param b Second cell
+     * @return true if both are clear and joined through clear cells
+     * @note Near O(1) (union-find with path compression)
+     */
+    bool areConnected(Coordinate a, Coordinate b) const;
+    
+    /**
+     * @brief Get identifier of the tunnel containing a cell
+     * @param spot Cell to query
+     * @return int Tunnel id (stable until tunnels merge), -1 for earth
+     */
+    int getTunnelId(Coordinate spot) const;
+    
+    /**
+     * @brief Get number of clear cells in a cell's tunnel
+     * @param spot Cell to query
+     * @return int Tunnel size, 0 for earth
+     */
+    int getTunnelSize(Coordinate spot) const;
+    
+    /**
+     * @brief Write terrain cells (bit-packed) and spawn lists to a state snapshot
+     * @param writer Destination
+     */
+    void serialize(StateWriter& writer) const;
+    
+    /**
+     * @brief Restore state written by serialize()
+     * @param reader Source
+     */
+    void deserialize(StateReader& reader);
+
+private:
+    int findTunnelRoot(int index) const;
+    void joinTunnels(int first, int second);
+    void addTunnelCell(Coordinate spot);
+    void rebuildConnectivity();
+    void markWholeMapChanged();
 };
 
 #endif // BLOCKGRID_H
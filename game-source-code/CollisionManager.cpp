@@ -1,5 +1,6 @@
 #include "CollisionManager.h"
 #include "GameConstants.h"
+#include "EnemyArchetypes.h"
 #include <iostream>
 
 using namespace GameConstants;
@@ -16,6 +17,7 @@ bool CollisionManager::checkPlayerEnemyCollision(const Player& player,
             Coordinate enemyPos = enemy.getPosition();
             Coordinate enemyBounds = enemy.getCollisionBounds();
             
+            testsPerformed++;
             if (checkAABBCollision(playerPos, playerBounds, enemyPos, enemyBounds)) {
                 return true;
             }
@@ -24,27 +26,27 @@ bool CollisionManager::checkPlayerEnemyCollision(const Player& player,
     return false;
 }
 
-void CollisionManager::checkHarpoonEnemyCollisions(std::vector<Harpoon>& harpoons, 
+void CollisionManager::checkHarpoonEnemyCollisions(std::span<Harpoon> harpoons, 
                                                   std::vector<Enemy>& enemies, 
                                                   int& score, int& enemiesDefeated, 
                                                   int level) {
+    enemyOccupancy.build(enemies);
+    
     for (auto& harpoon : harpoons) {
         if (!harpoon.isActive()) continue;
         
-        const auto& segments = harpoon.getSegments();
-        
-        for (auto& enemy : enemies) {
-            if (!enemy.isActive() || enemy.getIsDestroyed()) continue;
-            
-            Coordinate enemyPos = enemy.getPosition();
-            
-            for (const auto& segment : segments) {
-                if (isPositionMatch(segment, enemyPos)) {
-                    enemy.destroy();
-                    score += getScoreForEnemy(enemy.getEnemyType(), level);
-                    enemiesDefeated++;
-                    break;
-                }
+        // Cast the harpoon's cells against the occupancy grid
+        for (int i = 0; i < harpoon.getSegmentCount(); ++i) {
+            Coordinate cell = harpoon.getSegment(i);
+            testsPerformed++;
+            for (int e = enemyOccupancy.firstAt(cell); e != EnemyOccupancy::NO_ENEMY; 
+                 e = enemyOccupancy.nextAt(e)) {
+                Enemy& enemy = enemies[e];
+                if (enemy.getIsDestroyed()) continue;
+                
+                enemy.destroy();
+                score += getScoreForEnemy(enemy.getEnemyType(), level);
+                enemiesDefeated++;
             }
         }
     }
@@ -59,6 +61,7 @@ void CollisionManager::checkRockCollisions(std::vector<Rock>& rocks,
     for (auto& rock : rocks) {
         if (!rock.isActive()) continue;
         
+        testsPerformed += enemies.size() + 1;
         rock.handleCrushingLogic(player, enemies);
         
         if (rock.checkPlayerCrush(player)) {
@@ -80,6 +83,7 @@ PowerUp* CollisionManager::checkPowerUpCollision(const Player& player,
             Coordinate powerUpPos = powerUp.getPosition();
             Coordinate powerUpBounds = powerUp.getCollisionBounds();
             
+            testsPerformed++;
             if (checkAABBCollision(playerPos, playerBounds, 
                                   powerUpPos, powerUpBounds)) {
                 return &powerUp;
@@ -90,8 +94,7 @@ PowerUp* CollisionManager::checkPowerUpCollision(const Player& player,
 }
 
 int CollisionManager::getScoreForEnemy(EnemyType type, int level) {
-    int baseScore = (type == EnemyType::AGGRESSIVE_MONSTER) ? 200 : 100;
-    return baseScore * level;
+    return EnemyArchetypes::get(type).baseScore * level;
 }
 
 bool CollisionManager::checkAABBCollision(Coordinate pos1, Coordinate bounds1,
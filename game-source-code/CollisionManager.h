@@ -6,6 +6,9 @@
 #include "Harpoon.h"
 #include "PowerUp.h"
 #include "Rock.h"
+#include "EnemyOccupancy.h"
+#include <cstdint>
+#include <span>
 #include <vector>
 
 /**
@@ -37,6 +40,11 @@
  * Detection methods:
  * - AABB (Axis-Aligned Bounding Box) for general collisions
  * - Position matching for grid-based collisions
+ * - Harpoons walk their cells against an EnemyOccupancy grid, so the
+ *   cost is O(enemies + harpoon cells) rather than harpoons × enemies
+ * 
+ * getTestsPerformed() counts pair tests and occupancy probes since
+ * construction, for telemetry; it is not part of the game state.
  * 
  * @note Manager has global view of all entities each frame
  */
@@ -55,13 +63,13 @@ public:
     
     /**
      * @brief Check harpoon-enemy collisions
-     * @param harpoons Harpoon vector (const - read only)
+     * @param harpoons Live harpoons (pool or vector)
      * @param enemies Enemy vector (modified if hit)
      * @param score Score counter (incremented on hits)
      * @param enemiesDefeated Total enemies defeated (incremented)
      * @param level Current level (for score multiplier)
      */
-    void checkHarpoonEnemyCollisions(std::vector<Harpoon>& harpoons, 
+    void checkHarpoonEnemyCollisions(std::span<Harpoon> harpoons, 
                                    std::vector<Enemy>& enemies, int& score, 
                                    int& enemiesDefeated, int level);
     
@@ -83,12 +91,20 @@ public:
      */
     PowerUp* checkPowerUpCollision(const Player& player, 
                                   std::vector<PowerUp>& powerUps);
+    
+    /**
+     * @brief Collision tests run so far (pairs checked, cells probed)
+     */
+    std::uint64_t getTestsPerformed() const { return testsPerformed; }
 
 private:
     int getScoreForEnemy(EnemyType type, int level);
     bool checkAABBCollision(Coordinate pos1, Coordinate bounds1,
                            Coordinate pos2, Coordinate bounds2);
     bool isPositionMatch(Coordinate pos1, Coordinate pos2);
+    
+    EnemyOccupancy enemyOccupancy;
+    std::uint64_t testsPerformed = 0;
 };
 
 #endif // COLLISIONMANAGER_H
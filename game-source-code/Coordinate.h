@@ -1,12 +1,16 @@
 #ifndef COORDINATE_H
 #define COORDINATE_H
 
+#include <cmath>
+#include <cstdint>
+
 /**
  * @file Coordinate.h
  * @brief Grid-based position system for game world
  * 
  * Provides discrete coordinate system with row/column positioning,
  * boundary checking, and distance calculations for the 20x30 game grid.
+ * Header-only and constexpr so every call inlines into the hot loops.
  */
 
 /**
@@ -20,12 +24,18 @@
  * World dimensions: 20 rows × 30 columns
  * Cell size: 40×40 pixels
  * 
+ * Representation:
+ * - row and col are 16-bit, so a Coordinate is one 32-bit word
+ *   (half the size in segment, trail and spawn arrays)
+ * - pack()/unpack() convert to and from a single std::uint32_t key
+ * - Arithmetic promotes to int, so offsets and deltas behave as before
+ * 
  * @note Position (0,0) is top-left corner
  */
 class Coordinate {
 public:
-    int row; ///< Vertical position (0-19)
-    int col; ///< Horizontal position (0-29)
+    std::int16_t row; ///< Vertical position (0-19)
+    std::int16_t col; ///< Horizontal position (0-29)
     
     static const int WORLD_ROWS = 20;  ///< Total screen rows (800px / 40px)
     static const int WORLD_COLS = 30;  ///< Total screen columns (1200px / 40px)
@@ -38,7 +48,8 @@ public:
      * @param r Row position (default: 0)
      * @param c Column position (default: 0)
      */
-    Coordinate(int r = 0, int c = 0);
+    constexpr Coordinate(int r = 0, int c = 0)
+        : row(static_cast<std::int16_t>(r)), col(static_cast<std::int16_t>(c)) {}
     
     /**
      * @brief Add two coordinates (vector addition)
@@ -46,49 +57,66 @@ public:
      * @return Coordinate Result of addition
      * @note Useful for applying movement offsets
      */
-    Coordinate operator+(const Coordinate& other) const;
+    constexpr Coordinate operator+(const Coordinate& other) const {
+        return Coordinate(row + other.row, col + other.col);
+    }
     
     /**
      * @brief Check equality with another coordinate
      * @param other Coordinate to compare
      * @return true if positions match exactly
      */
-    bool operator==(const Coordinate& other) const;
+    constexpr bool operator==(const Coordinate& other) const {
+        return pack() == other.pack();
+    }
     
     /**
      * @brief Check inequality with another coordinate
      * @param other Coordinate to compare
      * @return true if positions differ
      */
-    bool operator!=(const Coordinate& other) const;
+    constexpr bool operator!=(const Coordinate& other) const {
+        return !(*this == other);
+    }
     
     /**
      * @brief Verify coordinate is within valid game bounds
      * @return true if within playable area (rows 3-19, cols 0-29)
      * @note HUD area (rows 0-2) is not considered within bounds
      */
-    bool isWithinBounds() const;
+    constexpr bool isWithinBounds() const {
+        // One unsigned compare per axis covers both the lower and upper limit
+        return static_cast<unsigned>(row - PLAYABLE_START_ROW) < static_cast<unsigned>(PLAYABLE_ROWS) &&
+               static_cast<unsigned>(col) < static_cast<unsigned>(WORLD_COLS);
+    }
     
     /**
      * @brief Check if coordinate is in playable game area
      * @return true if in playable area (not HUD)
      */
-    bool isInPlayableArea() const;
+    constexpr bool isInPlayableArea() const {
+        return isWithinBounds();
+    }
     
     /**
      * @brief Constrain coordinate to valid bounds
      * @return Coordinate Clamped to nearest valid position
      * @note Returns position within playable area if out of bounds
      */
-    Coordinate clampToBounds() const;
+    constexpr Coordinate clampToBounds() const {
+        return Coordinate(clamp(row, PLAYABLE_START_ROW, WORLD_ROWS - 1),
+                          clamp(col, 0, WORLD_COLS - 1));
+    }
     
     /**
      * @brief Calculate Euclidean distance to another coordinate
      * @param other Target coordinate
      * @return float Distance in grid cells
-     * @note Uses sqrt((Δrow)² + (Δcol)²)
+     * @note Uses sqrt((Δrow)² + (Δcol)²) - prefer distanceSquared() for range checks
      */
-    float calculateDistance(const Coordinate& other) const;
+    float calculateDistance(const Coordinate& other) const {
+        return std::sqrt(static_cast<float>(distanceSquared(other)));
+    }
     
     /**
      * @brief Calculate Manhattan distance (grid movement distance)
@@ -96,7 +124,93 @@ public:
      * @return int Manhattan distance |Δrow| + |Δcol|
      * @note Represents minimum moves needed in 4-directional movement
      */
-    int manhattanDistance(const Coordinate& other) const;
+    constexpr int manhattanDistance(const Coordinate& other) const {
+        return absolute(row - other.row) + absolute(col - other.col);
+    }
+    
+    /**
+     * @brief Calculate Chebyshev distance (king-move distance)
+     * @param other Target coordinate
+     * @return int max(|Δrow|, |Δcol|)
+     */
+    constexpr int chebyshevDistance(const Coordinate& other) const {
+        int deltaRow = absolute(row - other.row);
+        int deltaCol = absolute(col - other.col);
+        return deltaRow > deltaCol ? deltaRow : deltaCol;
+    }
+    
+    /**
+     * @brief Calculate squared Euclidean distance
+     * @param other Target coordinate
+     * @return int (Δrow)² + (Δcol)²
+     * @note Compare against radius² to range-check without sqrt
+     */
+    constexpr int distanceSquared(const Coordinate& other) const {
+        int deltaRow = row - other.row;
+        int deltaCol = col - other.col;
+        return deltaRow * deltaRow + deltaCol * deltaCol;
+    }
+    
+    /**
+     * @brief Check whether another coordinate lies within a radius
+     * @param other Target coordinate
+     * @param radius Range in cells (inclusive)
+     * @return true if distance <= radius, without a sqrt
+     */
+    constexpr bool isWithinRange(const Coordinate& other, int radius) const {
+        return distanceSquared(other) <= radius * radius;
+    }
+    
+    /**
+     * @brief Pack into a single 32-bit key (row in high half, col in low half)
+     * @return std::uint32_t Key, unique per coordinate; usable for hashing
+     */
+    constexpr std::uint32_t pack() const {
+        return (static_cast<std::uint32_t>(static_cast<std::uint16_t>(row)) << 16) |
+               static_cast<std::uint16_t>(col);
+    }
+    
+    /**
+     * @brief Rebuild a coordinate from pack()
+     * @param key Packed value
+     * @return Coordinate Original coordinate (negative values survive)
+     */
+    static constexpr Coordinate unpack(std::uint32_t key) {
+        return Coordinate(static_cast<std::int16_t>(key >> 16),
+                          static_cast<std::int16_t>(key & 0xFFFFu));
+    }
+    
+    /**
+     * @brief Row-major index into a WORLD_ROWS × WORLD_COLS array
+     * @return int row * WORLD_COLS + col (only meaningful inside the world)
+     */
+    constexpr int toIndex() const {
+        return row * WORLD_COLS + col;
+    }
+    
+    /**
+     * @brief Inverse of toIndex()
+     * @param index Row-major cell index
+     */
+    static constexpr Coordinate fromIndex(int index) {
+        return Coordinate(index / WORLD_COLS, index % WORLD_COLS);
+    }
+
+private:
+    static constexpr int absolute(int value) {
+        return value < 0 ? -value : value;
+    }
+    
+    static constexpr int clamp(int value, int low, int high) {
+        return value < low ? low : (value > high ? high : value);
+    }
 };
 
+static_assert(sizeof(Coordinate) == sizeof(std::uint32_t), "Coordinate must pack into 32 bits");
+static_assert(Coordinate(3, 4) + Coordinate(-1, 2) == Coordinate(2, 6), "offset addition");
+static_assert(Coordinate::unpack(Coordinate(-1, 29).pack()) == Coordinate(-1, 29), "pack round trip");
+static_assert(Coordinate(3, 0).isWithinBounds() && !Coordinate(2, 0).isWithinBounds() &&
+              !Coordinate(3, -1).isWithinBounds() && !Coordinate(20, 0).isWithinBounds(),
+              "playable bounds");
+
 #endif // COORDINATE_H
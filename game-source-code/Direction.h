@@ -0,0 +1,67 @@
+#ifndef DIRECTION_H
+#define DIRECTION_H
+
+#include "Coordinate.h"
+
+/**
+ * @file Direction.h
+ * @brief Grid movement directions and their compile-time offset table
+ */
+
+/**
+ * @enum Direction
+ * @brief Movement directions for grid-based navigation
+ */
+enum class Direction {
+    UP,    ///< Move one cell up (row - 1)
+    DOWN,  ///< Move one cell down (row + 1)
+    LEFT,  ///< Move one cell left (col - 1)
+    RIGHT, ///< Move one cell right (col + 1)
+    NONE   ///< No movement
+};
+
+namespace DirectionTable {
+    /// Offset per Direction, indexed by enum value (NONE is a zero step)
+    inline constexpr Coordinate OFFSETS[] = {
+        Coordinate(-1, 0), Coordinate(1, 0), Coordinate(0, -1), Coordinate(0, 1), Coordinate(0, 0)
+    };
+
+    /// Reverse of each Direction, indexed by enum value
+    inline constexpr Direction OPPOSITES[] = {
+        Direction::DOWN, Direction::UP, Direction::RIGHT, Direction::LEFT, Direction::NONE
+    };
+
+    /// The four moving directions, for neighbour loops
+    inline constexpr Direction CARDINALS[] = {
+        Direction::UP, Direction::DOWN, Direction::LEFT, Direction::RIGHT
+    };
+}
+
+/**
+ * @brief One-cell step for a direction (table lookup, no branch)
+ * @param direction Movement direction
+ * @return Coordinate Offset to add to a position; (0,0) for NONE
+ */
+constexpr Coordinate directionOffset(Direction direction) {
+    return DirectionTable::OFFSETS[static_cast<int>(direction)];
+}
+
+/**
+ * @brief Direction pointing the other way
+ * @param direction Movement direction
+ * @return Direction Reverse (NONE stays NONE)
+ */
+constexpr Direction oppositeDirection(Direction direction) {
+    return DirectionTable::OPPOSITES[static_cast<int>(direction)];
+}
+
+static_assert(directionOffset(Direction::UP) == Coordinate(-1, 0), "UP offset");
+static_assert(directionOffset(Direction::DOWN) == Coordinate(1, 0), "DOWN offset");
+static_assert(directionOffset(Direction::LEFT) == Coordinate(0, -1), "LEFT offset");
+static_assert(directionOffset(Direction::RIGHT) == Coordinate(0, 1), "RIGHT offset");
+static_assert(directionOffset(Direction::NONE) == Coordinate(0, 0), "NONE offset");
+static_assert(oppositeDirection(oppositeDirection(Direction::LEFT)) == Direction::LEFT, "opposite is an involution");
+static_assert(directionOffset(Direction::UP) + directionOffset(oppositeDirection(Direction::UP)) == Coordinate(0, 0),
+              "opposite offsets cancel");
+
+#endif // DIRECTION_H
@@ -0,0 +1,109 @@
+#ifndef DIRECTIONBUFFER_H
+#define DIRECTIONBUFFER_H
+
+#include "Direction.h"
+#include "StateSerializer.h"
+#include <cstdint>
+
+/**
+ * @file DirectionBuffer.h
+ * @brief Short queue of direction presses waiting out a move cooldown
+ */
+
+/**
+ * @class DirectionBuffer
+ * @brief Remembers taps that arrive while the player cannot move yet
+ *
+ * A direction tapped and released during the move cooldown would
+ * otherwise vanish: movement reads held keys, and by the time the
+ * cooldown ends the key is up. The buffer keeps up to CAPACITY such
+ * presses in order and hands them out once the player can move.
+ *
+ * Rules:
+ * - A press repeating the newest queued direction is not queued twice
+ * - When full, the oldest press is dropped (the newest intent wins)
+ * - Presses older than the expiry window are discarded unused, so a
+ *   tap made long before (e.g. while blocked) cannot fire later
+ *
+ * Times are GameClock seconds and the buffer is part of the player's
+ * saved state, so replays and rollback see the same buffered moves.
+ */
+class DirectionBuffer {
+public:
+    static const int CAPACITY = 2;
+
+    DirectionBuffer() : count(0) {}
+
+    /**
+     * @brief Queue a press
+     * @param direction Pressed direction (NONE is ignored)
+     * @param time GameClock time of the press
+     */
+    void push(Direction direction, float time) {
+        if (direction == Direction::NONE) {
+            return;
+        }
+        if (count > 0 && entries[count - 1].direction == direction) {
+            entries[count - 1].time = time;
+            return;
+        }
+        if (count == CAPACITY) {
+            for (int i = 1; i < CAPACITY; ++i) {
+                entries[i - 1] = entries[i];
+            }
+            count--;
+        }
+        entries[count++] = Entry{direction, time};
+    }
+
+    /**
+     * @brief Remove and return the oldest press still within the window
+     * @param now Current GameClock time
+     * @param window Seconds a press stays usable
+     * @return Direction::NONE if nothing usable is queued
+     */
+    Direction take(float now, float window) {
+        while (count > 0) {
+            Entry front = entries[0];
+            for (int i = 1; i < count; ++i) {
+                entries[i - 1] = entries[i];
+            }
+            count--;
+            if (now - front.time <= window) {
+                return front.direction;
+            }
+        }
+        return Direction::NONE;
+    }
+
+    void clear() { count = 0; }
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    void serialize(StateWriter& writer) const {
+        writer.write(static_cast<std::uint32_t>(count));
+        for (int i = 0; i < count; ++i) {
+            writer.write(entries[i].direction);
+            writer.write(entries[i].time);
+        }
+    }
+
+    void deserialize(StateReader& reader) {
+        count = static_cast<int>(reader.readCount(CAPACITY));
+        for (int i = 0; i < count; ++i) {
+            reader.readEnum(entries[i].direction, Direction::NONE);
+            reader.read(entries[i].time);
+        }
+    }
+
+private:
+    struct Entry {
+        Direction direction;
+        float time;
+    };
+
+    Entry entries[CAPACITY];
+    int count;
+};
+
+#endif // DIRECTIONBUFFER_H
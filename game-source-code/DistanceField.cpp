@@ -0,0 +1,60 @@
+#include "DistanceField.h"
+#include <algorithm>
+
+DistanceField::DistanceField() {
+    clear();
+}
+
+void DistanceField::clear() {
+    std::fill(&distances[0][0][0], &distances[0][0][0] + METRIC_COUNT * ROWS * COLS,
+              LARGE_DISTANCE);
+    sourceCount = 0;
+}
+
+void DistanceField::addSource(Coordinate source) {
+    for (int row = 0; row < ROWS; ++row) {
+        for (int col = 0; col < COLS; ++col) {
+            Coordinate cell(row, col);
+            int& manhattan = distances[static_cast<int>(DistanceMetric::MANHATTAN)][row][col];
+            int& chebyshev = distances[static_cast<int>(DistanceMetric::CHEBYSHEV)][row][col];
+            int& euclidean = distances[static_cast<int>(DistanceMetric::EUCLIDEAN_SQUARED)][row][col];
+            manhattan = std::min(manhattan, cell.manhattanDistance(source));
+            chebyshev = std::min(chebyshev, cell.chebyshevDistance(source));
+            euclidean = std::min(euclidean, cell.distanceSquared(source));
+        }
+    }
+    sourceCount++;
+}
+
+int DistanceField::get(Coordinate cell, DistanceMetric metric) const {
+    if (cell.row < 0 || cell.row >= ROWS || cell.col < 0 || cell.col >= COLS) {
+        return LARGE_DISTANCE;
+    }
+    return distances[static_cast<int>(metric)][cell.row][cell.col];
+}
+
+void DistanceField::collectCellsBeyond(DistanceMetric metric, int minExclusive,
+                                       Coordinate topLeft, Coordinate bottomRight,
+                                       std::vector<Coordinate>& out) const {
+    out.clear();
+    int firstRow = std::max<int>(0, topLeft.row);
+    int lastRow = std::min<int>(ROWS - 1, bottomRight.row);
+    int firstCol = std::max<int>(0, topLeft.col);
+    int lastCol = std::min<int>(COLS - 1, bottomRight.col);
+
+    const auto& table = distances[static_cast<int>(metric)];
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int col = firstCol; col <= lastCol; ++col) {
+            if (table[row][col] > minExclusive) {
+                out.push_back(Coordinate(row, col));
+            }
+        }
+    }
+}
+
+void DistanceField::discardCellsWithin(std::vector<Coordinate>& cells, DistanceMetric metric,
+                                       int minExclusive) const {
+    cells.erase(std::remove_if(cells.begin(), cells.end(),
+                    [&](const Coordinate& cell) { return get(cell, metric) <= minExclusive; }),
+                cells.end());
+}
@@ -0,0 +1,93 @@
+#ifndef DISTANCEFIELD_H
+#define DISTANCEFIELD_H
+
+#include <vector>
+#include "Coordinate.h"
+
+/**
+ * @file DistanceField.h
+ * @brief Per-cell distance to the nearest of a set of source cells
+ */
+
+/**
+ * @enum DistanceMetric
+ * @brief Grid distance measures kept by DistanceField
+ */
+enum class DistanceMetric {
+    MANHATTAN = 0,         ///< |Δrow| + |Δcol| (4-way moves)
+    CHEBYSHEV = 1,         ///< max(|Δrow|, |Δcol|) (8-way moves)
+    EUCLIDEAN_SQUARED = 2  ///< (Δrow)² + (Δcol)² - compare with radius²
+};
+
+/**
+ * @class DistanceField
+ * @brief Distance transform over the 20×30 grid for placement queries
+ *
+ * Holds, for every cell and each metric, the distance to the closest
+ * source (player start, placed rocks, ...). Spawn placement then asks
+ * for all cells outside a radius and picks one at random, instead of
+ * retrying random cells with sqrt checks.
+ *
+ * Updates:
+ * - addSource() folds one new source in with a single O(cells) pass
+ *   (min with the existing value), so placing rocks one by one keeps
+ *   the field exact without a rebuild
+ * - get() is an O(1) table lookup
+ * - An empty field reports LARGE_DISTANCE everywhere
+ */
+class DistanceField {
+public:
+    static const int ROWS = Coordinate::WORLD_ROWS;
+    static const int COLS = Coordinate::WORLD_COLS;
+    static const int METRIC_COUNT = 3;
+    static constexpr int LARGE_DISTANCE = 1 << 20;
+
+    DistanceField();
+
+    /**
+     * @brief Remove all sources
+     */
+    void clear();
+
+    /**
+     * @brief Add a source cell and update distances incrementally
+     * @param source Cell to measure from
+     */
+    void addSource(Coordinate source);
+
+    /**
+     * @brief Get distance from a cell to the nearest source
+     * @param cell Cell to query (out of grid returns LARGE_DISTANCE)
+     * @param metric Distance measure
+     */
+    int get(Coordinate cell, DistanceMetric metric) const;
+
+    /**
+     * @brief Collect cells of a region farther than a distance from all sources
+     * @param metric Distance measure
+     * @param minExclusive Cells must be strictly farther than this
+     * @param topLeft Region corner (inclusive)
+     * @param bottomRight Region corner (inclusive)
+     * @param out Receives matching cells (cleared first)
+     */
+    void collectCellsBeyond(DistanceMetric metric, int minExclusive,
+                            Coordinate topLeft, Coordinate bottomRight,
+                            std::vector<Coordinate>& out) const;
+
+    /**
+     * @brief Drop cells no longer farther than a distance (after addSource)
+     * @param cells Candidate list to filter in place
+     * @param metric Distance measure
+     * @param minExclusive Cells must stay strictly farther than this
+     */
+    void discardCellsWithin(std::vector<Coordinate>& cells, DistanceMetric metric,
+                            int minExclusive) const;
+
+    int getSourceCount() const { return sourceCount; }
+
+private:
+    int distances[METRIC_COUNT][ROWS][COLS];
+    int sourceCount;
+};
+
+#endif // DISTANCEFIELD_H
@@ -0,0 +1,147 @@
+#ifndef EFFECTSPRESENTER_H
+#define EFFECTSPRESENTER_H
+
+#include <raylib-cpp.hpp>
+#include "GameEvents.h"
+#include "ParticleSystem.h"
+#include "ScreenShake.h"
+#include "SoundManager.h"
+
+/**
+ * @file EffectsPresenter.h
+ * @brief Turns gameplay events into particles, screen shake and sound
+ */
+
+/**
+ * @class EffectsPresenter
+ * @brief Batched consumer of the gameplay event queue
+ *
+ * EffectsPresenter is the only place that maps gameplay events to
+ * visual and audio feedback. Each frame it drains the whole event
+ * batch in one pass:
+ * - Particles: one emission per event at the cell's pixel center
+ * - Screen shake: only the strongest shake of the batch is applied
+ * - Sound: each effect plays at most once per batch
+ *
+ * Feedback table:
+ * - ENEMY_DESTROYED: Yellow burst (15), shake(5, 0.2s), ENEMY_HIT
+ * - ROCK_LANDED: Gray ring (10), shake(8, 0.25s), ROCK_LAND
+ * - PLAYER_HIT: Red burst (20), shake(15, 0.4s), PLAYER_HIT
+ * - PLAYER_BURNED: Orange burst (15), shake(12, 0.3s), PLAYER_HIT
+ * - POWERUP_COLLECTED: Gold ring (12), POWERUP_COLLECT
+ * - DIG: Brown trail, DIG sound on freshly cut cells
+ * - FIRE_BREATHED: Orange ring (8)
+ * - HARPOON_FIRED: HARPOON_FIRE
+ * - LEVEL_COMPLETED: LEVEL_COMPLETE
+ *
+ * @note SoundManager is optional - pass nullptr to run silent
+ */
+class EffectsPresenter {
+private:
+    static const int SOUND_EFFECT_COUNT = static_cast<int>(SoundEffect::COUNT);
+
+    ParticleSystem& particles;
+    ScreenShake& screenShake;
+    SoundManager* soundManager;
+    int cellSize;
+
+public:
+    /**
+     * @brief Construct presenter over existing presentation systems
+     * @param particleSystem Particle system to emit into
+     * @param shake Screen shake to trigger
+     * @param sound Sound manager (nullptr for silent)
+     * @param cellSz Grid cell size in pixels
+     */
+    EffectsPresenter(ParticleSystem& particleSystem, ScreenShake& shake,
+                     SoundManager* sound, int cellSz)
+        : particles(particleSystem), screenShake(shake),
+          soundManager(sound), cellSize(cellSz) {}
+
+    /**
+     * @brief Present and clear all queued events
+     * @param events Frame's event batch
+     */
+    void drain(GameEventQueue& events) {
+        float shakeIntensity = 0.0f;
+        float shakeDuration = 0.0f;
+        bool soundPlayed[SOUND_EFFECT_COUNT] = {};
+
+        for (const GameEvent& event : events) {
+            Vector2 center = toPixelCenter(event.position);
+
+            switch (event.type) {
+                case GameEventType::ENEMY_DESTROYED:
+                    particles.emitBurst(center, YELLOW, 15);
+                    requestShake(shakeIntensity, shakeDuration, 5.0f, 0.2f);
+                    requestSound(soundPlayed, SoundEffect::ENEMY_HIT);
+                    break;
+                case GameEventType::ROCK_LANDED:
+                    particles.emit(center, GRAY, 10);
+                    requestShake(shakeIntensity, shakeDuration, 8.0f, 0.25f);
+                    requestSound(soundPlayed, SoundEffect::ROCK_LAND);
+                    break;
+                case GameEventType::PLAYER_HIT:
+                    particles.emitBurst(center, RED, 20);
+                    requestShake(shakeIntensity, shakeDuration, 15.0f, 0.4f);
+                    requestSound(soundPlayed, SoundEffect::PLAYER_HIT);
+                    break;
+                case GameEventType::PLAYER_BURNED:
+                    particles.emitBurst(center, ORANGE, 15);
+                    requestShake(shakeIntensity, shakeDuration, 12.0f, 0.3f);
+                    requestSound(soundPlayed, SoundEffect::PLAYER_HIT);
+                    break;
+                case GameEventType::POWERUP_COLLECTED:
+                    particles.emit(center, GOLD, 12);
+                    requestSound(soundPlayed, SoundEffect::POWERUP_COLLECT);
+                    break;
+                case GameEventType::DIG:
+                    particles.emitTrail(center, BROWN);
+                    if (event.value > 0) {
+                        requestSound(soundPlayed, SoundEffect::DIG);
+                    }
+                    break;
+                case GameEventType::FIRE_BREATHED:
+                    particles.emit(center, ORANGE, 8);
+                    break;
+                case GameEventType::HARPOON_FIRED:
+                    requestSound(soundPlayed, SoundEffect::HARPOON_FIRE);
+                    break;
+                case GameEventType::LEVEL_COMPLETED:
+                    requestSound(soundPlayed, SoundEffect::LEVEL_COMPLETE);
+                    break;
+            }
+        }
+
+        if (shakeIntensity > 0.0f) {
+            screenShake.shake(shakeIntensity, shakeDuration);
+        }
+
+        events.clear();
+    }
+
+private:
+    Vector2 toPixelCenter(Coordinate pos) const {
+        return Vector2{
+            pos.col * cellSize + cellSize / 2.0f,
+            pos.row * cellSize + cellSize / 2.0f
+        };
+    }
+
+    void requestShake(float& intensity, float& duration,
+                      float newIntensity, float newDuration) const {
+        if (newIntensity > intensity) {
+            intensity = newIntensity;
+            duration = newDuration;
+        }
+    }
+
+    void requestSound(bool (&played)[SOUND_EFFECT_COUNT], SoundEffect effect) {
+        int index = static_cast<int>(effect);
+        if (!soundManager || played[index]) return;
+        played[index] = true;
+        soundManager->playSound(effect);
+    }
+};
+
+#endif // EFFECTSPRESENTER_H
@@ -1,12 +1,16 @@
 #include "Enemy.h"
+#include "StateSerializer.h"
+#include "GameRandom.h"
+#include "GameClock.h"
 #include "BlockGrid.h"
 #include "GameConstants.h"
+#include "EnemyArchetypes.h"
 #include <raylib-cpp.hpp>
+#include <algorithm>
 
 using namespace GameConstants;
 
 const float DESTROY_DURATION = 0.8f;
-const float FIRE_BREATH_COOLDOWN = 2.5f;
 const float FIRE_BREATH_STATE_DURATION = 0.5f;
 
 Enemy::Enemy(Coordinate startPos, EnemyType type) 
@@ -14,26 +18,25 @@ Enemy::Enemy(Coordinate startPos, EnemyType type)
       moveTimer(0.0f), isPhasing(false), currentState(EnemyState::NORMAL),
       stateTimer(0.0f), baseSpeed(1.0f), health(1), isDestroyed(false),
       destroyTimer(0.0f), destroyDuration(DESTROY_DURATION),
-      fireBreathTimer(FIRE_BREATH_COOLDOWN), fireBreathCooldown(FIRE_BREATH_COOLDOWN),
-      canBreatheFire(false) {
+      fireBreathTimer(0.0f), fireBreathCooldown(0.0f), canBreatheFire(false) {
     
-    moveCooldown = getMoveCooldownForType();
-    
-    if (type == EnemyType::AGGRESSIVE_MONSTER) {
+    const EnemyArchetype& archetype = EnemyArchetypes::get(type);
+    moveCooldown = archetype.moveCooldown;
+    health = archetype.health;
+    canBreatheFire = archetype.breathesFire;
+    fireBreathCooldown = archetype.fireCooldown;
+    fireBreathTimer = archetype.fireCooldown;
+    if (archetype.aggressive) {
         ai.setAggressive(true);
-        health = 2;
-    } else if (type == EnemyType::GREEN_DRAGON) {
-        health = 2;
-        canBreatheFire = true;
     }
     
-    float randomFactor = 0.8f + (std::rand() % 40) * 0.01f;
+    float randomFactor = 0.8f + GameRandom::nextInt(40) * 0.01f;
     moveCooldown *= randomFactor;
 }
 
 void Enemy::update() {
     if (isDestroyed) {
-        destroyTimer += GetFrameTime();
+        destroyTimer += GameClock::frameTime();
         if (destroyTimer >= destroyDuration) {
             setActive(false);
         }
@@ -48,35 +51,48 @@ void Enemy::render() {
 }
 
 bool Enemy::moveToward(Coordinate target, const BlockGrid& terrain) {
+    return moveToward(target, EnemyMoveContext(terrain));
+}
+
+bool Enemy::moveToward(Coordinate target, const EnemyMoveContext& context) {
     if (!canMove() || isDestroyed) {
         return false;
     }
     
-    Direction nextMove = ai.selectNextAction(position, target, terrain);
+    const BlockGrid& terrain = context.terrain;
+    Direction nextMove = (context.replan || !ai.hasPlan()) 
+        ? ai.selectNextAction(position, target, terrain, context.paths) 
+        : ai.followPlan();
     
     if (nextMove == Direction::NONE) {
         return false;
     }
     
-    Coordinate offset;
-    switch (nextMove) {
-        case Direction::UP:    offset = Coordinate(-1, 0); break;
-        case Direction::DOWN:  offset = Coordinate(1, 0); break;
-        case Direction::LEFT:  offset = Coordinate(0, -1); break;
-        case Direction::RIGHT: offset = Coordinate(0, 1); break;
-        case Direction::NONE:  return false;
+    if (context.reservations && !canEnter(position + directionOffset(nextMove), context)) {
+        nextMove = detourAround(nextMove, target, context);
+        if (nextMove == Direction::NONE) {
+            return false; // Wait; moveTimer unchanged so we retry next tick
+        }
     }
     
-    Coordinate newPos = position + offset;
+    Coordinate newPos = position + directionOffset(nextMove);
     
     if (!newPos.isWithinBounds()) {
         return false;
     }
     
+    if (context.reservations) {
+        // We are there now (nobody may take it) and stay until our next move
+        int holdSteps = 2 + static_cast<int>(moveCooldown / context.tickSeconds);
+        context.reservations->claimSpan(newPos, 0, 2, context.agent, 
+                                        ReservationTable::HOLD_PRIORITY);
+        context.reservations->claimSpan(newPos, 2, holdSteps - 2, context.agent, context.priority);
+    }
+    
     if (terrain.isLocationBlocked(newPos)) {
         isPhasing = true;
         currentState = EnemyState::PHASING;
-        stateTimer = GetTime();
+        stateTimer = GameClock::now();
     } else {
         isPhasing = false;
         if (currentState == EnemyState::PHASING) {
@@ -86,10 +102,50 @@ bool Enemy::moveToward(Coordinate target, const BlockGrid& terrain) {
     
     position = newPos;
     currentDirection = nextMove;
-    moveTimer = GetTime();
+    moveTimer = GameClock::now();
     return true;
 }
 
+float Enemy::getTimeUntilMove() const {
+    float now = GameClock::now();
+    if (currentState == EnemyState::STUNNED) {
+        return std::max(0.0f, stateTimer + ENEMY_STUN_DURATION - now);
+    }
+    if (currentState == EnemyState::BREATHING_FIRE) {
+        return std::max(0.0f, stateTimer + FIRE_BREATH_STATE_DURATION - now);
+    }
+    return std::max(0.0f, moveTimer + moveCooldown - now);
+}
+
+bool Enemy::canEnter(Coordinate cell, const EnemyMoveContext& context) {
+    const ReservationTable& table = *context.reservations;
+    return cell.isWithinBounds() &&
+           table.isFree(cell, 0, context.agent, context.priority) &&
+           table.isFree(cell, 1, context.agent, context.priority);
+}
+
+Direction Enemy::detourAround(Direction blocked, Coordinate target, 
+                              const EnemyMoveContext& context) const {
+    // Best free neighbour: closest to the target, tunnels before earth,
+    // never straight back unless nothing else is free
+    Direction best = Direction::NONE;
+    int bestCost = 0;
+    for (Direction option : DirectionTable::CARDINALS) {
+        if (option == blocked) continue;
+        Coordinate cell = position + directionOffset(option);
+        if (!canEnter(cell, context)) continue;
+        
+        int cost = cell.manhattanDistance(target) * 4;
+        if (context.terrain.isLocationBlocked(cell)) cost += 2;
+        if (option == oppositeDirection(currentDirection)) cost += 8;
+        if (best == Direction::NONE || cost < bestCost) {
+            best = option;
+            bestCost = cost;
+        }
+    }
+    return best;
+}
+
 Direction Enemy::getCurrentDirection() const {
     return currentDirection;
 }
@@ -140,7 +196,7 @@ void Enemy::takeDamage(int damage) {
         destroy();
     } else {
         currentState = EnemyState::STUNNED;
-        stateTimer = GetTime();
+        stateTimer = GameClock::now();
     }
 }
 
@@ -163,23 +219,23 @@ bool Enemy::canMove() const {
     if (isDestroyed) return false;
     
     if (currentState == EnemyState::STUNNED) {
-        return (GetTime() - stateTimer) > 0.5f;
+        return (GameClock::now() - stateTimer) > ENEMY_STUN_DURATION;
     }
     
     if (currentState == EnemyState::BREATHING_FIRE) {
         return false;
     }
     
-    float currentTime = GetTime();
+    float currentTime = GameClock::now();
     return (currentTime - moveTimer) >= moveCooldown;
 }
 
 void Enemy::updateState() {
-    float currentTime = GetTime();
+    float currentTime = GameClock::now();
     
     switch (currentState) {
         case EnemyState::STUNNED:
-            if (currentTime - stateTimer > 0.5f) {
+            if (currentTime - stateTimer > ENEMY_STUN_DURATION) {
                 currentState = EnemyState::NORMAL;
             }
             break;
@@ -201,20 +257,14 @@ void Enemy::updateState() {
 }
 
 float Enemy::getMoveCooldownForType() const {
-    switch (enemyType) {
-        case EnemyType::RED_MONSTER:       return 0.4f;
-        case EnemyType::AGGRESSIVE_MONSTER: return 0.25f;
-        case EnemyType::FAST_MONSTER:      return 0.15f;
-        case EnemyType::GREEN_DRAGON:      return 0.35f;
-    }
-    return 0.4f;
+    return EnemyArchetypes::get(enemyType).moveCooldown;
 }
 
 void Enemy::updateFireBreathing() {
     if (!canBreatheFire) return;
     
     if (currentState != EnemyState::BREATHING_FIRE) {
-        fireBreathTimer += GetFrameTime();
+        fireBreathTimer += GameClock::frameTime();
     }
 }
 
@@ -224,25 +274,54 @@ bool Enemy::shouldBreatheFire(Coordinate playerPos) const {
     if (currentState == EnemyState::STUNNED) return false;
     if (fireBreathTimer < fireBreathCooldown) return false;
     
-    float distance = position.calculateDistance(playerPos);
-    bool inRange = distance < 8.0f && distance > 1.0f;
-    
-    if (inRange) {
-        const_cast<Enemy*>(this)->currentState = EnemyState::BREATHING_FIRE;
-        const_cast<Enemy*>(this)->stateTimer = GetTime();
-        return true;
-    }
-    
-    return false;
+    int fireRange = EnemyArchetypes::get(enemyType).fireRange;
+    int distanceSquared = position.distanceSquared(playerPos);
+    return distanceSquared < fireRange * fireRange && distanceSquared > 1;
 }
 
-Direction Enemy::getFireDirection(Coordinate playerPos) const {
-    int deltaRow = playerPos.row - position.row;
-    int deltaCol = playerPos.col - position.col;
-    
-    if (std::abs(deltaRow) > std::abs(deltaCol)) {
-        return (deltaRow > 0) ? Direction::DOWN : Direction::UP;
-    } else {
-        return (deltaCol > 0) ? Direction::RIGHT : Direction::LEFT;
-    }
+void Enemy::beginFireBreath() {
+    currentState = EnemyState::BREATHING_FIRE;
+    stateTimer = GameClock::now();
+}
+
+void Enemy::serialize(StateWriter& writer) const {
+    writer.write(position);
+    writer.write(active);
+    writer.write(enemyType);
+    writer.write(currentDirection);
+    writer.write(moveTimer);
+    writer.write(moveCooldown);
+    writer.write(isPhasing);
+    writer.write(currentState);
+    writer.write(stateTimer);
+    writer.write(baseSpeed);
+    writer.write(health);
+    writer.write(isDestroyed);
+    writer.write(destroyTimer);
+    writer.write(destroyDuration);
+    writer.write(fireBreathTimer);
+    writer.write(fireBreathCooldown);
+    writer.write(canBreatheFire);
+    ai.serialize(writer);
+}
+
+void Enemy::deserialize(StateReader& reader) {
+    reader.readPosition(position);
+    reader.read(active);
+    reader.readEnum(enemyType, EnemyType::GREEN_DRAGON);
+    reader.readEnum(currentDirection, Direction::NONE);
+    reader.read(moveTimer);
+    reader.read(moveCooldown);
+    reader.read(isPhasing);
+    reader.readEnum(currentState, EnemyState::BREATHING_FIRE);
+    reader.read(stateTimer);
+    reader.read(baseSpeed);
+    reader.read(health);
+    reader.read(isDestroyed);
+    reader.read(destroyTimer);
+    reader.read(destroyDuration);
+    reader.read(fireBreathTimer);
+    reader.read(fireBreathCooldown);
+    reader.read(canBreatheFire);
+    ai.deserialize(reader);
 }
@@ -4,6 +4,10 @@
 #include "GameObject.h"
 #include "Coordinate.h"
 #include "EnemyLogic.h"
+#include "ReservationTable.h"
+
+class StateWriter;
+class StateReader;
 
 /**
  * @file Enemy.h
@@ -33,6 +37,28 @@ enum class EnemyState {
     BREATHING_FIRE  ///< Firing projectile (GREEN_DRAGON)
 };
 
+/**
+ * @struct EnemyMoveContext
+ * @brief What an enemy move needs to know about the rest of the world
+ *
+ * With reservations set, the enemy only steps into a cell no other
+ * enemy holds for the arrival tick and the next, detours to the best
+ * free neighbour otherwise (or waits), and claims the cell it enters
+ * for as long as it will stand there. With replan off it keeps its
+ * last direction instead of running the AI (see AIScheduler).
+ */
+struct EnemyMoveContext {
+    const BlockGrid& terrain;
+    ReservationTable* reservations = nullptr;      ///< nullptr = ignore other enemies
+    int agent = ReservationTable::NO_OWNER;        ///< This enemy's id in the table
+    int priority = 0;                              ///< Conflict priority (higher wins)
+    float tickSeconds = 1.0f / 60.0f;              ///< Length of one table step
+    bool replan = true;                            ///< false = reuse the last direction
+    PathServices paths;                            ///< Shared router and path cache
+
+    explicit EnemyMoveContext(const BlockGrid& grid) : terrain(grid) {}
+};
+
 /**
  * @class Enemy
  * @brief Autonomous underground monster with AI
@@ -40,13 +66,13 @@ enum class EnemyState {
  * Enemies autonomously pursue player using pathfinding.
  * They can move through tunnels and solid earth (phasing).
  * 
- * Enemy types and properties:
+ * Enemy types and default properties:
  * - RED_MONSTER: Basic (speed 0.4s, 1 HP)
  * - AGGRESSIVE_MONSTER: Fast (speed 0.25s, 2 HP)
- * - FAST_MONSTER: Speed demon (speed 0.15s, 1 HP)
+ * - FAST_MONSTER: Speed demon (speed 0.15s, 1 HP, from level 4)
  * - GREEN_DRAGON: Fire breather (speed 0.35s, 2 HP)
  * 
- * @note Movement cooldowns vary by type
+ * @note Stats come from the EnemyArchetypes table (enemies.cfg)
  */
 class Enemy : public GameObject, public Collidable {
 private:
@@ -86,7 +112,27 @@ public:
      */
     bool moveToward(Coordinate target, const BlockGrid& terrain);
     
+    /**
+     * @brief Move toward target, respecting other enemies' reservations
+     * @param target Target coordinate (player position)
+     * @param context Terrain, reservation table and this enemy's id/priority
+     * @return true if movement successful (false also when waiting for a cell)
+     */
+    bool moveToward(Coordinate target, const EnemyMoveContext& context);
+    
+    /**
+     * @brief Seconds until the enemy may move again (0 = ready)
+     * @note Stunned and fire-breathing enemies report their state's remaining time
+     */
+    float getTimeUntilMove() const;
+    
     Direction getCurrentDirection() const;
+    
+    /**
+     * @brief AI decision state (plan age for AIScheduler)
+     */
+    const EnemyLogic& getLogic() const { return ai; }
+    
     bool getIsPhasing() const;
     EnemyType getEnemyType() const;
     EnemyState getCurrentState() const;
@@ -101,12 +147,38 @@ public:
     int getHealth() const;
     void destroy();
     
+    /**
+     * @brief Check if fire is ready and the player is within fire range
+     * @param playerPos Player coordinate
+     * @return true if a fire breath may be tried this tick
+     * @note Pure query - the caller decides the direction (FireLookahead)
+     *       and calls beginFireBreath() only if it actually fires
+     */
     bool shouldBreatheFire(Coordinate playerPos) const;
-    Direction getFireDirection(Coordinate playerPos) const;
+    
+    /**
+     * @brief Enter BREATHING_FIRE (restarts the fire cooldown when it ends)
+     */
+    void beginFireBreath();
+
+    /**
+     * @brief Write enemy state (including AI memory) to a state snapshot
+     * @param writer Destination
+     */
+    void serialize(StateWriter& writer) const;
+    
+    /**
+     * @brief Restore state written by serialize()
+     * @param reader Source
+     */
+    void deserialize(StateReader& reader);
 
 private:
     void updateMovement(const BlockGrid& terrain, Coordinate playerPos);
     bool canMove() const;
+    Direction detourAround(Direction blocked, Coordinate target, 
+                           const EnemyMoveContext& context) const;
+    static bool canEnter(Coordinate cell, const EnemyMoveContext& context);
     void updateState();
     float getMoveCooldownForType() const;
     void updateFireBreathing();
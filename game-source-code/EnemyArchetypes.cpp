@@ -0,0 +1,227 @@
+#include "EnemyArchetypes.h"
+#include "Enemy.h"
+#include "GameRandom.h"
+#include "GameLog.h"
+#include "LiveTable.h"
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+
+namespace {
+    // RED_MONSTER, AGGRESSIVE_MONSTER, FAST_MONSTER, GREEN_DRAGON
+    const EnemyArchetypes::Table BUILT_IN = {{
+        {0.40f, 0.0f, 0, 1, 100, 40, 1, false, false},
+        {0.25f, 0.0f, 0, 2, 200, 30, 1, true,  false},
+        {0.15f, 0.0f, 0, 1, 150, 10, 4, false, false},
+        {0.35f, 2.5f, 8, 2, 100, 30, 1, false, true},
+    }};
+
+    const char* const TYPE_NAMES[EnemyArchetypes::TYPE_COUNT] = {
+        "RED_MONSTER", "AGGRESSIVE_MONSTER", "FAST_MONSTER", "GREEN_DRAGON"
+    };
+
+    LiveTable<EnemyArchetypes::Table>& liveTable() {
+        static LiveTable<EnemyArchetypes::Table> table(BUILT_IN);
+        return table;
+    }
+
+    struct LoaderState {
+        std::mutex mutex;
+        std::string path;
+        std::filesystem::file_time_type loadedTime;
+    };
+
+    LoaderState& loader() {
+        static LoaderState state;
+        return state;
+    }
+
+    bool readFileTime(const std::string& path, std::filesystem::file_time_type& time) {
+        std::error_code error;
+        time = std::filesystem::last_write_time(path, error);
+        return !error;
+    }
+
+    bool loadTable(const std::string& path, EnemyArchetypes::Table& table) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            GameLog::info() << "Enemy config " << path << " not found, using built-in stats" << std::endl;
+            return false;
+        }
+        std::string error;
+        if (!EnemyArchetypes::parse(file, table, error)) {
+            GameLog::info() << "Enemy config " << path << " rejected: " << error << std::endl;
+            return false;
+        }
+        return true;
+    }
+}
+
+const EnemyArchetype& EnemyArchetypes::get(EnemyType type) {
+    return liveTable().get().rows[static_cast<int>(type)];
+}
+
+const EnemyArchetypes::Table& EnemyArchetypes::defaults() {
+    return BUILT_IN;
+}
+
+bool EnemyArchetypes::parse(std::istream& input, Table& out, std::string& error) {
+    bool seen[TYPE_COUNT] = {};
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(input, line)) {
+        lineNumber++;
+        std::size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        std::istringstream fields(line);
+        std::string name;
+        if (!(fields >> name)) continue;
+
+        int index = -1;
+        for (int i = 0; i < TYPE_COUNT; ++i) {
+            if (name == TYPE_NAMES[i]) index = i;
+        }
+        std::string where = "line " + std::to_string(lineNumber) + ": ";
+        if (index < 0) {
+            error = where + "unknown enemy type '" + name + "'";
+            return false;
+        }
+        if (seen[index]) {
+            error = where + name + " listed twice";
+            return false;
+        }
+
+        EnemyArchetype row{};
+        int aggressive = 0, fire = 0;
+        if (!(fields >> row.moveCooldown >> row.health >> row.baseScore >> aggressive >> fire
+                     >> row.fireCooldown >> row.fireRange >> row.spawnWeight >> row.minLevel)) {
+            error = where + "expected 9 values after the type";
+            return false;
+        }
+        std::string extra;
+        if (fields >> extra) {
+            error = where + "unexpected value '" + extra + "'";
+            return false;
+        }
+        row.aggressive = aggressive != 0;
+        row.breathesFire = fire != 0;
+
+        if (row.moveCooldown < 0.02f || row.moveCooldown > 5.0f) {
+            error = where + "cooldown must be 0.02-5 seconds";
+        } else if (row.health < 1 || row.health > 10) {
+            error = where + "health must be 1-10";
+        } else if (row.baseScore < 0 || row.baseScore > 100000) {
+            error = where + "score must be 0-100000";
+        } else if (row.breathesFire && (row.fireCooldown < 0.1f || row.fireCooldown > 60.0f)) {
+            error = where + "fire_cooldown must be 0.1-60 seconds";
+        } else if (row.fireRange < 0 || row.fireRange > Coordinate::WORLD_COLS) {
+            error = where + "fire_range must be 0-" + std::to_string(Coordinate::WORLD_COLS);
+        } else if (row.spawnWeight < 0 || row.spawnWeight > 1000) {
+            error = where + "weight must be 0-1000";
+        } else if (row.minLevel < 1) {
+            error = where + "min_level must be at least 1";
+        }
+        if (!error.empty()) {
+            return false;
+        }
+
+        out.rows[index] = row;
+        seen[index] = true;
+    }
+
+    int levelOneWeight = 0;
+    for (int i = 0; i < TYPE_COUNT; ++i) {
+        if (!seen[i]) {
+            error = std::string("missing row for ") + TYPE_NAMES[i];
+            return false;
+        }
+        if (out.rows[i].minLevel <= 1) levelOneWeight += out.rows[i].spawnWeight;
+    }
+    if (levelOneWeight <= 0) {
+        error = "no type can spawn on level 1 (all weights 0)";
+        return false;
+    }
+    return true;
+}
+
+bool EnemyArchetypes::load(const std::string& path) {
+    Table table;
+    std::filesystem::file_time_type time{};
+    bool haveTime = readFileTime(path, time);
+    bool loaded = loadTable(path, table);
+
+    {
+        std::lock_guard<std::mutex> lock(loader().mutex);
+        loader().path = path;
+        loader().loadedTime = haveTime ? time : std::filesystem::file_time_type{};
+    }
+    if (loaded) {
+        install(table);
+    }
+    return loaded;
+}
+
+bool EnemyArchetypes::reloadIfChanged() {
+    std::string path;
+    std::filesystem::file_time_type time{};
+    {
+        std::lock_guard<std::mutex> lock(loader().mutex);
+        if (loader().path.empty() || !readFileTime(loader().path, time) || 
+            time == loader().loadedTime) {
+            return false;
+        }
+        loader().loadedTime = time;
+        path = loader().path;
+    }
+
+    Table table;
+    if (!loadTable(path, table)) {
+        return false;
+    }
+    install(table);
+    GameLog::info() << "Enemy config reloaded from " << path << std::endl;
+    return true;
+}
+
+void EnemyArchetypes::install(const Table& table) {
+    liveTable().install(table);
+}
+
+void EnemyArchetypes::resetToDefaults() {
+    std::lock_guard<std::mutex> lock(loader().mutex);
+    loader().path.clear();
+    liveTable().reset();
+}
+
+EnemyType EnemyArchetypes::pickSpawnType(int level) {
+    const Table& table = liveTable().get();
+
+    // Strongest types first: until FAST_MONSTER unlocks, the default
+    // weights give the original 30% dragon / 30% aggressive / 40% red
+    // roll ranges for the same random number
+    int total = 0;
+    for (int i = TYPE_COUNT - 1; i >= 0; --i) {
+        if (level >= table.rows[i].minLevel) total += table.rows[i].spawnWeight;
+    }
+    if (total <= 0) {
+        return EnemyType::RED_MONSTER;
+    }
+
+    int roll = GameRandom::nextInt(total);
+    for (int i = TYPE_COUNT - 1; i >= 0; --i) {
+        if (level < table.rows[i].minLevel) continue;
+        roll -= table.rows[i].spawnWeight;
+        if (roll < 0) {
+            return static_cast<EnemyType>(i);
+        }
+    }
+    return EnemyType::RED_MONSTER;
+}
+
+const char* EnemyArchetypes::typeName(EnemyType type) {
+    return TYPE_NAMES[static_cast<int>(type)];
+}
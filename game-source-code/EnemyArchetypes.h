@@ -0,0 +1,115 @@
+#ifndef ENEMYARCHETYPES_H
+#define ENEMYARCHETYPES_H
+
+#include <istream>
+#include <string>
+
+enum class EnemyType;
+
+/**
+ * @file EnemyArchetypes.h
+ * @brief Data-driven enemy stats loaded from resources/config/enemies.cfg
+ */
+
+/**
+ * @struct EnemyArchetype
+ * @brief Tunable stats for one EnemyType (one flat row of the table)
+ */
+struct EnemyArchetype {
+    float moveCooldown;  ///< Seconds between moves (before per-enemy jitter)
+    float fireCooldown;  ///< Seconds between fire breaths
+    int fireRange;       ///< Fire reach in cells (compared squared)
+    int health;          ///< Hit points
+    int baseScore;       ///< Points per kill, multiplied by level
+    int spawnWeight;     ///< Relative chance in random spawns (0 = never)
+    int minLevel;        ///< First level the type may spawn randomly
+    bool aggressive;     ///< Uses aggressive pursuit AI
+    bool breathesFire;   ///< Can fire FireProjectiles
+};
+
+/**
+ * @class EnemyArchetypes
+ * @brief Flat table of EnemyArchetype rows indexed by EnemyType
+ *
+ * Enemy, CollisionManager and spawn code read stats from here instead
+ * of switching on the type:
+ * - get() is one atomic pointer load plus an array index (LiveTable)
+ * - The compiled-in defaults match the shipped enemies.cfg, so a
+ *   missing file changes nothing
+ * - load()/reloadIfChanged() parse and validate a whole new table and
+ *   publish it atomically; a bad edit is rejected and the old table
+ *   stays live, so a typo never breaks a running game
+ *
+ * Enemies copy health and move speed when spawned; score, fire range
+ * and spawn weights are read live, so a reload takes effect at once
+ * for those and for every enemy spawned afterwards.
+ *
+ * File format (one row per type, '#' starts a comment):
+ * @code
+ * # type  cooldown health score aggressive fire fire_cooldown fire_range weight min_level
+ * RED_MONSTER 0.40 1 100 0 0 0.0 0 40 1
+ * @endcode
+ */
+class EnemyArchetypes {
+public:
+    static const int TYPE_COUNT = 4;
+    static constexpr const char* DEFAULT_PATH = "resources/config/enemies.cfg";
+
+    struct Table {
+        EnemyArchetype rows[TYPE_COUNT];
+    };
+
+    /**
+     * @brief Stats for a type from the live table
+     */
+    static const EnemyArchetype& get(EnemyType type);
+
+    /**
+     * @brief Built-in table (used until a file is loaded)
+     */
+    static const Table& defaults();
+
+    /**
+     * @brief Parse and validate a table
+     * @param input Text in the format above
+     * @param out Receives the table (only complete on success)
+     * @param error Receives a description of the first problem
+     * @return true if every type is present exactly once and in range
+     */
+    static bool parse(std::istream& input, Table& out, std::string& error);
+
+    /**
+     * @brief Load a file and make it the live table
+     * @param path File to read (remembered for reloadIfChanged())
+     * @return true if loaded; false keeps the current table
+     */
+    static bool load(const std::string& path = DEFAULT_PATH);
+
+    /**
+     * @brief Reload the last loaded file if its timestamp changed
+     * @return true if a new table was installed
+     * @note Call at a tick boundary (between simulation steps)
+     */
+    static bool reloadIfChanged();
+
+    /**
+     * @brief Publish a table (validated by the caller)
+     */
+    static void install(const Table& table);
+
+    /**
+     * @brief Go back to the built-in table and forget the loaded file
+     */
+    static void resetToDefaults();
+
+    /**
+     * @brief Pick a random type for a spawn, weighted by the table
+     * @param level Current level (types below minLevel are skipped)
+     * @return EnemyType Chosen type (draws one GameRandom number)
+     */
+    static EnemyType pickSpawnType(int level);
+
+    static const char* typeName(EnemyType type);
+};
+
+#endif // ENEMYARCHETYPES_H
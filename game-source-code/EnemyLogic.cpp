@@ -1,26 +1,27 @@
 #include "EnemyLogic.h"
+#include "StateSerializer.h"
+#include "GameRandom.h"
+#include "GameClock.h"
+#include "HierarchicalPathfinder.h"
+#include "PathCache.h"
 #include <cstdlib>
 #include <ctime>
 #include <algorithm>
-#include <queue>
 #include <map>
 #include <raylib-cpp.hpp>
 
 EnemyLogic::EnemyLogic() : previousMove(Direction::NONE), blockedCount(0), 
-                          stuckCounter(0), lastDecisionTime(0.0f), isAggressive(false) {
-    static bool seeded = false;
-    if (!seeded) {
-        std::srand(static_cast<unsigned>(std::time(nullptr)));
-        seeded = true;
-    }
-    
+                          stuckCounter(0), lastDecisionTime(0.0f), isAggressive(false),
+                          movesSincePlan(0) {
     // Add individual randomization for each enemy
-    lastDecisionTime = GetTime() + (std::rand() % 50) * 0.01f;
+    lastDecisionTime = GameClock::now() + GameRandom::nextInt(50) * 0.01f;
 }
 
 Direction EnemyLogic::selectNextAction(Coordinate currentPos, Coordinate playerPos, 
-                                      const BlockGrid& environment) {
-    float currentTime = GetTime();
+                                      const BlockGrid& environment,
+                                      const PathServices& paths) {
+    float currentTime = GameClock::now();
+    movesSincePlan = 0;
     
     // Update stuck counter if not moving effectively
     if (currentTime - lastDecisionTime > 1.2f) {
@@ -31,7 +32,7 @@ Direction EnemyLogic::selectNextAction(Coordinate currentPos, Coordinate playerP
     }
     
     // Add randomness to decision making to prevent synchronization
-    int randomBehavior = std::rand() % 100;
+    int randomBehavior = GameRandom::nextInt(100);
     
     // If stuck for too long, try random movement
     if (stuckCounter > 2 || randomBehavior < 15) { // 15% chance of random behavior
@@ -42,18 +43,18 @@ Direction EnemyLogic::selectNextAction(Coordinate currentPos, Coordinate playerP
     }
     
     // Calculate distance to player
-    float distanceToPlayer = currentPos.calculateDistance(playerPos);
+    int distanceSquared = currentPos.distanceSquared(playerPos);
     
     // Add some randomness to movement decisions
     if (randomBehavior < 25) { // 25% chance of slightly random movement
         Direction towardPlayer = findDirectionToward(currentPos, playerPos);
         
         // Sometimes pick a perpendicular direction for more interesting movement
-        if (std::rand() % 3 == 0) {
+        if (GameRandom::nextInt(3) == 0) {
             if (towardPlayer == Direction::UP || towardPlayer == Direction::DOWN) {
-                towardPlayer = (std::rand() % 2 == 0) ? Direction::LEFT : Direction::RIGHT;
+                towardPlayer = (GameRandom::nextInt(2) == 0) ? Direction::LEFT : Direction::RIGHT;
             } else if (towardPlayer == Direction::LEFT || towardPlayer == Direction::RIGHT) {
-                towardPlayer = (std::rand() % 2 == 0) ? Direction::UP : Direction::DOWN;
+                towardPlayer = (GameRandom::nextInt(2) == 0) ? Direction::UP : Direction::DOWN;
             }
         }
         
@@ -62,7 +63,7 @@ Direction EnemyLogic::selectNextAction(Coordinate currentPos, Coordinate playerP
     }
     
     // Use different strategies based on distance and aggression
-    if (distanceToPlayer < 6.0f || isAggressive) {
+    if (distanceSquared < 6 * 6 || isAggressive) {
         // Close range: direct pursuit
         Direction towardPlayer = findDirectionToward(currentPos, playerPos);
         
@@ -73,10 +74,12 @@ Direction EnemyLogic::selectNextAction(Coordinate currentPos, Coordinate playerP
         }
     } else {
         // Long range: use pathfinding with some randomness
-        std::vector<Coordinate> path = findPathToPlayer(currentPos, playerPos, environment);
+        std::vector<Coordinate> localSteps;
+        std::vector<Coordinate>& path = paths.steps ? *paths.steps : localSteps;
+        findPathToPlayer(currentPos, playerPos, environment, paths, path);
         
-        if (path.size() > 1) {
-            Coordinate nextPos = path[1]; // First step in path
+        if (!path.empty()) {
+            Coordinate nextPos = path.front(); // First step in path
             Direction moveDir = findDirectionToward(currentPos, nextPos);
             
             if (moveDir != Direction::NONE) {
@@ -93,30 +96,52 @@ Direction EnemyLogic::selectNextAction(Coordinate currentPos, Coordinate playerP
     return fallbackDir;
 }
 
+Direction EnemyLogic::followPlan() {
+    movesSincePlan++;
+    return previousMove;
+}
+
 bool EnemyLogic::shouldPhaseThrough(Coordinate currentPos, Coordinate playerPos, 
                                    const BlockGrid& environment) {
-    // Enemies can phase through earth blocks in Dig Dug style
-    float distanceToPlayer = currentPos.calculateDistance(playerPos);
-    
-    // More likely to phase when close to player
-    if (distanceToPlayer < 4.0f) {
-        return true;
-    }
-    
     // Phase through if stuck
     if (stuckCounter > 1) {
         return true;
     }
     
-    // Random chance to phase for unpredictability
-    return (std::rand() % 100) < 30;
+    // Sharing a tunnel with the player means a walkable route exists;
+    // otherwise earth is in the way and Dig Dug enemies phase through it
+    return !environment.areConnected(currentPos, playerPos);
 }
 
 std::vector<Coordinate> EnemyLogic::findPathToPlayer(Coordinate start, Coordinate target, 
-                                                   const BlockGrid& environment) {
+                                                   const BlockGrid& environment,
+                                                   const PathServices& paths) {
     std::vector<Coordinate> path;
+    findPathToPlayer(start, target, environment, paths, path);
+    return path;
+}
+
+void EnemyLogic::findPathToPlayer(Coordinate start, Coordinate target,
+                                  const BlockGrid& environment, const PathServices& paths,
+                                  std::vector<Coordinate>& path) {
+    path.clear();
     
-    // Simple pathfinding - can be enhanced with A*
+    if (!shouldPhaseThrough(start, target, environment)) {
+        if (paths.cache && paths.cache->lookup(environment, start, target, path)) {
+            return;
+        }
+        if (paths.router) {
+            paths.router->findSteps(environment, start, target, 8, path);
+        } else {
+            findTunnelPath(start, target, environment, path);
+        }
+        if (paths.cache) {
+            paths.cache->store(environment, start, target, path);
+        }
+        return;
+    }
+    
+    // No tunnel route: straight line through earth (phasing)
     Coordinate current = start;
     int maxSteps = 8; // Prevent infinite loops
     
@@ -127,7 +152,7 @@ std::vector<Coordinate> EnemyLogic::findPathToPlayer(Coordinate start, Coordinat
             break;
         }
         
-        Coordinate nextPos = current + getDirectionOffset(bestDir);
+        Coordinate nextPos = current + directionOffset(bestDir);
         
         if (!nextPos.isWithinBounds()) {
             break;
@@ -137,25 +162,59 @@ std::vector<Coordinate> EnemyLogic::findPathToPlayer(Coordinate start, Coordinat
         current = nextPos;
         maxSteps--;
     }
+}
+
+void EnemyLogic::findTunnelPath(Coordinate start, Coordinate target, 
+                                const BlockGrid& environment, std::vector<Coordinate>& path) const {
+    const int cols = Coordinate::WORLD_COLS;
+    const int cells = Coordinate::WORLD_ROWS * cols;
+    short cameFrom[cells];
+    std::fill(cameFrom, cameFrom + cells, static_cast<short>(-1));
     
-    return path;
+    // Each cell is queued at most once, so a flat array is a large enough queue
+    int frontier[cells];
+    int head = 0;
+    int tail = 0;
+    int startIndex = start.row * cols + start.col;
+    int targetIndex = target.row * cols + target.col;
+    cameFrom[startIndex] = static_cast<short>(startIndex);
+    frontier[tail++] = startIndex;
+    
+    const Direction directions[] = {Direction::UP, Direction::DOWN, 
+                                    Direction::LEFT, Direction::RIGHT};
+    while (head < tail && cameFrom[targetIndex] < 0) {
+        int index = frontier[head++];
+        Coordinate cell(index / cols, index % cols);
+        
+        for (Direction dir : directions) {
+            Coordinate next = cell + directionOffset(dir);
+            int nextIndex = next.row * cols + next.col;
+            if (!environment.isLocationBlocked(next) && cameFrom[nextIndex] < 0) {
+                cameFrom[nextIndex] = static_cast<short>(index);
+                frontier[tail++] = nextIndex;
+            }
+        }
+    }
+    
+    path.clear();
+    if (cameFrom[targetIndex] < 0) {
+        return;
+    }
+    // Walk back from the target (reusing the queue), then keep the first steps
+    int length = 0;
+    for (int index = targetIndex; index != startIndex; index = cameFrom[index]) {
+        frontier[length++] = index;
+    }
+    const int maxSteps = 8;
+    for (int step = length - 1; step >= 0 && length - step <= maxSteps; --step) {
+        path.push_back(Coordinate(frontier[step] / cols, frontier[step] % cols));
+    }
 }
 
 void EnemyLogic::setAggressive(bool aggressive) {
     isAggressive = aggressive;
 }
 
-Coordinate EnemyLogic::getDirectionOffset(Direction dir) const {
-    switch (dir) {
-        case Direction::UP:    return Coordinate(-1, 0);
-        case Direction::DOWN:  return Coordinate(1, 0);
-        case Direction::LEFT:  return Coordinate(0, -1);
-        case Direction::RIGHT: return Coordinate(0, 1);
-        case Direction::NONE:  return Coordinate(0, 0);
-    }
-    return Coordinate(0, 0);
-}
-
 Direction EnemyLogic::findDirectionToward(Coordinate from, Coordinate to) const {
     int deltaRow = to.row - from.row;
     int deltaCol = to.col - from.col;
@@ -163,7 +222,7 @@ Direction EnemyLogic::findDirectionToward(Coordinate from, Coordinate to) const
     // Add some randomness to prevent all enemies moving identically
     if (std::abs(deltaRow) == std::abs(deltaCol) && std::abs(deltaRow) > 0) {
         // When distances are equal, randomly choose direction
-        return (std::rand() % 2 == 0) ? 
+        return (GameRandom::nextInt(2) == 0) ? 
                ((deltaRow > 0) ? Direction::DOWN : Direction::UP) :
                ((deltaCol > 0) ? Direction::RIGHT : Direction::LEFT);
     }
@@ -188,5 +247,23 @@ int EnemyLogic::calculateHeuristic(Coordinate from, Coordinate to) const {
 
 Direction EnemyLogic::getRandomDirection() const {
     Direction directions[] = {Direction::UP, Direction::DOWN, Direction::LEFT, Direction::RIGHT};
-    return directions[std::rand() % 4];
+    return directions[GameRandom::nextInt(4)];
+}
+
+void EnemyLogic::serialize(StateWriter& writer) const {
+    writer.write(previousMove);
+    writer.write(blockedCount);
+    writer.write(stuckCounter);
+    writer.write(lastDecisionTime);
+    writer.write(isAggressive);
+    writer.write(movesSincePlan);
+}
+
+void EnemyLogic::deserialize(StateReader& reader) {
+    reader.readEnum(previousMove, Direction::NONE);
+    reader.read(blockedCount);
+    reader.read(stuckCounter);
+    reader.read(lastDecisionTime);
+    reader.read(isAggressive);
+    reader.read(movesSincePlan);
 }
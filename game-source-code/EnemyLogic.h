@@ -2,24 +2,28 @@
 #define ENEMYLOGIC_H
 
 #include "Coordinate.h"
+#include "Direction.h"
 #include "BlockGrid.h"
 #include <vector>
 
+class StateWriter;
+class StateReader;
+class HierarchicalPathfinder;
+class PathCache;
+
 /**
  * @file EnemyLogic.h
  * @brief AI decision-making system for enemy movement
  */
 
 /**
- * @enum Direction
- * @brief Movement directions for grid-based navigation
+ * @struct PathServices
+ * @brief Shared routing helpers an enemy may use for tunnel paths
  */
-enum class Direction {
-    UP,    ///< Move one cell up (row - 1)
-    DOWN,  ///< Move one cell down (row + 1)
-    LEFT,  ///< Move one cell left (col - 1)
-    RIGHT, ///< Move one cell right (col + 1)
-    NONE   ///< No movement
+struct PathServices {
+    HierarchicalPathfinder* router = nullptr;  ///< Chunk-graph routes (nullptr = grid BFS)
+    PathCache* cache = nullptr;                ///< Recent paths (nullptr = always compute)
+    std::vector<Coordinate>* steps = nullptr;  ///< Reused plan buffer (nullptr = local vector)
 };
 
 /**
@@ -30,6 +34,8 @@ enum class Direction {
  * - 15-25% random movement (prevents predictability)
  * - Stuck detection and recovery
  * - Distance-based strategy (close=direct, far=pathfinding)
+ * - Far pursuit walks shared tunnels and only phases through earth
+ *   when no tunnel connects enemy and player
  * - Randomized timing per enemy (prevents synchronization)
  * 
  * @note Each Enemy has its own EnemyLogic instance
@@ -41,6 +47,7 @@ private:
     int stuckCounter;
     float lastDecisionTime;
     bool isAggressive;
+    int movesSincePlan;   ///< Moves made reusing previousMove (AI level of detail)
 
 public:
     /**
@@ -53,17 +60,37 @@ public:
      * @param currentPos Enemy's current position
      * @param playerPos Player's current position
      * @param environment Game terrain for pathfinding
+     * @param paths Shared router and path cache (defaults: grid BFS, no cache)
      * @return Direction Best direction to move
      */
     Direction selectNextAction(Coordinate currentPos, Coordinate playerPos, 
-                              const BlockGrid& environment);
+                              const BlockGrid& environment,
+                              const PathServices& paths = PathServices());
+    
+    /**
+     * @brief Reuse the last decision instead of planning again
+     * @return Direction Last chosen direction (NONE if never planned)
+     * @note Cheap path for enemies AIScheduler did not pick to replan
+     */
+    Direction followPlan();
+    
+    /**
+     * @brief Check if there is a previous decision to reuse
+     */
+    bool hasPlan() const { return previousMove != Direction::NONE; }
+    
+    /**
+     * @brief Moves made since the last full decision
+     */
+    int getMovesSincePlan() const { return movesSincePlan; }
     
     /**
      * @brief Check if enemy should phase through walls
      * @param currentPos Enemy position
      * @param playerPos Player position
      * @param environment Game terrain
-     * @return true if should phase through
+     * @return true if stuck, or if no tunnel joins enemy and player
+     * @note Uses BlockGrid's tunnel index - no random rolls
      */
     bool shouldPhaseThrough(Coordinate currentPos, Coordinate playerPos, 
                            const BlockGrid& environment);
@@ -73,10 +100,23 @@ public:
      * @param start Starting position
      * @param target Target position
      * @param environment Game environment
-     * @return std::vector<Coordinate> Path to target
+     * @param paths Shared router and path cache (defaults: grid BFS, no cache)
+     * @return std::vector<Coordinate> Up to 8 steps toward target
+     *         (start excluded); follows tunnels when connected,
+     *         otherwise a straight line through earth
      */
     std::vector<Coordinate> findPathToPlayer(Coordinate start, Coordinate target, 
-                                           const BlockGrid& environment);
+                                           const BlockGrid& environment,
+                                           const PathServices& paths = PathServices());
+
+    /**
+     * @brief findPathToPlayer() into a caller's buffer
+     * @param path Cleared and filled with the steps; once its capacity
+     *        has grown to a full plan, planning no longer allocates
+     */
+    void findPathToPlayer(Coordinate start, Coordinate target,
+                          const BlockGrid& environment, const PathServices& paths,
+                          std::vector<Coordinate>& path);
     
     /**
      * @brief Enable aggressive pursuit behavior
@@ -84,9 +124,22 @@ public:
      */
     void setAggressive(bool aggressive);
 
+    /**
+     * @brief Write AI decision memory to a state snapshot
+     * @param writer Destination
+     */
+    void serialize(StateWriter& writer) const;
+    
+    /**
+     * @brief Restore state written by serialize()
+     * @param reader Source
+     */
+    void deserialize(StateReader& reader);
+
 private:
-    Coordinate getDirectionOffset(Direction dir) const;
     Direction findDirectionToward(Coordinate from, Coordinate to) const;
+    void findTunnelPath(Coordinate start, Coordinate target, 
+                        const BlockGrid& environment, std::vector<Coordinate>& path) const;
     bool isSafePosition(Coordinate pos, const BlockGrid& environment) const;
     int calculateHeuristic(Coordinate from, Coordinate to) const;
     Direction getRandomDirection() const;
@@ -0,0 +1,88 @@
+#ifndef ENEMYOCCUPANCY_H
+#define ENEMYOCCUPANCY_H
+
+#include "Coordinate.h"
+#include "Enemy.h"
+#include <vector>
+
+/**
+ * @file EnemyOccupancy.h
+ * @brief Per-cell index of live enemies for grid collision queries
+ */
+
+/**
+ * @class EnemyOccupancy
+ * @brief Maps each grid cell to the live enemies standing on it
+ *
+ * Rebuilt once per collision pass in O(enemies). Ray and cell queries
+ * then touch only the cells they cover instead of every enemy:
+ * - Each cell holds the head of an intrusive list of enemy indices,
+ *   so several enemies can share a cell
+ * - Destroyed/inactive enemies and off-grid positions are left out
+ * - No allocation after the first build at a given enemy count
+ */
+class EnemyOccupancy {
+public:
+    static const int ROWS = Coordinate::WORLD_ROWS;
+    static const int COLS = Coordinate::WORLD_COLS;
+    static constexpr int NO_ENEMY = -1;
+
+    EnemyOccupancy() {
+        clear();
+    }
+
+    void clear() {
+        for (int& head : cellHead) {
+            head = NO_ENEMY;
+        }
+        nextInCell.clear();
+    }
+
+    /**
+     * @brief Index all live enemies by cell
+     * @param enemies Enemy list (indices refer into this vector)
+     */
+    void build(const std::vector<Enemy>& enemies) {
+        clear();
+        nextInCell.assign(enemies.size(), NO_ENEMY);
+        for (int i = static_cast<int>(enemies.size()) - 1; i >= 0; --i) {
+            const Enemy& enemy = enemies[i];
+            if (!enemy.isActive() || enemy.getIsDestroyed()) continue;
+            Coordinate pos = enemy.getPosition();
+            if (!isOnGrid(pos)) continue;
+            int cell = pos.toIndex();
+            nextInCell[i] = cellHead[cell];
+            cellHead[cell] = i;
+        }
+    }
+
+    /**
+     * @brief First enemy index on a cell
+     * @return int Index, or NO_ENEMY
+     */
+    int firstAt(Coordinate cell) const {
+        return isOnGrid(cell) ? cellHead[cell.toIndex()] : NO_ENEMY;
+    }
+
+    /**
+     * @brief Next enemy sharing the cell of enemy index
+     * @return int Index, or NO_ENEMY
+     */
+    int nextAt(int enemyIndex) const {
+        return nextInCell[enemyIndex];
+    }
+
+    bool isOccupied(Coordinate cell) const {
+        return firstAt(cell) != NO_ENEMY;
+    }
+
+private:
+    static bool isOnGrid(Coordinate cell) {
+        return cell.row >= 0 && cell.row < ROWS && cell.col >= 0 && cell.col < COLS;
+    }
+
+    int cellHead[ROWS * COLS];
+    std::vector<int> nextInCell;
+};
+
+#endif // ENEMYOCCUPANCY_H
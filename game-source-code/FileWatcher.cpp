@@ -0,0 +1,135 @@
+#include "FileWatcher.h"
+#include <algorithm>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace {
+    std::string joinPath(const std::string& directory, const std::string& name) {
+        return (std::filesystem::path(directory) / name).generic_string();
+    }
+}
+
+FileWatcher::FileWatcher() : notifyHandle(-1) {
+#ifdef __linux__
+    notifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+}
+
+FileWatcher::~FileWatcher() {
+#ifdef __linux__
+    if (notifyHandle >= 0) {
+        close(notifyHandle);
+    }
+#endif
+}
+
+void FileWatcher::watchFile(const std::string& path) {
+    std::filesystem::path file(path);
+    std::string parent = file.parent_path().empty() ? "." : file.parent_path().generic_string();
+    WatchedDirectory& directory = directoryFor(parent);
+    std::string name = file.filename().generic_string();
+    if (std::find(directory.fileNames.begin(), directory.fileNames.end(), name) == 
+        directory.fileNames.end()) {
+        directory.fileNames.push_back(name);
+    }
+    scanModifiedTimes(directory, nullptr);
+}
+
+void FileWatcher::watchDirectory(const std::string& path) {
+    WatchedDirectory& directory = directoryFor(path);
+    directory.allFiles = true;
+    scanModifiedTimes(directory, nullptr);
+}
+
+std::vector<std::string> FileWatcher::poll() {
+    std::vector<std::string> changed;
+    if (usesNotifications()) {
+        readNotifications(changed);
+    } else {
+        for (auto& directory : directories) {
+            scanModifiedTimes(directory, &changed);
+        }
+    }
+    std::sort(changed.begin(), changed.end());
+    changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+    return changed;
+}
+
+FileWatcher::WatchedDirectory& FileWatcher::directoryFor(const std::string& path) {
+    for (auto& directory : directories) {
+        if (directory.path == path) {
+            return directory;
+        }
+    }
+    directories.emplace_back();
+    WatchedDirectory& directory = directories.back();
+    directory.path = path;
+#ifdef __linux__
+    if (notifyHandle >= 0) {
+        directory.notifyWatch = inotify_add_watch(notifyHandle, path.c_str(),
+                                                  IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+    }
+#endif
+    return directory;
+}
+
+bool FileWatcher::isWatched(const WatchedDirectory& directory, const std::string& name) const {
+    return directory.allFiles ||
+           std::find(directory.fileNames.begin(), directory.fileNames.end(), name) != 
+           directory.fileNames.end();
+}
+
+void FileWatcher::readNotifications(std::vector<std::string>& changed) {
+#ifdef __linux__
+    alignas(inotify_event) char buffer[4096];
+    while (true) {
+        ssize_t length = read(notifyHandle, buffer, sizeof(buffer));
+        if (length <= 0) {
+            break;
+        }
+        for (ssize_t offset = 0; offset < length;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += sizeof(inotify_event) + event->len;
+            if (event->len == 0 || (event->mask & IN_ISDIR)) continue;
+            
+            for (const auto& directory : directories) {
+                if (directory.notifyWatch == event->wd && isWatched(directory, event->name)) {
+                    changed.push_back(joinPath(directory.path, event->name));
+                }
+            }
+        }
+    }
+#else
+    (void)changed;
+#endif
+}
+
+void FileWatcher::scanModifiedTimes(WatchedDirectory& directory, std::vector<std::string>* changed) {
+    std::vector<std::string> names = directory.fileNames;
+    if (directory.allFiles) {
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(directory.path, error)) {
+            if (entry.is_regular_file(error)) {
+                names.push_back(entry.path().filename().generic_string());
+            }
+        }
+    }
+    
+    for (const auto& name : names) {
+        std::error_code error;
+        auto time = std::filesystem::last_write_time(joinPath(directory.path, name), error);
+        if (error) continue;
+        
+        auto known = directory.modified.find(name);
+        if (known == directory.modified.end() || known->second != time) {
+            directory.modified[name] = time;
+            if (changed) {
+                changed->push_back(joinPath(directory.path, name));
+            }
+        }
+    }
+}
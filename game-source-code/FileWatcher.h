@@ -0,0 +1,79 @@
+#ifndef FILEWATCHER_H
+#define FILEWATCHER_H
+
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @file FileWatcher.h
+ * @brief Reports files that changed on disk since the last poll
+ */
+
+/**
+ * @class FileWatcher
+ * @brief Non-blocking change detection for config and map files
+ *
+ * Backends:
+ * - Linux: inotify on each watched directory (close-after-write and
+ *   rename-into events, so both in-place saves and editors that write
+ *   a temp file and rename it are seen). poll() is one non-blocking
+ *   read() and costs nothing when idle.
+ * - Elsewhere, or if inotify is unavailable: modification-time polling
+ *   of the watched files and directory entries.
+ *
+ * Directories are watched, not single files, so a file that is deleted
+ * and re-created keeps being reported. poll() never blocks and returns
+ * each changed path once, however many events a save produced.
+ */
+class FileWatcher {
+public:
+    FileWatcher();
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    /**
+     * @brief Report changes to one file
+     * @param path File (need not exist yet)
+     */
+    void watchFile(const std::string& path);
+
+    /**
+     * @brief Report changes to any file directly inside a directory
+     * @param path Directory
+     */
+    void watchDirectory(const std::string& path);
+
+    /**
+     * @brief Collect changes since the previous call
+     * @return Changed paths (as "directory/name"), sorted, no duplicates
+     */
+    std::vector<std::string> poll();
+
+    /**
+     * @brief Whether the kernel notification backend is active
+     */
+    bool usesNotifications() const { return notifyHandle >= 0; }
+
+private:
+    struct WatchedDirectory {
+        std::string path;
+        bool allFiles = false;
+        std::vector<std::string> fileNames;
+        int notifyWatch = -1;
+        std::map<std::string, std::filesystem::file_time_type> modified;
+    };
+
+    int notifyHandle;
+    std::vector<WatchedDirectory> directories;
+
+    WatchedDirectory& directoryFor(const std::string& path);
+    bool isWatched(const WatchedDirectory& directory, const std::string& name) const;
+    void readNotifications(std::vector<std::string>& changed);
+    void scanModifiedTimes(WatchedDirectory& directory, std::vector<std::string>* changed);
+};
+
+#endif // FILEWATCHER_H
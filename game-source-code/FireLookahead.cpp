@@ -0,0 +1,72 @@
+#include "FireLookahead.h"
+#include "FireProjectile.h"
+#include <cstdlib>
+
+FireLookahead::FireLookahead(int stepsPerTick) 
+    : stepsPerTick(stepsPerTick), stepsLeft(stepsPerTick) {
+}
+
+void FireLookahead::beginTick() {
+    stepsLeft = stepsPerTick;
+}
+
+Direction FireLookahead::chooseDirection(const LocalWorldView& view, Coordinate dragon, 
+                                         float tickSeconds) {
+    int deltaRow = view.player.row - dragon.row;
+    int deltaCol = view.player.col - dragon.col;
+    Direction vertical = deltaRow > 0 ? Direction::DOWN : Direction::UP;
+    Direction horizontal = deltaCol > 0 ? Direction::RIGHT : Direction::LEFT;
+    
+    Direction candidates[2];
+    int count = 0;
+    bool verticalFirst = std::abs(deltaRow) > std::abs(deltaCol);
+    if (verticalFirst && deltaRow != 0) candidates[count++] = vertical;
+    if (deltaCol != 0) candidates[count++] = horizontal;
+    if (!verticalFirst && deltaRow != 0) candidates[count++] = vertical;
+    
+    for (int i = 0; i < count; ++i) {
+        if (predictsHit(view, dragon, candidates[i], tickSeconds)) {
+            return candidates[i];
+        }
+    }
+    return Direction::NONE;
+}
+
+bool FireLookahead::predictsHit(const LocalWorldView& view, Coordinate from, 
+                                Direction direction, float tickSeconds) {
+    FireProjectile fire(from, direction);
+    auto blocked = [&view](Coordinate cell) { return view.isBlocked(cell); };
+    
+    Coordinate movingPlayer = view.player;
+    Coordinate heading = directionOffset(view.playerHeading);
+    float playerTimer = 0.0f;
+    
+    for (int tick = 0; tick < MAX_TICKS && fire.isActive(); ++tick) {
+        if (stepsLeft <= 0) {
+            return false;
+        }
+        stepsLeft--;
+        
+        // Same order as the live tick: the fireball moves, then hits are checked
+        fire.advance(tickSeconds, blocked);
+        if (!fire.isActive()) {
+            break;
+        }
+        
+        if (view.playerHeading != Direction::NONE && view.playerMoveInterval > 0.0f) {
+            playerTimer += tickSeconds;
+            if (playerTimer >= view.playerMoveInterval) {
+                playerTimer -= view.playerMoveInterval;
+                Coordinate next = movingPlayer + heading;
+                if (next.isWithinBounds()) {
+                    movingPlayer = next;
+                }
+            }
+        }
+        
+        if (fire.checkPlayerHit(view.player) || fire.checkPlayerHit(movingPlayer)) {
+            return true;
+        }
+    }
+    return false;
+}
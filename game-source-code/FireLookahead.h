@@ -0,0 +1,65 @@
+#ifndef FIRELOOKAHEAD_H
+#define FIRELOOKAHEAD_H
+
+#include "LocalWorldView.h"
+#include "GameConstants.h"
+
+/**
+ * @file FireLookahead.h
+ * @brief Bounded forward simulation deciding when dragons breathe fire
+ */
+
+/**
+ * @class FireLookahead
+ * @brief Fires only when a simulated fireball is predicted to hit
+ *
+ * For each candidate direction a FireProjectile is cloned and stepped
+ * tick by tick through a LocalWorldView (earth stops it), against two
+ * player predictions: standing still, and keeping their current heading
+ * at their move rate. The direction is used if either prediction is hit
+ * before the fireball burns out.
+ *
+ * Budget:
+ * - Every simulated tick costs one step; the pool is refilled by
+ *   beginTick() each simulation tick
+ * - A search that runs out of budget reports "no hit", so the dragon
+ *   simply tries again next tick
+ * - The budget is counted in steps, not wall time, so decisions stay
+ *   identical in replays and rollback re-simulation
+ */
+class FireLookahead {
+public:
+    static const int MAX_TICKS = 150; ///< Search depth (longer than a fireball lives)
+
+    explicit FireLookahead(int stepsPerTick = GameConstants::FIRE_SEARCH_STEPS_PER_TICK);
+
+    /**
+     * @brief Refill the step budget (call once per simulation tick)
+     */
+    void beginTick();
+
+    /**
+     * @brief Pick a fire direction that is predicted to hit
+     * @param view World around the dragon
+     * @param dragon Dragon cell (fireball start)
+     * @param tickSeconds Simulation step
+     * @return Direction Hitting direction, or NONE (don't fire)
+     * @note Only directions toward the player are searched, main axis first
+     */
+    Direction chooseDirection(const LocalWorldView& view, Coordinate dragon, float tickSeconds);
+
+    /**
+     * @brief Simulate one fireball against the predicted player
+     * @return true if it reaches the player before dying
+     */
+    bool predictsHit(const LocalWorldView& view, Coordinate from, Direction direction, 
+                     float tickSeconds);
+
+    int getStepsLeft() const { return stepsLeft; }
+
+private:
+    int stepsPerTick;
+    int stepsLeft;
+};
+
+#endif // FIRELOOKAHEAD_H
@@ -3,8 +3,11 @@
 
 #include "GameObject.h"
 #include "Coordinate.h"
-#include "EnemyLogic.h"
+#include "Direction.h"
 #include "GameConstants.h"
+#include "GameClock.h"
+#include "StateSerializer.h"
+#include "FixedRing.h"
 
 /**
  * @file FireProjectile.h
@@ -19,23 +22,28 @@
  * - Travels in straight line (UP/DOWN/LEFT/RIGHT)
  * - Maintains visual trail of recent positions
  * - Damages player on contact
- * - Self-destructs after 2 seconds or hitting boundary
+ * - Self-destructs after 2 seconds, at the boundary or on solid earth
  * 
  * Technical details:
- * - Speed: 3 cells per second
+ * - Speed: 3 cells per second, timed per projectile with sub-cell progress
  * - Lifetime: 2 seconds maximum
- * - Trail length: 5 positions
+ * - Trail length: 5 positions (inline ring, no allocation)
  * - Direction: Set on creation, doesn't change
  * 
  * @note Only GREEN_DRAGON enemies can create FireProjectiles
  */
 class FireProjectile : public GameObject, public Collidable {
+public:
+    static const int TRAIL_LENGTH = 5;
+    using Trail = FixedRing<Coordinate, TRAIL_LENGTH>;
+
 private:
     Direction direction;
     float speed;
     float lifetime;
     float maxLifetime;
-    std::vector<Coordinate> trail;
+    float moveTimer;
+    Trail trail;
     
 public:
     /**
@@ -45,50 +53,63 @@ public:
      */
     FireProjectile(Coordinate startPos, Direction dir) 
         : GameObject(startPos), direction(dir), speed(3.0f), 
-          lifetime(2.0f), maxLifetime(2.0f) {
-        trail.push_back(startPos);
+          lifetime(2.0f), maxLifetime(2.0f), moveTimer(0.0f) {
+        trail.push(startPos);
     }
     
     /**
      * @brief Update projectile position and lifetime
+     * @note Steps by this tick's GameClock::frameTime()
      */
     void update() override {
+        advance(GameClock::frameTime());
+    }
+    
+    /**
+     * @brief Advance flight by a time step
+     * @param deltaTime Seconds to simulate
+     * 
+     * Timing is per projectile: moveTimer carries the remainder past a
+     * cell step, so the cells-per-second rate holds for any step size
+     * and does not depend on how many other projectiles exist.
+     */
+    void advance(float deltaTime) {
+        advance(deltaTime, [](Coordinate) { return false; });
+    }
+    
+    /**
+     * @brief Advance flight, burning out on cells the predicate blocks
+     * @param deltaTime Seconds to simulate
+     * @param isBlocked Callable (Coordinate) -> bool, true for solid earth
+     * @note Templated so the live grid and the lookahead's small terrain
+     *       window (LocalWorldView) share the same flight code
+     */
+    template <typename BlockedFn>
+    void advance(float deltaTime, BlockedFn&& isBlocked) {
         if (!active) return;
         
-        lifetime -= GetFrameTime();
+        lifetime -= deltaTime;
         if (lifetime <= 0.0f) {
             setActive(false);
             return;
         }
         
-        static float moveTimer = 0.0f;
-        moveTimer += GetFrameTime();
+        if (direction == Direction::NONE) return;
         
-        if (moveTimer >= (1.0f / speed)) {
-            Coordinate offset;
-            switch (direction) {
-                case Direction::UP:    offset = Coordinate(-1, 0); break;
-                case Direction::DOWN:  offset = Coordinate(1, 0); break;
-                case Direction::LEFT:  offset = Coordinate(0, -1); break;
-                case Direction::RIGHT: offset = Coordinate(0, 1); break;
-                case Direction::NONE:  return;
-            }
-            
-            Coordinate newPos = position + offset;
+        float stepInterval = 1.0f / speed;
+        moveTimer += deltaTime;
+        
+        while (moveTimer >= stepInterval) {
+            Coordinate newPos = position + directionOffset(direction);
             
-            if (!newPos.isWithinBounds()) {
+            if (!newPos.isWithinBounds() || isBlocked(newPos)) {
                 setActive(false);
                 return;
             }
             
             position = newPos;
-            trail.push_back(newPos);
-            
-            if (trail.size() > 5) {
-                trail.erase(trail.begin());
-            }
-            
-            moveTimer = 0.0f;
+            trail.push(newPos);
+            moveTimer -= stepInterval;
         }
     }
     
@@ -109,7 +130,7 @@ public:
         return direction;
     }
     
-    const std::vector<Coordinate>& getTrail() const {
+    const Trail& getTrail() const {
         return trail;
     }
     
@@ -117,6 +138,15 @@ public:
         return lifetime / maxLifetime;
     }
     
+    /**
+     * @brief Fraction of the way to the next cell (0.0-1.0)
+     * @note Render position = cell + directionOffset × progress
+     */
+    float getMoveProgress() const {
+        float progress = moveTimer * speed;
+        return progress < 0.0f ? 0.0f : (progress > 1.0f ? 1.0f : progress);
+    }
+    
     /**
      * @brief Check if fire hit player position
      * @param playerPos Player coordinate to check
@@ -126,6 +156,45 @@ public:
         if (!active) return false;
         return position == playerPos;
     }
+    
+    /**
+     * @brief Write projectile flight state and trail to a state snapshot
+     * @param writer Destination
+     */
+    void serialize(StateWriter& writer) const {
+        writer.write(position);
+        writer.write(active);
+        writer.write(direction);
+        writer.write(speed);
+        writer.write(lifetime);
+        writer.write(maxLifetime);
+        writer.write(moveTimer);
+        writer.write(static_cast<std::uint32_t>(trail.size()));
+        for (std::size_t i = 0; i < trail.size(); ++i) {
+            writer.write(trail[i]);
+        }
+    }
+    
+    /**
+     * @brief Restore state written by serialize()
+     * @param reader Source
+     */
+    void deserialize(StateReader& reader) {
+        reader.readPosition(position);
+        reader.read(active);
+        reader.readEnum(direction, Direction::NONE);
+        reader.read(speed);
+        reader.read(lifetime);
+        reader.read(maxLifetime);
+        reader.read(moveTimer);
+        trail.clear();
+        std::uint32_t trailCount = reader.readCount(TRAIL_LENGTH);
+        for (std::uint32_t i = 0; i < trailCount; ++i) {
+            Coordinate cell;
+            reader.readPosition(cell);
+            trail.push(cell);
+        }
+    }
 };
 
 #endif // FIREPROJECTILE_H
@@ -0,0 +1,60 @@
+#ifndef FIXEDRING_H
+#define FIXEDRING_H
+
+#include <cstddef>
+
+/**
+ * @file FixedRing.h
+ * @brief Small inline ring buffer keeping the most recent N values
+ */
+
+/**
+ * @class FixedRing
+ * @brief Keeps the last Capacity pushed values with no allocation
+ *
+ * Used for short histories such as projectile trails. push() overwrites
+ * the oldest value once full, so keeping "the last 5 positions" is O(1)
+ * instead of erase(begin()) on a vector. Index 0 is the oldest value.
+ *
+ * @tparam T Element type (trivially copyable)
+ * @tparam Capacity Values kept
+ */
+template <typename T, std::size_t Capacity>
+class FixedRing {
+private:
+    T items[Capacity]{};
+    std::size_t head = 0;  ///< Slot of the oldest value
+    std::size_t count = 0;
+
+public:
+    void push(const T& value) {
+        if (count < Capacity) {
+            items[(head + count) % Capacity] = value;
+            count++;
+        } else {
+            items[head] = value;
+            head = (head + 1) % Capacity;
+        }
+    }
+
+    void clear() {
+        head = 0;
+        count = 0;
+    }
+
+    /**
+     * @brief Value by age
+     * @param index 0 = oldest, size() - 1 = newest
+     */
+    const T& operator[](std::size_t index) const {
+        return items[(head + index) % Capacity];
+    }
+
+    const T& back() const { return (*this)[count - 1]; }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    static constexpr std::size_t capacity() { return Capacity; }
+};
+
+#endif // FIXEDRING_H
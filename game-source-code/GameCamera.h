@@ -0,0 +1,155 @@
+#ifndef GAMECAMERA_H
+#define GAMECAMERA_H
+
+#include <raylib-cpp.hpp>
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @file GameCamera.h
+ * @brief Scrolling 2D camera and view-rectangle culling
+ */
+
+/**
+ * @struct CellRange
+ * @brief Half-open block of grid cells [firstRow, endRow) x [firstCol, endCol)
+ */
+struct CellRange {
+    int firstRow;
+    int endRow;
+    int firstCol;
+    int endCol;
+
+    int cellCount() const {
+        return std::max(0, endRow - firstRow) * std::max(0, endCol - firstCol);
+    }
+};
+
+/**
+ * @class GameCamera
+ * @brief Camera2D that follows a point and answers "is this on screen?"
+ *
+ * All positions are world pixels (grid cell * cell size). The camera's
+ * target is the top-left world pixel of the view, so the view rectangle
+ * is simply {target, view size / zoom}.
+ *
+ * Behaviour:
+ * - follow() eases the view toward centring a focus point (frame-rate
+ *   independent exponential smoothing)
+ * - The view is clamped to the world, so a world no larger than the
+ *   screen never scrolls
+ * - snapTo() jumps straight there (level start, respawn)
+ * - Screen shake is applied as the camera's screen offset, because
+ *   BeginMode2D() replaces any matrix pushed before it
+ *
+ * Culling:
+ * - visibleCells() gives the cell block to draw, so terrain cost depends
+ *   on the view, not on the world size
+ * - isVisible() tests an entity's bounding circle against the view
+ *
+ * @note The world size is fixed at construction. The game's grid is the
+ *       compile-time WORLD_COLS x WORLD_ROWS, which is exactly the window,
+ *       so in the game the view does not scroll
+ */
+class GameCamera {
+private:
+    Camera2D camera;
+    float viewWidth;
+    float viewHeight;
+    float worldWidth;
+    float worldHeight;
+    float followRate;   ///< Smoothing rate (1/seconds); higher = tighter
+
+public:
+    /**
+     * @param viewW Screen width in pixels
+     * @param viewH Screen height in pixels
+     * @param worldW World width in pixels
+     * @param worldH World height in pixels
+     */
+    GameCamera(int viewW, int viewH, int worldW, int worldH)
+        : camera{}, viewWidth(static_cast<float>(viewW)),
+          viewHeight(static_cast<float>(viewH)),
+          worldWidth(static_cast<float>(worldW)),
+          worldHeight(static_cast<float>(worldH)), followRate(8.0f) {
+        camera.zoom = 1.0f;
+    }
+
+    /**
+     * @brief Ease the view toward centring a point
+     * @param focus World pixel to keep in view (usually the player)
+     * @param deltaTime Frame time in seconds
+     */
+    void follow(Vector2 focus, float deltaTime) {
+        Vector2 goal = clampedTarget(focus);
+        float blend = 1.0f - std::exp(-followRate * deltaTime);
+        camera.target.x += (goal.x - camera.target.x) * blend;
+        camera.target.y += (goal.y - camera.target.y) * blend;
+    }
+
+    /**
+     * @brief Centre on a point immediately
+     */
+    void snapTo(Vector2 focus) {
+        camera.target = clampedTarget(focus);
+    }
+
+    /**
+     * @brief Offset the rendered view on screen (screen shake)
+     */
+    void setShake(Vector2 offset) {
+        camera.offset = offset;
+    }
+
+    const Camera2D& getCamera2D() const { return camera; }
+
+    /**
+     * @brief World-pixel rectangle currently on screen
+     */
+    Rectangle getViewRect() const {
+        return Rectangle{camera.target.x, camera.target.y, visibleWidth(), visibleHeight()};
+    }
+
+    /**
+     * @brief Check whether a circle overlaps the view
+     * @param center World pixel centre
+     * @param radius Extent in pixels (include glow/rings)
+     */
+    bool isVisible(Vector2 center, float radius) const {
+        Rectangle view = getViewRect();
+        return center.x + radius >= view.x && center.x - radius <= view.x + view.width &&
+               center.y + radius >= view.y && center.y - radius <= view.y + view.height;
+    }
+
+    /**
+     * @brief Grid cells touching the view, clamped to the grid
+     * @param cellSize Cell size in pixels
+     * @param rows Grid rows
+     * @param cols Grid columns
+     */
+    CellRange visibleCells(int cellSize, int rows, int cols) const {
+        Rectangle view = getViewRect();
+        float size = static_cast<float>(cellSize);
+        CellRange range;
+        range.firstRow = std::max(0, static_cast<int>(std::floor(view.y / size)));
+        range.firstCol = std::max(0, static_cast<int>(std::floor(view.x / size)));
+        range.endRow = std::min(rows, static_cast<int>(std::ceil((view.y + view.height) / size)));
+        range.endCol = std::min(cols, static_cast<int>(std::ceil((view.x + view.width) / size)));
+        return range;
+    }
+
+private:
+    float visibleWidth() const { return viewWidth / camera.zoom; }
+    float visibleHeight() const { return viewHeight / camera.zoom; }
+
+    Vector2 clampedTarget(Vector2 focus) const {
+        float maxX = std::max(0.0f, worldWidth - visibleWidth());
+        float maxY = std::max(0.0f, worldHeight - visibleHeight());
+        return Vector2{
+            std::clamp(focus.x - visibleWidth() / 2.0f, 0.0f, maxX),
+            std::clamp(focus.y - visibleHeight() / 2.0f, 0.0f, maxY)
+        };
+    }
+};
+
+#endif // GAMECAMERA_H
@@ -0,0 +1,100 @@
+#ifndef GAMECLOCK_H
+#define GAMECLOCK_H
+
+#include <raylib-cpp.hpp>
+
+/**
+ * @file GameClock.h
+ * @brief Simulation time source shared by all gameplay classes
+ */
+
+/**
+ * @class GameClock
+ * @brief Per-thread simulation clock (real time or fixed step)
+ *
+ * Gameplay code asks GameClock for "now" and "frame time" instead of
+ * calling raylib's GetTime()/GetFrameTime() directly. This lets the
+ * simulation run on its own thread at a fixed tick rate while the
+ * render loop runs at display rate.
+ *
+ * Modes:
+ * - Real time (default): forwards to GetTime()/GetFrameTime()
+ * - Fixed step: time only moves when advance() is called, each tick
+ *   lasting exactly the configured step
+ *
+ * State is thread_local, so a simulation thread can run fixed step
+ * while the render thread keeps real time for animations.
+ *
+ * @note Rendering-only effects (pulses, particles) keep using raylib time
+ */
+class GameClock {
+private:
+    struct State {
+        bool fixedStep = false;
+        double time = 0.0;
+        float step = 1.0f / 60.0f;
+    };
+
+    static State& state() {
+        thread_local State clockState;
+        return clockState;
+    }
+
+public:
+    /**
+     * @brief Get current simulation time in seconds
+     */
+    static double now() {
+        const State& s = state();
+        return s.fixedStep ? s.time : GetTime();
+    }
+
+    /**
+     * @brief Get duration of the current simulation tick in seconds
+     */
+    static float frameTime() {
+        const State& s = state();
+        return s.fixedStep ? s.step : GetFrameTime();
+    }
+
+    /**
+     * @brief Switch calling thread to fixed-step time
+     * @param step Tick duration in seconds
+     * @param startTime Initial simulation time
+     */
+    static void setFixedStep(float step, double startTime = 0.0) {
+        State& s = state();
+        s.fixedStep = true;
+        s.step = step;
+        s.time = startTime;
+    }
+
+    /**
+     * @brief Switch calling thread back to raylib real time
+     */
+    static void useRealTime() {
+        state().fixedStep = false;
+    }
+
+    /**
+     * @brief Advance fixed-step time by one tick (no-op in real time)
+     */
+    static void advance() {
+        State& s = state();
+        if (s.fixedStep) {
+            s.time += s.step;
+        }
+    }
+
+    /**
+     * @brief Overwrite fixed-step time (e.g. when restoring a save)
+     * @param time New simulation time in seconds
+     */
+    static void setTime(double time) {
+        state().time = time;
+    }
+
+    static bool isFixedStep() { return state().fixedStep; }
+};
+
+#endif // GAMECLOCK_H
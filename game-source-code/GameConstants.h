@@ -17,6 +17,7 @@
  * 
  * Categories:
  * - Screen and rendering: Display dimensions, cell size
+ * - Simulation timing: Fixed tick rate
  * - Player mechanics: Movement speeds, cooldowns
  * - Weapon system: Harpoon timing and range
  * - Enemy behavior: AI timing intervals
@@ -37,22 +38,33 @@ namespace GameConstants {
     const int SCREEN_WIDTH = 1200;   ///< Window width in pixels
     const int SCREEN_HEIGHT = 800;   ///< Window height in pixels
     const int CELL_SIZE = 40;        ///< Grid cell size (40×40 pixels)
+    const int RENDER_TARGET_FPS = 240; ///< Display frame rate cap
+    
+    // Simulation timing
+    const int SIMULATION_TICK_RATE = 60; ///< Fixed simulation ticks per second
+    const float SIMULATION_TICK = 1.0f / SIMULATION_TICK_RATE; ///< Tick length (seconds)
+    const float MAX_FRAME_CATCHUP = 0.25f; ///< Longest stall simulated after a hitch
+    const int ROLLBACK_WINDOW_TICKS = 16;  ///< Ticks of history kept for input correction
     
     // Player mechanics
     const float BASE_MOVE_COOLDOWN = 0.12f;  ///< Base time between moves (seconds)
     const float FAST_MOVE_COOLDOWN = 0.08f;  ///< Speedup after consecutive moves
     const float DIG_EFFECT_DURATION = 0.3f;  ///< Dig animation duration (seconds)
     const int CONSECUTIVE_MOVES_FOR_SPEEDUP = 4; ///< Moves needed for speed boost
+    const float INPUT_BUFFER_WINDOW = 0.25f; ///< Buffered direction taps expire after (seconds)
     
     // Weapon system
     const float HARPOON_COOLDOWN_TIME = 0.8f;  ///< Normal harpoon cooldown (seconds)
     const float HARPOON_SPEED = 5.0f;          ///< Harpoon extension speed (cells/sec)
     const float HARPOON_MAX_RANGE = 4.0f;      ///< Maximum harpoon reach (cells)
     const float RAPID_FIRE_COOLDOWN = 0.25f;   ///< Rapid fire cooldown (seconds)
+    const int MAX_ACTIVE_HARPOONS = 16;        ///< Harpoon pool size (extra shots are dropped)
+    const int MAX_ACTIVE_FIRES = 32;           ///< Fire projectile pool size
     
     // Enemy behavior
     const float ENEMY_STUN_DURATION = 0.5f;       ///< Stun time after damage (seconds)
     const float ENEMY_MOVE_CHECK_INTERVAL = 0.1f; ///< AI decision frequency (seconds)
+    const int FIRE_SEARCH_STEPS_PER_TICK = 1024;  ///< Dragon fire lookahead budget (simulated steps)
     
     // Rock physics
     const float ROCK_FALL_SPEED = 0.18f;            ///< Time per cell fall (seconds)
@@ -70,6 +82,7 @@ namespace GameConstants {
     const int BASE_TARGET_SCORE = 1000;  ///< Initial target score
     const float MAX_LEVEL_TIME = 180.0f; ///< Maximum level time (3 minutes)
     const int MAX_LEVELS = 10;           ///< Total levels in game
+    const unsigned long long PROCEDURAL_LEVEL_SEED = 0xD16D06ull; ///< Base seed for generated levels
 }
 
 #endif // GAMECONSTANTS_H
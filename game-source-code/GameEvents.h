@@ -0,0 +1,119 @@
+#ifndef GAMEEVENTS_H
+#define GAMEEVENTS_H
+
+#include "Coordinate.h"
+#include <array>
+
+/**
+ * @file GameEvents.h
+ * @brief Typed gameplay event queue between simulation and presentation
+ */
+
+/**
+ * @enum GameEventType
+ * @brief Gameplay moments that presentation systems react to
+ */
+enum class GameEventType {
+    ENEMY_DESTROYED,   ///< Enemy popped by harpoon or crushed by rock
+    ROCK_LANDED,       ///< Falling rock came to rest
+    PLAYER_HIT,        ///< Player caught by enemy or crushed
+    PLAYER_BURNED,     ///< Player hit by dragon fire
+    POWERUP_COLLECTED, ///< Player picked up a power-up
+    DIG,               ///< Player is digging (value = 1 on a freshly cut cell)
+    FIRE_BREATHED,     ///< GREEN_DRAGON launched a fireball
+    HARPOON_FIRED,     ///< Player fired a harpoon
+    LEVEL_COMPLETED    ///< Level objectives achieved
+};
+
+/**
+ * @struct GameEvent
+ * @brief Single gameplay event with grid position and small payload
+ */
+struct GameEvent {
+    GameEventType type;  ///< What happened
+    Coordinate position; ///< Grid cell where it happened
+    int value;           ///< Event-specific payload (0 if unused)
+};
+
+/**
+ * @class GameEventQueue
+ * @brief Fixed-capacity, allocation-free event queue
+ *
+ * Simulation systems append events while they update; presentation
+ * systems (particles, screen shake, sound) drain the whole batch once
+ * per frame. The queue never allocates: events beyond capacity are
+ * dropped and counted.
+ *
+ * Usage pattern:
+ * 1. Simulation: events.push(GameEventType::ROCK_LANDED, pos);
+ * 2. Presentation: iterate events once per frame
+ * 3. Call clear() after the batch has been consumed
+ *
+ * Headless runs call setEnabled(false) so push() is a single branch
+ * and no presentation work is ever queued.
+ *
+ * @note Simulation code never references raylib drawing through this queue
+ */
+class GameEventQueue {
+public:
+    static const int CAPACITY = 128; ///< Maximum events per frame
+
+private:
+    std::array<GameEvent, CAPACITY> events;
+    int count;
+    int dropped;
+    bool enabled;
+
+public:
+    GameEventQueue() : count(0), dropped(0), enabled(true) {}
+
+    /**
+     * @brief Append event to current frame's batch
+     * @param type Event type
+     * @param position Grid cell of the event
+     * @param value Optional payload
+     * @note Dropped (and counted) when queue is full or disabled
+     */
+    void push(GameEventType type, Coordinate position, int value = 0) {
+        if (!enabled) return;
+        if (count >= CAPACITY) {
+            dropped++;
+            return;
+        }
+        events[count++] = GameEvent{type, position, value};
+    }
+
+    const GameEvent* begin() const { return events.data(); }
+    const GameEvent* end() const { return events.data() + count; }
+
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    /**
+     * @brief Discard current batch after it was consumed
+     */
+    void clear() {
+        count = 0;
+    }
+
+    /**
+     * @brief Enable or disable event recording
+     * @param enable false for headless runs
+     */
+    void setEnabled(bool enable) {
+        enabled = enable;
+        if (!enabled) {
+            count = 0;
+        }
+    }
+
+    bool isEnabled() const { return enabled; }
+
+    /**
+     * @brief Get number of events lost to overflow
+     * @return int Dropped event count since construction
+     */
+    int getDroppedCount() const { return dropped; }
+};
+
+#endif // GAMEEVENTS_H
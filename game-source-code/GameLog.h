@@ -0,0 +1,41 @@
+#ifndef GAMELOG_H
+#define GAMELOG_H
+
+#include <iostream>
+
+/**
+ * @file GameLog.h
+ * @brief Console logging for gameplay code with a per-thread mute
+ */
+
+/**
+ * @class GameLog
+ * @brief Routes gameplay messages to std::cout unless muted
+ *
+ * Level setup and power-up messages are useful while playing but are
+ * pure noise from headless simulations (level evaluation rollouts,
+ * tests). Muting is per-thread so a worker can run quietly while the
+ * game thread keeps logging.
+ */
+class GameLog {
+private:
+    static bool& quietFlag() {
+        thread_local bool quiet = false;
+        return quiet;
+    }
+
+public:
+    static void setQuiet(bool quiet) { quietFlag() = quiet; }
+    static bool isQuiet() { return quietFlag(); }
+
+    /**
+     * @brief Stream for an informational message
+     * @return std::cout, or a discarding stream when muted
+     */
+    static std::ostream& info() {
+        thread_local std::ostream discard(nullptr);
+        return isQuiet() ? discard : std::cout;
+    }
+};
+
+#endif // GAMELOG_H
@@ -0,0 +1,68 @@
+#ifndef GAMERANDOM_H
+#define GAMERANDOM_H
+
+#include <cstdint>
+#include <ctime>
+
+/**
+ * @file GameRandom.h
+ * @brief Seedable random source for gameplay code
+ */
+
+/**
+ * @class GameRandom
+ * @brief Per-thread xorshift64* generator replacing std::rand in gameplay
+ *
+ * std::rand has hidden global state that cannot be saved, restored or
+ * isolated per simulation. GameRandom keeps a single 64-bit state per
+ * thread, so:
+ * - A state snapshot can include it (identical replay after restore)
+ * - Parallel headless simulations on worker threads don't interfere
+ * - Tests can seed() for deterministic levels
+ *
+ * Default seed is time-based (same behaviour as the old srand(time)).
+ *
+ * @note Presentation effects (particles, shake) keep using rand()
+ */
+class GameRandom {
+private:
+    static std::uint64_t& state() {
+        thread_local std::uint64_t randomState = 
+            static_cast<std::uint64_t>(std::time(nullptr)) * 0x9E3779B97F4A7C15ull + 1;
+        return randomState;
+    }
+
+public:
+    /**
+     * @brief Reset generator to a known seed
+     * @param value Seed (0 is remapped, xorshift needs non-zero state)
+     */
+    static void seed(std::uint64_t value) {
+        state() = value != 0 ? value : 0x9E3779B97F4A7C15ull;
+    }
+
+    static std::uint64_t getState() { return state(); }
+    static void setState(std::uint64_t value) { seed(value); }
+
+    /**
+     * @brief Next raw 32-bit value
+     */
+    static std::uint32_t next() {
+        std::uint64_t& s = state();
+        s ^= s >> 12;
+        s ^= s << 25;
+        s ^= s >> 27;
+        return static_cast<std::uint32_t>((s * 0x2545F4914F6CDD1Dull) >> 32);
+    }
+
+    /**
+     * @brief Uniform-ish integer in [0, bound)
+     * @param bound Exclusive upper bound (must be > 0)
+     * @note Drop-in replacement for std::rand() % bound
+     */
+    static int nextInt(int bound) {
+        return static_cast<int>(next() % static_cast<std::uint32_t>(bound));
+    }
+};
+
+#endif // GAMERANDOM_H
@@ -0,0 +1,741 @@
+#include "GameSimulation.h"
+#include "GameClock.h"
+#include "GameRandom.h"
+#include "StateSerializer.h"
+#include "GameConstants.h"
+#include "LevelEvaluator.h"
+#include "ProjectileSystem.h"
+#include "LocalWorldView.h"
+#include "GameTuning.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+using namespace GameConstants;
+
+GameSimulation::GameSimulation(bool generateLevels)
+    : player(Coordinate(Coordinate::PLAYABLE_START_ROW, 1)),
+      score(0), enemiesDefeated(0), playerLives(STARTING_LIVES),
+      lastHarpoonTime(0.0f), levelTimer(0.0f), lastTunnelCount(0),
+      tick(0), levelEpoch(0), quitRequested(false),
+      proceduralLevels(generateLevels), pendingLevel(0), cachedLevel(0) {
+    chargeInlineStorage(1);
+    initializeNewGame();
+}
+
+GameSimulation::~GameSimulation() {
+    chargeInlineStorage(-1);
+}
+
+void GameSimulation::chargeInlineStorage(int sign) {
+    // In-place storage of this simulation; heap use is tracked per allocation
+    MemoryTracker::addInlineBytes(MemoryTag::TERRAIN, sign * static_cast<std::int64_t>(sizeof(terrain)));
+    MemoryTracker::addInlineBytes(MemoryTag::ENEMIES, sign * static_cast<std::int64_t>(
+        sizeof(pathfinder) + sizeof(pathCache) + sizeof(aiScheduler) +
+        sizeof(reservations) + sizeof(fireSearch)));
+    MemoryTracker::addInlineBytes(MemoryTag::PROJECTILES, sign * static_cast<std::int64_t>(
+        sizeof(harpoons) + sizeof(fireProjectiles)));
+}
+
+void GameSimulation::startTrial(int level, const LevelLayout& layout) {
+    levelManager.reset();
+    while (levelManager.getCurrentLevel() < level) {
+        levelManager.nextLevel();
+    }
+    powerUpManager.reset();
+    score = 0;
+    playerLives = STARTING_LIVES;
+    enemiesDefeated = 0;
+    lastHarpoonTime = 0.0f;
+    stateManager.changeState(GameState::PLAYING);
+    loadLevel(&layout);
+}
+
+void GameSimulation::prepareLevelAhead(int level) {
+    if (!proceduralLevels || level > MAX_LEVELS || levelManager.hasMapFile(level) ||
+        cachedLevel == level || (pendingLevel == level && pendingLayout.valid())) {
+        return;
+    }
+    pendingLevel = level;
+    pendingLayout = std::async(std::launch::async, [level]() {
+        return LevelEvaluator::selectBest(level, levelSeed(level));
+    });
+}
+
+bool GameSimulation::isLevelLayoutReady(int level) const {
+    if (cachedLevel == level) {
+        return true;
+    }
+    return pendingLevel == level && pendingLayout.valid() &&
+           pendingLayout.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void GameSimulation::step(const InputFrame& input) {
+    float deltaTime = GameClock::frameTime();
+    inputManager.setFrame(input);
+    
+    switch (stateManager.getCurrentState()) {
+        case GameState::MENU:
+            handleMenuState();
+            break;
+        case GameState::PLAYING:
+            updateGameplay(deltaTime);
+            break;
+        case GameState::PAUSED:
+            handlePauseState();
+            break;
+        case GameState::GAME_OVER:
+        case GameState::LEVEL_COMPLETE:
+        case GameState::VICTORY:
+            handleEndGameState();
+            break;
+        default:
+            break;
+    }
+    
+    stateManager.update(deltaTime);
+    pathCache.sync(terrain);  // Saved states only carry a cache that matches the terrain
+    tick++;
+    GameClock::advance();
+}
+
+void GameSimulation::saveState(std::vector<unsigned char>& out) const {
+    out.clear();
+    StateWriter writer(out);
+    writer.writeHeader();
+    
+    writer.write(GameClock::now());
+    writer.write(GameRandom::getState());
+    writer.write(tick);
+    writer.write(levelEpoch);
+    writer.write(score);
+    writer.write(enemiesDefeated);
+    writer.write(playerLives);
+    writer.write(lastHarpoonTime);
+    writer.write(levelTimer);
+    writer.write(lastTunnelCount);
+    
+    levelManager.serialize(writer);
+    powerUpManager.serialize(writer);
+    stateManager.serialize(writer);
+    terrain.serialize(writer);
+    player.serialize(writer);
+    
+    writer.write(static_cast<std::uint32_t>(enemies.size()));
+    for (const auto& enemy : enemies) enemy.serialize(writer);
+    aiScheduler.serialize(writer);
+    pathCache.serialize(writer, terrain);
+    writer.write(static_cast<std::uint32_t>(harpoons.size()));
+    for (const auto& harpoon : harpoons) harpoon.serialize(writer);
+    writer.write(static_cast<std::uint32_t>(powerUps.size()));
+    for (const auto& powerUp : powerUps) powerUp.serialize(writer);
+    writer.write(static_cast<std::uint32_t>(rocks.size()));
+    for (const auto& rock : rocks) rock.serialize(writer);
+    writer.write(static_cast<std::uint32_t>(fireProjectiles.size()));
+    for (const auto& fire : fireProjectiles) fire.serialize(writer);
+}
+
+bool GameSimulation::restoreState(const unsigned char* bytes, std::size_t size) {
+    const std::uint32_t MAX_ENTITIES = 1024;
+    StateReader reader(bytes, size);
+    if (!reader.readHeader()) {
+        return false;
+    }
+    
+    // Decode into temporaries first so bad data leaves the game untouched
+    double clockTime = reader.read<double>();
+    std::uint64_t randomState = reader.read<std::uint64_t>();
+    unsigned int newTick = reader.read<unsigned int>();
+    unsigned int newEpoch = reader.read<unsigned int>();
+    int newScore = reader.read<int>();
+    int newDefeated = reader.read<int>();
+    int newLives = reader.read<int>();
+    float newHarpoonTime = reader.read<float>();
+    float newLevelTimer = reader.read<float>();
+    int newTunnelCount = reader.read<int>();
+    
+    LevelManager newLevelManager;
+    PowerUpManager newPowerUpManager;
+    GameStateManager newStateManager;
+    BlockGrid newTerrain = terrain;
+    Player newPlayer;
+    newLevelManager.deserialize(reader);
+    newPowerUpManager.deserialize(reader);
+    newStateManager.deserialize(reader);
+    newTerrain.deserialize(reader);
+    newPlayer.deserialize(reader);
+    
+    std::vector<Enemy> newEnemies(reader.readCount(MAX_ENTITIES), 
+                                  Enemy(Coordinate(), EnemyType::RED_MONSTER));
+    for (auto& enemy : newEnemies) enemy.deserialize(reader);
+    AIScheduler newScheduler(aiScheduler.getSettings());
+    newScheduler.deserialize(reader);
+    PathCache newPathCache;
+    newPathCache.deserialize(reader);
+    
+    HarpoonPool newHarpoons;
+    std::uint32_t harpoonCount = reader.readCount(HarpoonPool::capacity());
+    for (std::uint32_t i = 0; i < harpoonCount; ++i) {
+        newHarpoons.emplace(Coordinate(), Direction::NONE, nullptr)->deserialize(reader, &player);
+    }
+    
+    std::vector<PowerUp> newPowerUps(reader.readCount(MAX_ENTITIES), 
+                                     PowerUp(Coordinate(), PowerUpType::EXTRA_LIFE));
+    for (auto& powerUp : newPowerUps) powerUp.deserialize(reader);
+    
+    std::vector<Rock> newRocks(reader.readCount(MAX_ENTITIES), Rock(Coordinate()));
+    for (auto& rock : newRocks) rock.deserialize(reader);
+    
+    FirePool newFires;
+    std::uint32_t fireCount = reader.readCount(FirePool::capacity());
+    for (std::uint32_t i = 0; i < fireCount; ++i) {
+        newFires.emplace(Coordinate(), Direction::NONE)->deserialize(reader);
+    }
+    
+    if (!reader.isValid()) {
+        return false;
+    }
+    
+    tick = newTick;
+    levelEpoch = newEpoch;
+    score = newScore;
+    enemiesDefeated = newDefeated;
+    playerLives = newLives;
+    lastHarpoonTime = newHarpoonTime;
+    levelTimer = newLevelTimer;
+    lastTunnelCount = newTunnelCount;
+    levelManager = newLevelManager;
+    Player* powerUpTarget = powerUpManager.getPlayerReference();
+    powerUpManager = newPowerUpManager;
+    powerUpManager.setPlayerReference(powerUpTarget);
+    stateManager = newStateManager;
+    terrain = newTerrain;
+    pathCache = newPathCache;
+    pathCache.adopt(terrain);
+    player = newPlayer;
+    enemies.swap(newEnemies);
+    aiScheduler = newScheduler;
+    harpoons = newHarpoons;
+    powerUps.swap(newPowerUps);
+    rocks.swap(newRocks);
+    fireProjectiles = newFires;
+    events.clear();
+    quitRequested = false;
+    
+    if (GameClock::isFixedStep()) {
+        GameClock::setTime(clockTime);
+    }
+    GameRandom::setState(randomState);
+    return true;
+}
+
+void GameSimulation::captureSnapshot(RenderSnapshot& out) const {
+    out.tick = tick;
+    out.levelEpoch = levelEpoch;
+    out.simTime = GameClock::now();
+    out.state = stateManager.getCurrentState();
+    
+    if (!out.terrainValid || out.terrainGeneration != terrain.getGeneration()) {
+        for (int row = 0; row < Coordinate::WORLD_ROWS; ++row) {
+            for (int col = 0; col < Coordinate::WORLD_COLS; ++col) {
+                out.blocked[row][col] = terrain.isLocationBlocked(Coordinate(row, col));
+            }
+        }
+        out.terrainGeneration = terrain.getGeneration();
+        out.terrainValid = true;
+    }
+    
+    out.player.position = player.getPosition();
+    out.player.digging = player.getIsDigging();
+    out.player.speedBoost = powerUpManager.hasPowerUpEffect(PowerUpType::SPEED_BOOST);
+    
+    out.enemyCount = 0;
+    for (const auto& enemy : enemies) {
+        if (out.enemyCount >= RenderSnapshot::MAX_ENEMIES) break;
+        RenderSnapshot::EnemyView& view = out.enemies[out.enemyCount++];
+        view.position = enemy.getPosition();
+        view.type = enemy.getEnemyType();
+        view.active = enemy.isActive();
+        view.destroyed = enemy.getIsDestroyed();
+        view.phasing = enemy.getIsPhasing();
+        view.destroyProgress = enemy.getDestroyProgress();
+    }
+    
+    out.rockCount = 0;
+    for (const auto& rock : rocks) {
+        if (out.rockCount >= RenderSnapshot::MAX_ROCKS) break;
+        RenderSnapshot::RockView& view = out.rocks[out.rockCount++];
+        view.position = rock.getPosition();
+        view.active = rock.isActive();
+        view.falling = rock.getIsFalling();
+    }
+    
+    out.powerUpCount = 0;
+    for (const auto& powerUp : powerUps) {
+        if (!powerUp.isActive()) continue;
+        if (out.powerUpCount >= RenderSnapshot::MAX_POWERUPS) break;
+        out.powerUps[out.powerUpCount++] = {powerUp.getPosition(), powerUp.getType()};
+    }
+    
+    out.harpoonCount = 0;
+    for (const auto& harpoon : harpoons) {
+        if (!harpoon.isActive()) continue;
+        if (out.harpoonCount >= RenderSnapshot::MAX_HARPOONS) break;
+        RenderSnapshot::HarpoonView& view = out.harpoons[out.harpoonCount++];
+        view.segmentCount = std::min(harpoon.getSegmentCount(), 
+                                     RenderSnapshot::MAX_HARPOON_SEGMENTS);
+        for (int i = 0; i < view.segmentCount; ++i) {
+            view.segments[i] = harpoon.getSegment(i);
+        }
+    }
+    
+    out.fireCount = 0;
+    for (const auto& fire : fireProjectiles) {
+        if (!fire.isActive()) continue;
+        if (out.fireCount >= RenderSnapshot::MAX_FIRES) break;
+        RenderSnapshot::FireView& view = out.fires[out.fireCount++];
+        const auto& trail = fire.getTrail();
+        view.direction = fire.getDirection();
+        view.progress = fire.getMoveProgress();
+        view.trailLength = std::min(static_cast<int>(trail.size()), 
+                                    RenderSnapshot::MAX_FIRE_TRAIL);
+        int firstKept = static_cast<int>(trail.size()) - view.trailLength;
+        for (int i = 0; i < view.trailLength; ++i) {
+            view.trail[i] = trail[firstKept + i];
+        }
+    }
+    
+    captureHud(out.hud);
+}
+
+void GameSimulation::captureHud(RenderSnapshot::HudView& hud) const {
+    bool ready = canFireHarpoon();
+    
+    hud.level = levelManager.getCurrentLevel();
+    hud.score = score;
+    hud.targetScore = levelManager.getTargetScore();
+    hud.lives = playerLives;
+    hud.levelTimer = levelTimer;
+    hud.canFireHarpoon = ready;
+    hud.harpoonProgress = ready ? 1.0f : 
+                         (GameClock::now() - lastHarpoonTime) / 
+                         powerUpManager.getHarpoonCooldown();
+    hud.hasPowerShot = powerUpManager.getHasPowerShot();
+    
+    hud.effectCount = 0;
+    for (const auto& effect : powerUpManager.getActivePowerUps()) {
+        if (!effect.active) continue;
+        if (hud.effectCount >= RenderSnapshot::MAX_EFFECTS) break;
+        hud.effects[hud.effectCount++] = {effect.type, effect.getTimeRemaining()};
+    }
+    
+    std::strncpy(hud.message, powerUpManager.getPowerUpMessage().c_str(), 
+                 RenderSnapshot::MESSAGE_LENGTH - 1);
+    hud.message[RenderSnapshot::MESSAGE_LENGTH - 1] = '\0';
+    hud.timeSinceMessage = powerUpManager.getTimeSinceLastCollection();
+}
+
+void GameSimulation::updateGameplay(float deltaTime) {
+    levelTimer += deltaTime;
+    
+    handleGameInput();
+    updateGameObjects();
+    powerUpManager.update();
+    powerUpManager.applySpeedReset(player);
+    checkAllCollisions();
+    checkLevelProgression();
+    spawnPowerUps();
+    
+    int tunnelCount = player.getTunnelsCreated();
+    if (player.getIsDigging()) {
+        int freshCell = tunnelCount > lastTunnelCount ? 1 : 0;
+        events.push(GameEventType::DIG, player.getPosition(), freshCell);
+    }
+    lastTunnelCount = tunnelCount;
+}
+
+void GameSimulation::updateGameObjects() {
+    player.update();
+    updateEnemies();
+    updateHarpoons();
+    updatePowerUps();
+    updateRocks();
+    updateFireProjectiles();
+}
+
+void GameSimulation::updateEnemies() {
+    MemoryScope memory(MemoryTag::ENEMIES);
+    fireSearch.beginTick();
+    claimEnemyCells();
+    aiScheduler.beginTick(enemies, terrain, player.getPosition());
+    pathfinder.sync(terrain);
+    
+    // Conflicts go to the higher priority: closer to the player moves
+    // first and claims its cell, ties by spawn order
+    Coordinate playerPos = player.getPosition();
+    auto priorityOf = [&](int index) {
+        int distance = enemies[index].getPosition().manhattanDistance(playerPos);
+        return ReservationTable::HOLD_PRIORITY - 1 - 
+               std::min(ReservationTable::HOLD_PRIORITY - 2, distance);
+    };
+    moveOrder.clear();
+    for (size_t i = 0; i < enemies.size(); ++i) {
+        moveOrder.push_back(static_cast<int>(i));
+    }
+    // Ties keep index order; std::sort with the index as tie-break gives the
+    // stable order without std::stable_sort's temporary buffer
+    std::sort(moveOrder.begin(), moveOrder.end(), [&](int a, int b) {
+        int priorityA = priorityOf(a);
+        int priorityB = priorityOf(b);
+        return priorityA != priorityB ? priorityA > priorityB : a < b;
+    });
+    
+    for (int i : moveOrder) {
+        Enemy& enemy = enemies[i];
+        if (enemy.isActive()) {
+            bool wasDestroyed = enemy.getIsDestroyed();
+            
+            if (!enemy.getIsDestroyed()) {
+                EnemyMoveContext context(terrain);
+                context.reservations = &reservations;
+                context.agent = i;
+                context.priority = priorityOf(i);
+                context.tickSeconds = GameConstants::SIMULATION_TICK;
+                context.replan = aiScheduler.shouldReplan(i);
+                context.paths.router = &pathfinder;
+                context.paths.cache = &pathCache;
+                context.paths.steps = &pathSteps;
+                if (context.replan) {
+                    auto planStart = std::chrono::steady_clock::now();
+                    enemy.moveToward(playerPos, context);
+                    aiScheduler.recordPlanTime(std::chrono::duration<double, std::micro>(
+                        std::chrono::steady_clock::now() - planStart).count());
+                } else {
+                    enemy.moveToward(playerPos, context);
+                }
+                
+                if (enemy.shouldBreatheFire(player.getPosition()) && !fireProjectiles.full()) {
+                    tryBreatheFire(enemy);
+                }
+            }
+            enemy.update();
+            
+            if (!wasDestroyed && enemy.getIsDestroyed()) {
+                events.push(GameEventType::ENEMY_DESTROYED, enemy.getPosition());
+            }
+        }
+    }
+}
+
+void GameSimulation::claimEnemyCells() {
+    reservations.beginTick();
+    
+    // Everyone holds the cell they stand on until they can next move,
+    // so no enemy steps onto another during its cooldown
+    for (size_t i = 0; i < enemies.size(); ++i) {
+        const Enemy& enemy = enemies[i];
+        if (!enemy.isActive() || enemy.getIsDestroyed()) continue;
+        
+        int waitSteps = static_cast<int>(enemy.getTimeUntilMove() / GameConstants::SIMULATION_TICK);
+        reservations.claimSpan(enemy.getPosition(), 0, std::max(2, waitSteps + 1), 
+                               static_cast<int>(i), ReservationTable::HOLD_PRIORITY);
+    }
+}
+
+void GameSimulation::tryBreatheFire(Enemy& dragon) {
+    Direction heading = player.getIsMoving() ? player.getLastMoveDirection() : Direction::NONE;
+    LocalWorldView view = LocalWorldView::capture(terrain, dragon.getPosition(), 
+                                                  player.getPosition(), heading,
+                                                  GameTuning::get().playerMoveCooldown);
+    Direction fireDir = fireSearch.chooseDirection(view, dragon.getPosition(), 
+                                                   GameClock::frameTime());
+    if (fireDir == Direction::NONE) {
+        return;
+    }
+    
+    fireProjectiles.emplace(dragon.getPosition(), fireDir);
+    dragon.beginFireBreath();
+    events.push(GameEventType::FIRE_BREATHED, dragon.getPosition());
+}
+
+void GameSimulation::updateHarpoons() {
+    MemoryScope memory(MemoryTag::PROJECTILES);
+    harpoons.removeIf([](Harpoon& h) { 
+        if (h.isActive()) {
+            h.update();
+            return false;
+        }
+        return true;
+    });
+}
+
+void GameSimulation::updatePowerUps() {
+    powerUps.erase(
+        std::remove_if(powerUps.begin(), powerUps.end(),
+            [](PowerUp& p) {
+                if (p.isActive()) {
+                    p.update();
+                    return false;
+                }
+                return true;
+            }),
+        powerUps.end()
+    );
+}
+
+void GameSimulation::updateRocks() {
+    for (auto& rock : rocks) {
+        if (rock.isActive()) {
+            bool wasFalling = rock.getIsFalling();
+            rock.update();
+            rock.applyGravity(terrain);
+            
+            if (wasFalling && rock.getHasLanded()) {
+                events.push(GameEventType::ROCK_LANDED, rock.getPosition());
+            }
+        }
+    }
+}
+
+void GameSimulation::updateFireProjectiles() {
+    MemoryScope memory(MemoryTag::PROJECTILES);
+    ProjectileSystem::step(fireProjectiles, GameClock::frameTime(), terrain);
+    
+    for (auto& fire : fireProjectiles) {
+        if (fire.isActive()) {
+            if (fire.checkPlayerHit(player.getPosition())) {
+                playerHitByFire();
+                fire.setActive(false);
+            }
+        }
+    }
+    
+    fireProjectiles.removeIf([](const FireProjectile& f) { return !f.isActive(); });
+}
+
+void GameSimulation::handleGameInput() {
+    player.queueDirection(inputManager.getPressedDirection());
+    player.handleMovementWithRocks(inputManager.getMovementInput(), terrain, rocks);
+    
+    if (inputManager.isHarpoonPressed() && canFireHarpoon()) {
+        fireHarpoon();
+    }
+    
+    if (inputManager.isPausePressed()) {
+        stateManager.changeState(GameState::PAUSED);
+    }
+    
+    if (inputManager.isRestartPressed()) {
+        restartGame();
+    }
+    
+    if (inputManager.isExitPressed()) {
+        quitRequested = true;
+    }
+}
+
+void GameSimulation::fireHarpoon() {
+    Direction playerDir = player.getLastMoveDirection();
+    if (playerDir != Direction::NONE) {
+        Coordinate playerPos = player.getPosition();
+        if (!harpoons.emplace(playerPos, playerDir, &player)) {
+            return;
+        }
+        lastHarpoonTime = GameClock::now();
+        events.push(GameEventType::HARPOON_FIRED, playerPos);
+    }
+}
+
+bool GameSimulation::canFireHarpoon() const {
+    float currentTime = GameClock::now();
+    return (currentTime - lastHarpoonTime) >= powerUpManager.getHarpoonCooldown();
+}
+
+void GameSimulation::checkAllCollisions() {
+    if (collisionManager.checkPlayerEnemyCollision(player, enemies)) {
+        playerHit();
+        return;
+    }
+    
+    collisionManager.checkHarpoonEnemyCollisions(harpoons, enemies, score, 
+                                               enemiesDefeated, 
+                                               levelManager.getCurrentLevel());
+    
+    bool playerCrushed = false;
+    collisionManager.checkRockCollisions(rocks, player, enemies, playerCrushed);
+    if (playerCrushed) {
+        playerHit();
+        return;
+    }
+    
+    PowerUp* collectedPowerUp = collisionManager.checkPowerUpCollision(player, 
+                                                                      powerUps);
+    if (collectedPowerUp) {
+        events.push(GameEventType::POWERUP_COLLECTED, 
+                   collectedPowerUp->getPosition());
+        
+        powerUpManager.collectPowerUp(*collectedPowerUp, player, 
+                                    playerLives, score);
+        collectedPowerUp->collect();
+    }
+}
+
+void GameSimulation::playerHit() {
+    events.push(GameEventType::PLAYER_HIT, player.getPosition());
+    loseLife();
+}
+
+void GameSimulation::playerHitByFire() {
+    events.push(GameEventType::PLAYER_BURNED, player.getPosition());
+    loseLife();
+}
+
+void GameSimulation::loseLife() {
+    playerLives--;
+    
+    if (playerLives <= 0) {
+        stateManager.changeState(GameState::GAME_OVER);
+    } else {
+        player.reset(Coordinate(Coordinate::PLAYABLE_START_ROW, 1));
+    }
+}
+
+void GameSimulation::checkLevelProgression() {
+    if (levelManager.isLevelComplete(enemies, score)) {
+        if (stateManager.changeState(GameState::LEVEL_COMPLETE)) {
+            events.push(GameEventType::LEVEL_COMPLETED, player.getPosition());
+            prepareLevelAhead(levelManager.getCurrentLevel() + 1);
+        }
+        score += levelManager.calculateTimeBonus(levelTimer, 
+                                               levelManager.getCurrentLevel());
+    }
+}
+
+void GameSimulation::spawnPowerUps() {
+    if (levelManager.shouldSpawnPowerUp(levelTimer)) {
+        powerUps.push_back(levelManager.createRandomPowerUp(terrain, player.getPosition()));
+        levelManager.updatePowerUpSpawnTime(levelTimer);
+    }
+}
+
+void GameSimulation::handleMenuState() {
+    InputAction action = inputManager.getMenuInput();
+    switch (action) {
+        case InputAction::CONFIRM:
+            stateManager.changeState(GameState::PLAYING);
+            initializeLevel();
+            break;
+        case InputAction::EXIT:
+            quitRequested = true;
+            break;
+        default:
+            break;
+    }
+}
+
+void GameSimulation::handlePauseState() {
+    InputAction action = inputManager.getPauseInput();
+    switch (action) {
+        case InputAction::CONFIRM:
+            stateManager.changeState(GameState::PLAYING);
+            break;
+        case InputAction::EXIT:
+            quitRequested = true;
+            break;
+        default:
+            break;
+    }
+}
+
+void GameSimulation::handleEndGameState() {
+    InputAction action = inputManager.getEndGameInput();
+    switch (action) {
+        case InputAction::RESTART:
+            restartGame();
+            break;
+        case InputAction::CONFIRM:
+            if (stateManager.getCurrentState() == GameState::LEVEL_COMPLETE) {
+                nextLevel();
+            }
+            break;
+        case InputAction::EXIT:
+            quitRequested = true;
+            break;
+        default:
+            break;
+    }
+}
+
+void GameSimulation::initializeNewGame() {
+    levelManager.reset();
+    powerUpManager.reset();
+    score = 0;
+    playerLives = STARTING_LIVES;
+    enemiesDefeated = 0;
+    levelTimer = 0.0f;
+    lastHarpoonTime = 0.0f;
+    initializeLevel();
+}
+
+void GameSimulation::initializeLevel() {
+    int level = levelManager.getCurrentLevel();
+    if (proceduralLevels && !levelManager.hasMapFile(level)) {
+        loadLevel(&generatedLayout(level));
+    } else {
+        loadLevel(nullptr);
+    }
+}
+
+void GameSimulation::reloadCurrentLevel() {
+    initializeLevel();
+}
+
+void GameSimulation::loadLevel(const LevelLayout* layout) {
+    levelManager.initializeLevel(levelManager.getCurrentLevel(), terrain, 
+                               player, enemies, powerUps, rocks, layout);
+    levelTimer = 0.0f;
+    lastTunnelCount = 0;
+    levelEpoch++;
+    harpoons.clear();
+    fireProjectiles.clear();
+    events.clear();
+    
+    if (!powerUpManager.hasPowerUpEffect(PowerUpType::SPEED_BOOST)) {
+        player.setSpeedMultiplier(1.0f);
+    }
+}
+
+const LevelLayout& GameSimulation::generatedLayout(int level) {
+    if (cachedLevel != level) {
+        if (pendingLevel == level && pendingLayout.valid()) {
+            cachedLayout = pendingLayout.get();
+        } else {
+            cachedLayout = LevelEvaluator::selectBest(level, levelSeed(level));
+        }
+        cachedLevel = level;
+    }
+    return cachedLayout;
+}
+
+std::uint64_t GameSimulation::levelSeed(int level) {
+    return PROCEDURAL_LEVEL_SEED + static_cast<std::uint64_t>(level) * 0x9E3779B97F4A7C15ull;
+}
+
+void GameSimulation::nextLevel() {
+    levelManager.nextLevel();
+    powerUpManager.reset();
+    player.setSpeedMultiplier(1.0f);
+    
+    if (levelManager.getCurrentLevel() > MAX_LEVELS) {
+        stateManager.changeState(GameState::VICTORY);
+    } else {
+        stateManager.changeState(GameState::PLAYING);
+        initializeLevel();
+    }
+}
+
+void GameSimulation::restartGame() {
+    stateManager.changeState(GameState::PLAYING);
+    initializeNewGame();
+}
@@ -0,0 +1,242 @@
+#ifndef GAMESIMULATION_H
+#define GAMESIMULATION_H
+
+#include <vector>
+#include <future>
+#include <cstdint>
+#include "Coordinate.h"
+#include "BlockGrid.h"
+#include "Player.h"
+#include "Enemy.h"
+#include "Harpoon.h"
+#include "PowerUp.h"
+#include "Rock.h"
+#include "FireProjectile.h"
+#include "InputManager.h"
+#include "CollisionManager.h"
+#include "LevelManager.h"
+#include "PowerUpManager.h"
+#include "GameState.h"
+#include "GameEvents.h"
+#include "FireLookahead.h"
+#include "ReservationTable.h"
+#include "AIScheduler.h"
+#include "HierarchicalPathfinder.h"
+#include "PathCache.h"
+#include "RenderSnapshot.h"
+#include "LevelLayout.h"
+#include "ObjectPool.h"
+#include "GameConstants.h"
+
+/**
+ * @file GameSimulation.h
+ * @brief Complete game rules, independent of window and rendering
+ */
+
+/**
+ * @class GameSimulation
+ * @brief Owns all gameplay state and advances it one tick at a time
+ *
+ * GameSimulation is everything DigDugGame used to do except drawing:
+ * terrain, entities, collisions, scoring, level flow and the game
+ * state machine. It never reads the keyboard or draws; input arrives
+ * as an InputFrame and output leaves as a RenderSnapshot plus the
+ * gameplay event queue.
+ *
+ * Tick contract:
+ * 1. step(input) advances exactly one GameClock::frameTime()
+ * 2. captureSnapshot() copies the drawable state
+ * 3. The caller consumes and clears getEvents()
+ *
+ * Because it has no window dependency it can run on a dedicated
+ * thread at a fixed rate, or headless in tests.
+ * 
+ * State snapshots (saveState/restoreState) capture every entity,
+ * manager, the clock and the RNG in a versioned binary blob - used for
+ * checkpoints, rewinding and branching lookahead simulations.
+ * 
+ * Levels without a map file are generated (LevelEvaluator picks the
+ * best of several LevelGenerator candidates). Generation for the next
+ * level starts in the background as soon as LEVEL_COMPLETE is reached,
+ * so it is normally done before the player continues. The layout only
+ * depends on the level number, so replays and restores stay
+ * deterministic whichever path produced it.
+ *
+ * @note Advances GameClock at the end of each step (fixed-step mode)
+ */
+class GameSimulation {
+public:
+    using HarpoonPool = ObjectPool<Harpoon, GameConstants::MAX_ACTIVE_HARPOONS>;
+    using FirePool = ObjectPool<FireProjectile, GameConstants::MAX_ACTIVE_FIRES>;
+
+private:
+    InputManager inputManager;
+    CollisionManager collisionManager;
+    LevelManager levelManager;
+    PowerUpManager powerUpManager;
+    GameStateManager stateManager;
+    GameEventQueue events;
+    FireLookahead fireSearch;      ///< Dragon fire decisions (budget refilled each tick)
+    ReservationTable reservations; ///< Enemy cell claims (rebuilt each tick)
+    std::vector<int> moveOrder;    ///< Enemy indices by move priority (reused)
+    std::vector<Coordinate> pathSteps; ///< Enemy plan buffer (reused)
+    AIScheduler aiScheduler;       ///< Which enemies replan this tick (LOD + budget)
+    HierarchicalPathfinder pathfinder; ///< Chunk graph for enemy tunnel routes
+    PathCache pathCache;           ///< Recent enemy paths (saved with the state)
+    
+    BlockGrid terrain;
+    Player player;
+    std::vector<Enemy> enemies;
+    HarpoonPool harpoons;
+    std::vector<PowerUp> powerUps;
+    std::vector<Rock> rocks;
+    FirePool fireProjectiles;
+    
+    int score;
+    int enemiesDefeated;
+    int playerLives;
+    float lastHarpoonTime;
+    float levelTimer;
+    int lastTunnelCount;
+    unsigned int tick;
+    unsigned int levelEpoch;
+    bool quitRequested;
+    
+    bool proceduralLevels;                 ///< false for headless evaluation games
+    std::future<LevelLayout> pendingLayout;
+    int pendingLevel;
+    LevelLayout cachedLayout;
+    int cachedLevel;
+
+public:
+    /**
+     * @brief Construct simulation in MENU state with level 1 loaded
+     * @param generateLevels Generate layouts for levels without a map
+     *        file (false falls back to the default map - used by the
+     *        evaluator's own rollouts)
+     */
+    explicit GameSimulation(bool generateLevels = true);
+    ~GameSimulation();
+    
+    // Each live simulation charges its in-place storage to MemoryTracker
+    GameSimulation(const GameSimulation&) = delete;
+    GameSimulation& operator=(const GameSimulation&) = delete;
+    
+    /**
+     * @brief Jump straight into play on a given layout
+     * @param level Level number (sets target score and counts)
+     * @param layout Layout to play
+     * @note Used for headless evaluation; starts with full lives
+     */
+    void startTrial(int level, const LevelLayout& layout);
+    
+    /**
+     * @brief Start generating a level's layout on background threads
+     * @param level Level number (ignored if it has a map file)
+     */
+    void prepareLevelAhead(int level);
+    
+    /**
+     * @brief Check whether a level's generated layout is available
+     *        without waiting
+     * @param level Level number
+     */
+    bool isLevelLayoutReady(int level) const;
+    
+    /**
+     * @brief Advance simulation by one tick
+     * @param input Buttons sampled for this tick
+     */
+    void step(const InputFrame& input);
+    
+    /**
+     * @brief Copy drawable state into snapshot
+     * @param out Snapshot to fill (terrain skipped if generation unchanged)
+     */
+    void captureSnapshot(RenderSnapshot& out) const;
+    
+    /**
+     * @brief Write complete game state to a binary snapshot
+     * @param out Buffer to overwrite (capacity is reused)
+     * @note Includes GameClock time and GameRandom state, so a restored
+     *       simulation replays identically for identical input
+     */
+    void saveState(std::vector<unsigned char>& out) const;
+    
+    /**
+     * @brief Replace game state with a snapshot from saveState()
+     * @param bytes Snapshot data
+     * @param size Snapshot length in bytes
+     * @return true if restored; false (state unchanged) on bad data
+     * @note Rewinds GameClock only in fixed-step mode
+     */
+    bool restoreState(const unsigned char* bytes, std::size_t size);
+    
+    bool restoreState(const std::vector<unsigned char>& bytes) {
+        return restoreState(bytes.data(), bytes.size());
+    }
+    
+    /**
+     * @brief Restart the current level from its (edited) map file
+     * @note Score and lives are kept; only the level's objects reset.
+     *       Call between ticks, as HotReloadService does.
+     */
+    void reloadCurrentLevel();
+    
+    /**
+     * @brief Get events produced since last clear
+     * @return GameEventQueue& Caller clears after consuming
+     */
+    GameEventQueue& getEvents() { return events; }
+    
+    /**
+     * @brief Check if player asked to quit (ESC on menu/pause/end screens)
+     */
+    bool isQuitRequested() const { return quitRequested; }
+    
+    unsigned int getTick() const { return tick; }
+    GameState getState() const { return stateManager.getCurrentState(); }
+    int getScore() const { return score; }
+    int getLives() const { return playerLives; }
+    int getLevel() const { return levelManager.getCurrentLevel(); }
+    const BlockGrid& getTerrain() const { return terrain; }
+    const Player& getPlayer() const { return player; }
+    const std::vector<Enemy>& getEnemies() const { return enemies; }
+    const AIScheduler& getAIScheduler() const { return aiScheduler; }
+    const PathCache& getPathCache() const { return pathCache; }
+    const CollisionManager& getCollisionManager() const { return collisionManager; }
+
+private:
+    void updateGameplay(float deltaTime);
+    void updateGameObjects();
+    void updateEnemies();
+    void claimEnemyCells();
+    void tryBreatheFire(Enemy& dragon);
+    void updateHarpoons();
+    void updatePowerUps();
+    void updateRocks();
+    void updateFireProjectiles();
+    void handleGameInput();
+    void fireHarpoon();
+    bool canFireHarpoon() const;
+    void checkAllCollisions();
+    void playerHit();
+    void playerHitByFire();
+    void loseLife();
+    void checkLevelProgression();
+    void spawnPowerUps();
+    void handleMenuState();
+    void handlePauseState();
+    void handleEndGameState();
+    void initializeNewGame();
+    void chargeInlineStorage(int sign);
+    void initializeLevel();
+    void loadLevel(const LevelLayout* layout);
+    const LevelLayout& generatedLayout(int level);
+    static std::uint64_t levelSeed(int level);
+    void nextLevel();
+    void restartGame();
+    void captureHud(RenderSnapshot::HudView& hud) const;
+};
+
+#endif // GAMESIMULATION_H
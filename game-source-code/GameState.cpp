@@ -1,4 +1,5 @@
 #include "GameState.h"
+#include "StateSerializer.h"
 #include <raylib-cpp.hpp>
 
 bool GameStateManager::changeState(GameState newState) {
@@ -54,3 +55,17 @@ bool GameStateManager::isValidTransition(GameState from, GameState to) {
     }
     return false;
 }
+
+void GameStateManager::serialize(StateWriter& writer) const {
+    writer.write(currentState);
+    writer.write(previousState);
+    writer.write(stateTimer);
+    writer.write(canTransition);
+}
+
+void GameStateManager::deserialize(StateReader& reader) {
+    reader.readEnum(currentState, GameState::SETTINGS);
+    reader.readEnum(previousState, GameState::SETTINGS);
+    reader.read(stateTimer);
+    reader.read(canTransition);
+}
@@ -3,6 +3,9 @@
 
 #include <string>
 
+class StateWriter;
+class StateReader;
+
 /**
  * @file GameState.h
  * @brief Game state machine for menu/gameplay flow control
@@ -94,6 +97,18 @@ public:
      * @return true if transition allowed
      */
     static bool isValidTransition(GameState from, GameState to);
+    
+    /**
+     * @brief Write state machine (current/previous state and timers) to a state snapshot
+     * @param writer Destination
+     */
+    void serialize(StateWriter& writer) const;
+    
+    /**
+     * @brief Restore state written by serialize()
+     * @param reader Source
+     */
+    void deserialize(StateReader& reader);
 };
 
 #endif // GAMESTATE_H
@@ -0,0 +1,120 @@
+#include "GameTuning.h"
+#include "LiveTable.h"
+#include <fstream>
+#include <sstream>
+
+namespace {
+    struct TuningField {
+        const char* key;
+        float TuningValues::* member;
+        float minValue;
+        float maxValue;
+    };
+
+    const TuningField FIELDS[] = {
+        {"player_move_cooldown",        &TuningValues::playerMoveCooldown,       0.02f, 2.0f},
+        {"player_fast_move_cooldown",   &TuningValues::playerFastMoveCooldown,   0.02f, 2.0f},
+        {"harpoon_cooldown",            &TuningValues::harpoonCooldown,          0.05f, 10.0f},
+        {"rapid_fire_cooldown",         &TuningValues::rapidFireCooldown,        0.05f, 10.0f},
+        {"harpoon_speed",               &TuningValues::harpoonSpeed,             0.5f,  60.0f},
+        {"harpoon_range",               &TuningValues::harpoonRange,             1.0f,  8.0f},
+        {"rock_fall_interval",          &TuningValues::rockFallInterval,         0.02f, 2.0f},
+        {"rock_crush_delay",            &TuningValues::rockCrushDelay,           0.0f,  10.0f},
+        {"rock_stationary_crush_delay", &TuningValues::rockStationaryCrushDelay, 0.0f,  10.0f},
+        {"rock_stability_interval",     &TuningValues::rockStabilityInterval,    0.01f, 2.0f},
+        {"level_time_limit",            &TuningValues::levelTimeLimit,           10.0f, 3600.0f},
+        {"first_powerup_time",          &TuningValues::firstPowerUpTime,         0.0f,  600.0f},
+        {"powerup_interval",            &TuningValues::powerUpInterval,          1.0f,  600.0f},
+    };
+
+    LiveTable<TuningValues>& liveValues() {
+        static LiveTable<TuningValues> values{TuningValues()};
+        return values;
+    }
+
+    std::string trim(const std::string& text) {
+        std::size_t first = text.find_first_not_of(" \t\r");
+        if (first == std::string::npos) return std::string();
+        std::size_t last = text.find_last_not_of(" \t\r");
+        return text.substr(first, last - first + 1);
+    }
+}
+
+const TuningValues& GameTuning::get() {
+    return liveValues().get();
+}
+
+bool GameTuning::parse(std::istream& input, TuningValues& out, std::string& error) {
+    out = TuningValues();
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(input, line)) {
+        lineNumber++;
+        std::size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        line = trim(line);
+        if (line.empty()) continue;
+
+        std::string where = "line " + std::to_string(lineNumber) + ": ";
+        std::size_t equals = line.find('=');
+        if (equals == std::string::npos) {
+            error = where + "expected key = value";
+            return false;
+        }
+        std::string key = trim(line.substr(0, equals));
+        std::istringstream valueText(trim(line.substr(equals + 1)));
+
+        const TuningField* field = nullptr;
+        for (const auto& candidate : FIELDS) {
+            if (key == candidate.key) field = &candidate;
+        }
+        if (!field) {
+            error = where + "unknown key '" + key + "'";
+            return false;
+        }
+
+        float value = 0.0f;
+        std::string extra;
+        if (!(valueText >> value) || (valueText >> extra)) {
+            error = where + key + " needs a single number";
+            return false;
+        }
+        if (value < field->minValue || value > field->maxValue) {
+            std::ostringstream range;
+            range << where << key << " must be " << field->minValue << "-" << field->maxValue;
+            error = range.str();
+            return false;
+        }
+        out.*(field->member) = value;
+    }
+    return true;
+}
+
+bool GameTuning::load(const std::string& path, std::string* error) {
+    std::ifstream file(path);
+    std::string reason;
+    if (!file.is_open()) {
+        reason = "cannot open " + path;
+    } else {
+        TuningValues values;
+        if (parse(file, values, reason)) {
+            install(values);
+            return true;
+        }
+    }
+    if (error) {
+        *error = reason;
+    }
+    return false;
+}
+
+void GameTuning::install(const TuningValues& values) {
+    liveValues().install(values);
+}
+
+void GameTuning::resetToDefaults() {
+    liveValues().reset();
+}
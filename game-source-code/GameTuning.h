@@ -0,0 +1,82 @@
+#ifndef GAMETUNING_H
+#define GAMETUNING_H
+
+#include <istream>
+#include <string>
+
+/**
+ * @file GameTuning.h
+ * @brief Balance values that can be changed at runtime from resources/config/tuning.cfg
+ */
+
+/**
+ * @struct TuningValues
+ * @brief Gameplay timings read by live systems (defaults = shipped balance)
+ */
+struct TuningValues {
+    float playerMoveCooldown = 0.12f;      ///< Seconds between player moves
+    float playerFastMoveCooldown = 0.08f;  ///< Cooldown once the move streak kicks in
+    float harpoonCooldown = 0.8f;          ///< Seconds between harpoon shots
+    float rapidFireCooldown = 0.3f;        ///< Harpoon cooldown with RAPID_FIRE
+    float harpoonSpeed = 4.0f;             ///< Harpoon extension (cells/second)
+    float harpoonRange = 3.0f;             ///< Harpoon reach (cells, origin included)
+    float rockFallInterval = 0.18f;        ///< Seconds per cell a rock falls
+    float rockCrushDelay = 1.2f;           ///< Warning time before crushing a moving player
+    float rockStationaryCrushDelay = 0.4f; ///< Warning time for a player standing still
+    float rockStabilityInterval = 0.1f;    ///< Seconds between rock support checks
+    float levelTimeLimit = 180.0f;         ///< Level time for the time bonus (seconds)
+    float firstPowerUpTime = 15.0f;        ///< First power-up spawn (seconds into level)
+    float powerUpInterval = 20.0f;         ///< Minimum gap between power-ups (seconds)
+};
+
+/**
+ * @class GameTuning
+ * @brief Live TuningValues with validated loading from a key = value file
+ *
+ * Replaces compile-time constants for values adjusted during balance
+ * passes. Systems call GameTuning::get() where they used the constant,
+ * and the HotReloadService installs edited files between ticks.
+ *
+ * File format:
+ * @code
+ * # comment
+ * harpoon_cooldown = 0.8
+ * @endcode
+ * Keys not listed keep their default. Unknown keys, non-numbers and
+ * out-of-range values reject the whole file with a line number, and the
+ * previous values stay live.
+ *
+ * @note Changing values mid-game is for tuning only - rollback and
+ *       replays assume the same values on both sides
+ */
+class GameTuning {
+public:
+    static constexpr const char* DEFAULT_PATH = "resources/config/tuning.cfg";
+
+    /**
+     * @brief Live values (one atomic load)
+     */
+    static const TuningValues& get();
+
+    /**
+     * @brief Parse and validate a tuning file
+     * @param input File text
+     * @param out Receives the values (starts from defaults)
+     * @param error Receives the first problem found
+     * @return true if every line was valid
+     */
+    static bool parse(std::istream& input, TuningValues& out, std::string& error);
+
+    /**
+     * @brief Load, validate and install a file
+     * @param path File to read
+     * @param error Optional: receives the reason on failure
+     * @return true if installed; false keeps the current values
+     */
+    static bool load(const std::string& path = DEFAULT_PATH, std::string* error = nullptr);
+
+    static void install(const TuningValues& values);
+    static void resetToDefaults();
+};
+
+#endif // GAMETUNING_H
@@ -1,16 +1,15 @@
 #include "Harpoon.h"
+#include "StateSerializer.h"
+#include "GameClock.h"
 #include "Player.h"
+#include "GameTuning.h"
 #include <raylib-cpp.hpp>
 
-const float HARPOON_SPEED = 4.0f;
-const float HARPOON_MAX_RANGE = 3.0f; // 3 blocks range
-
 Harpoon::Harpoon(Coordinate startPos, Direction dir, Player* player) 
-    : GameObject(startPos), direction(dir), speed(HARPOON_SPEED), 
-      maxRange(HARPOON_MAX_RANGE), currentLength(0.0f), 
-      state(HarpoonState::EXTENDING), startPosition(startPos),
+    : GameObject(startPos), direction(dir), speed(GameTuning::get().harpoonSpeed), 
+      maxRange(GameTuning::get().harpoonRange), currentLength(0.0f), 
+      state(HarpoonState::EXTENDING), startPosition(startPos), length(0),
       playerRef(player) {
-    segments.push_back(startPos);
 }
 
 void Harpoon::update() {
@@ -36,15 +35,26 @@ void Harpoon::render() {
 }
 
 bool Harpoon::checkEnemyHit(Coordinate enemyPos) {
-    for (const auto& segment : segments) {
-        if (segment == enemyPos) {
-            state = HarpoonState::RETRACTING;
-            return true;
-        }
+    if (covers(enemyPos)) {
+        state = HarpoonState::RETRACTING;
+        return true;
     }
     return false;
 }
 
+bool Harpoon::covers(Coordinate cell) const {
+    if (direction == Direction::NONE) {
+        return cell == startPosition;
+    }
+    Coordinate offset = directionOffset(direction);
+    int deltaRow = cell.row - startPosition.row;
+    int deltaCol = cell.col - startPosition.col;
+    // Off-axis component must be zero; on-axis component is the cell's index
+    int along = deltaRow * offset.row + deltaCol * offset.col;
+    int across = deltaRow * offset.col - deltaCol * offset.row;
+    return across == 0 && along >= 0 && along <= length;
+}
+
 Direction Harpoon::getDirection() const {
     return direction;
 }
@@ -53,95 +63,108 @@ HarpoonState Harpoon::getState() const {
     return state;
 }
 
-const std::vector<Coordinate>& Harpoon::getSegments() const {
-    return segments;
+int Harpoon::getSegmentCount() const {
+    return length + 1;
 }
 
-void Harpoon::updatePlayerConnection() {
-    if (playerRef && !segments.empty()) {
-        // Update the start position to current player position
-        startPosition = playerRef->getPosition();
-        segments[0] = startPosition;
-        
-        // Recalculate all segments to maintain connection
-        recalculateSegments();
+Coordinate Harpoon::getSegment(int index) const {
+    Coordinate offset = directionOffset(direction);
+    return Coordinate(startPosition.row + offset.row * index, 
+                      startPosition.col + offset.col * index);
+}
+
+std::vector<Coordinate> Harpoon::getSegments() const {
+    std::vector<Coordinate> cells;
+    cells.reserve(getSegmentCount());
+    for (int i = 0; i < getSegmentCount(); ++i) {
+        cells.push_back(getSegment(i));
     }
+    return cells;
+}
+
+void Harpoon::updatePlayerConnection() {
+    if (!playerRef) return;
+    
+    Coordinate playerPos = playerRef->getPosition();
+    if (playerPos == startPosition) return;
+    
+    // Player moved: shift the whole harpoon with them, keeping its length
+    startPosition = playerPos;
+    clipToBounds();
+    position = getSegment(length);
 }
 
 void Harpoon::extend() {
-    float deltaTime = GetFrameTime();
+    float deltaTime = GameClock::frameTime();
     currentLength += speed * deltaTime;
     
     if (currentLength >= 1.0f) {
-        Coordinate offset;
-        switch (direction) {
-            case Direction::UP:    offset = Coordinate(-1, 0); break;
-            case Direction::DOWN:  offset = Coordinate(1, 0); break;
-            case Direction::LEFT:  offset = Coordinate(0, -1); break;
-            case Direction::RIGHT: offset = Coordinate(0, 1); break;
-            case Direction::NONE:  return;
-        }
+        if (direction == Direction::NONE) return;
         
-        Coordinate nextPos = segments.back() + offset;
+        Coordinate nextPos = getSegment(length + 1);
         
-        if (!nextPos.isWithinBounds() || segments.size() >= maxRange) {
+        if (!nextPos.isWithinBounds() || getSegmentCount() >= maxRange) {
             state = HarpoonState::RETRACTING;
             return;
         }
         
-        segments.push_back(nextPos);
+        length++;
         position = nextPos;
         currentLength = 0.0f;
     }
 }
 
 void Harpoon::retract() {
-    float deltaTime = GetFrameTime();
+    float deltaTime = GameClock::frameTime();
     currentLength += speed * deltaTime;
     
-    if (currentLength >= 1.0f && segments.size() > 1) {
-        segments.pop_back();
-        if (!segments.empty()) {
-            position = segments.back();
-        }
+    if (currentLength >= 1.0f && length > 0) {
+        length--;
+        position = getSegment(length);
         currentLength = 0.0f;
         
-        if (segments.size() <= 1) {
+        if (length == 0) {
             setActive(false);
         }
     }
 }
 
-void Harpoon::recalculateSegments() {
-    if (segments.size() <= 1) return;
+void Harpoon::clipToBounds() {
+    if (length == 0 || direction == Direction::NONE) return;
     
-    // Keep the direction and length, but recalculate from new player position
-    Coordinate offset;
-    switch (direction) {
-        case Direction::UP:    offset = Coordinate(-1, 0); break;
-        case Direction::DOWN:  offset = Coordinate(1, 0); break;
-        case Direction::LEFT:  offset = Coordinate(0, -1); break;
-        case Direction::RIGHT: offset = Coordinate(0, 1); break;
-        case Direction::NONE:  return;
-    }
-    
-    // Rebuild segments from player position
-    int segmentCount = segments.size();
-    segments.clear();
-    segments.push_back(startPosition);
-    
-    for (int i = 1; i < segmentCount; ++i) {
-        Coordinate nextPos = segments.back() + offset;
-        if (nextPos.isWithinBounds()) {
-            segments.push_back(nextPos);
-        } else {
-            // Hit boundary, start retracting
-            state = HarpoonState::RETRACTING;
-            break;
-        }
+    // The run is straight, so only the tip can leave the world
+    int inBounds = 0;
+    while (inBounds < length && getSegment(inBounds + 1).isWithinBounds()) {
+        inBounds++;
     }
-    
-    if (!segments.empty()) {
-        position = segments.back();
+    if (inBounds < length) {
+        // Hit boundary, start retracting
+        length = inBounds;
+        state = HarpoonState::RETRACTING;
     }
 }
+
+void Harpoon::serialize(StateWriter& writer) const {
+    writer.write(position);
+    writer.write(active);
+    writer.write(direction);
+    writer.write(speed);
+    writer.write(maxRange);
+    writer.write(currentLength);
+    writer.write(state);
+    writer.write(startPosition);
+    writer.write(static_cast<std::uint32_t>(length));
+}
+
+void Harpoon::deserialize(StateReader& reader, Player* player) {
+    reader.readPosition(position);
+    reader.read(active);
+    reader.readEnum(direction, Direction::NONE);
+    reader.read(speed);
+    reader.read(maxRange);
+    reader.read(currentLength);
+    reader.readEnum(state, HarpoonState::IDLE);
+    reader.readPosition(startPosition);
+    length = static_cast<int>(reader.readCount(Coordinate::WORLD_ROWS + Coordinate::WORLD_COLS));
+    playerRef = player;
+}
@@ -3,9 +3,12 @@
 
 #include "GameObject.h"
 #include "Coordinate.h"
-#include "EnemyLogic.h"
+#include "Direction.h"
 #include <vector>
 
+class StateWriter;
+class StateReader;
+
 /**
  * @file Harpoon.h
  * @brief Player's extending/retracting harpoon weapon
@@ -36,8 +39,11 @@ class Player; // Forward declaration
  * Technical details:
  * - Max range: 3-4 cells
  * - Speed: 4-5 cells/second
- * - Segments: Vector of coordinates forming line
- * - Player tracking: Non-owning Player* reference
+ * - Shape: (origin, direction, length) - a straight run of length + 1
+ *   cells starting at the player; no per-cell storage
+ * - covers() answers "is this cell on the harpoon" in O(1)
+ * - Player tracking: Non-owning Player* reference; the origin only
+ *   moves (and the length is re-clipped) when the player has moved
  * 
  * Lifecycle:
  * 1. EXTENDING: Growing toward target
@@ -54,8 +60,8 @@ private:
     float currentLength;
     HarpoonState state;
     Coordinate startPosition;
+    int length;
     Player* playerRef;
-    std::vector<Coordinate> segments;
 
 public:
     /**
@@ -72,13 +78,37 @@ public:
     /**
      * @brief Check if harpoon hit enemy at position
      * @param enemyPos Enemy coordinate to check
-     * @return true if any segment overlaps enemy
+     * @return true if any segment overlaps enemy (starts retracting)
      */
     bool checkEnemyHit(Coordinate enemyPos);
     
+    /**
+     * @brief Check whether a cell lies on the harpoon
+     * @param cell Cell to test
+     * @return true if cell is the origin or one of the extended cells
+     * @note O(1): projects the cell onto the harpoon's axis
+     */
+    bool covers(Coordinate cell) const;
+    
     Direction getDirection() const;
     HarpoonState getState() const;
-    const std::vector<Coordinate>& getSegments() const;
+    
+    /**
+     * @brief Number of cells the harpoon occupies (origin included)
+     */
+    int getSegmentCount() const;
+    
+    /**
+     * @brief Cell at a given index along the harpoon
+     * @param index 0 = origin (player), getSegmentCount() - 1 = tip
+     */
+    Coordinate getSegment(int index) const;
+    
+    /**
+     * @brief All occupied cells, origin first
+     * @note Builds a new vector - hot paths use covers()/getSegment()
+     */
+    std::vector<Coordinate> getSegments() const;
     
     /**
      * @brief Update base position to track moving player
@@ -86,10 +116,23 @@ public:
      */
     void updatePlayerConnection();
 
+    /**
+     * @brief Write harpoon segments and extension state to a state snapshot
+     * @param writer Destination
+     */
+    void serialize(StateWriter& writer) const;
+    
+    /**
+     * @brief Restore state written by serialize()
+     * @param reader Source
+     * @param player Player to reattach to (pointer is not serialized)
+     */
+    void deserialize(StateReader& reader, Player* player);
+
 private:
     void extend();
     void retract();
-    void recalculateSegments();
+    void clipToBounds();
 };
 
 #endif // HARPOON_H
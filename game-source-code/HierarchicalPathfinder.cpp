@@ -0,0 +1,350 @@
+#include "HierarchicalPathfinder.h"
+#include "BlockGrid.h"
+#include "Direction.h"
+#include <algorithm>
+#include <climits>
+
+namespace {
+    const int UNSEEN = INT_MAX;
+
+    Coordinate cellAt(int index) {
+        return Coordinate(index / Coordinate::WORLD_COLS, index % Coordinate::WORLD_COLS);
+    }
+
+    // Chunk bounds: rows [first, end) and columns [first, end)
+    const int SIZE = HierarchicalPathfinder::CHUNK_SIZE;
+    const int CHUNKS_PER_ROW = HierarchicalPathfinder::CHUNK_COLS;
+
+    const int ROWS = Coordinate::WORLD_ROWS;
+    const int COLS = Coordinate::WORLD_COLS;
+
+    int chunkFirstRow(int chunk) { return (chunk / CHUNKS_PER_ROW) * SIZE; }
+    int chunkFirstCol(int chunk) { return (chunk % CHUNKS_PER_ROW) * SIZE; }
+    int chunkEndRow(int chunk) { return std::min(ROWS, chunkFirstRow(chunk) + SIZE); }
+    int chunkEndCol(int chunk) { return std::min(COLS, chunkFirstCol(chunk) + SIZE); }
+}
+
+HierarchicalPathfinder::HierarchicalPathfinder() : builtGeneration(0), built(false) {
+    std::fill(localDist, localDist + CELLS, static_cast<std::int16_t>(-1));
+    std::fill(searchCost, searchCost + CELLS, UNSEEN);
+}
+
+void HierarchicalPathfinder::rebuild(const BlockGrid& terrain) {
+    for (int chunk = 0; chunk < CHUNKS; ++chunk) {
+        rebuildBorders(terrain, chunk);
+    }
+    for (int chunk = 0; chunk < CHUNKS; ++chunk) {
+        rebuildChunk(terrain, chunk);
+    }
+    builtGeneration = terrain.getGeneration();
+    built = true;
+}
+
+int HierarchicalPathfinder::sync(const BlockGrid& terrain) {
+    if (built && terrain.getGeneration() == builtGeneration) {
+        return 0;
+    }
+    if (!built || !terrain.getChangesSince(builtGeneration, changedCells)) {
+        rebuild(terrain);
+        return CHUNKS;
+    }
+
+    bool dirty[CHUNKS] = {};
+    for (const Coordinate& cell : changedCells) {
+        int chunk = chunkOf(cell);
+        int chunkRow = chunk / CHUNK_COLS;
+        int chunkCol = chunk % CHUNK_COLS;
+        dirty[chunk] = true;
+
+        // A cell on a chunk edge changes that border's entrances, which
+        // belong to the chunk on the other side as well
+        rebuildBorders(terrain, chunk);
+        if (cell.row == chunkFirstRow(chunk) && chunkRow > 0) {
+            rebuildBorders(terrain, chunk - CHUNK_COLS);
+            dirty[chunk - CHUNK_COLS] = true;
+        }
+        if (cell.row == chunkEndRow(chunk) - 1 && chunkRow + 1 < CHUNK_ROWS) {
+            dirty[chunk + CHUNK_COLS] = true;
+        }
+        if (cell.col == chunkFirstCol(chunk) && chunkCol > 0) {
+            rebuildBorders(terrain, chunk - 1);
+            dirty[chunk - 1] = true;
+        }
+        if (cell.col == chunkEndCol(chunk) - 1 && chunkCol + 1 < CHUNK_COLS) {
+            dirty[chunk + 1] = true;
+        }
+    }
+
+    int repaired = 0;
+    for (int chunk = 0; chunk < CHUNKS; ++chunk) {
+        if (dirty[chunk]) {
+            rebuildChunk(terrain, chunk);
+            repaired++;
+        }
+    }
+    builtGeneration = terrain.getGeneration();
+    return repaired;
+}
+
+bool HierarchicalPathfinder::findPath(const BlockGrid& terrain, Coordinate start, Coordinate goal,
+                                      std::vector<Coordinate>& waypoints) {
+    waypoints.clear();
+    if (terrain.isLocationBlocked(start) || terrain.isLocationBlocked(goal)) {
+        return false;
+    }
+    if (start == goal) {
+        return true;
+    }
+    if (!terrain.areConnected(start, goal)) {
+        return false;
+    }
+    sync(terrain);
+
+    int startIndex = start.toIndex();
+    int goalIndex = goal.toIndex();
+    int startChunk = chunkOf(start);
+    int goalChunk = chunkOf(goal);
+    if (startChunk == goalChunk) {
+        localSearch(terrain, start, startChunk, startChunk);
+        if (localDist[goalIndex] >= 0) {
+            waypoints.push_back(goal);
+            return true;
+        }
+    }
+    localSearch(terrain, goal, goalChunk, goalChunk);
+    linkToNodes(goalChunk, goalLinks);
+    localSearch(terrain, start, startChunk, startChunk);
+    linkToNodes(startChunk, startLinks);
+
+    // A* over entrance nodes, with start and goal linked in for this query
+    resetSearch();
+    auto relax = [&](int from, int to, int cost) {
+        if (searchCost[to] == UNSEEN) {
+            searchTouched.push_back(static_cast<std::int16_t>(to));
+        }
+        if (cost < searchCost[to]) {
+            searchCost[to] = cost;
+            searchFrom[to] = static_cast<std::int16_t>(from);
+            openHeap.emplace_back(-(cost + cellAt(to).manhattanDistance(goal)),
+                                  static_cast<std::int16_t>(to));
+            std::push_heap(openHeap.begin(), openHeap.end());
+        }
+    };
+    relax(startIndex, startIndex, 0);
+
+    while (!openHeap.empty()) {
+        std::pop_heap(openHeap.begin(), openHeap.end());
+        auto [priority, index] = openHeap.back();
+        openHeap.pop_back();
+        int cost = -priority - cellAt(index).manhattanDistance(goal);
+        if (cost > searchCost[index]) continue;  // Stale entry
+        if (index == goalIndex) break;
+
+        if (index == startIndex) {
+            for (const Edge& link : startLinks) relax(index, link.to, cost + link.cost);
+        }
+        for (const Edge& edge : adjacency[index]) relax(index, edge.to, cost + edge.cost);
+        if (chunkOf(cellAt(index)) == goalChunk) {
+            for (const Edge& link : goalLinks) {
+                if (link.to == index) relax(index, goalIndex, cost + link.cost);
+            }
+        }
+    }
+
+    if (searchCost[goalIndex] == UNSEEN) {
+        return false;
+    }
+    for (int index = goalIndex; index != startIndex; index = searchFrom[index]) {
+        waypoints.push_back(cellAt(index));
+    }
+    std::reverse(waypoints.begin(), waypoints.end());
+    return true;
+}
+
+bool HierarchicalPathfinder::refine(const BlockGrid& terrain, Coordinate from, Coordinate to,
+                                    std::vector<Coordinate>& cells) {
+    return refineWithin(terrain, from, to, chunkOf(from), chunkOf(to), cells);
+}
+
+bool HierarchicalPathfinder::refineWithin(const BlockGrid& terrain, Coordinate from, Coordinate to,
+                                          int chunkA, int chunkB, std::vector<Coordinate>& cells) {
+    localSearch(terrain, from, chunkA, chunkB);
+    int toIndex = to.toIndex();
+    if (localDist[toIndex] < 0) {
+        return false;
+    }
+    std::size_t first = cells.size();
+    for (int index = toIndex; index != from.toIndex(); index = localFrom[index]) {
+        cells.push_back(cellAt(index));
+    }
+    std::reverse(cells.begin() + first, cells.end());
+    return true;
+}
+
+bool HierarchicalPathfinder::findSteps(const BlockGrid& terrain, Coordinate start, Coordinate goal,
+                                       int maxSteps, std::vector<Coordinate>& steps) {
+    steps.clear();
+    if (!findPath(terrain, start, goal, waypointScratch)) {
+        return false;
+    }
+    Coordinate from = start;
+    for (std::size_t i = 0; i < waypointScratch.size(); ++i) {
+        if (static_cast<int>(steps.size()) >= maxSteps) break;
+        // Refine to the last waypoint within this chunk and the next one,
+        // so the BFS cuts past entrance midpoints instead of visiting them
+        int here = chunkOf(from);
+        int next = chunkOf(waypointScratch[i]);
+        while (i + 1 < waypointScratch.size()) {
+            int after = chunkOf(waypointScratch[i + 1]);
+            if (next == here && after != here) {
+                next = after;
+            } else if (after != here && after != next) {
+                break;
+            }
+            ++i;
+        }
+        if (!refineWithin(terrain, from, waypointScratch[i], here, next, steps)) {
+            return false;
+        }
+        from = waypointScratch[i];
+    }
+    if (static_cast<int>(steps.size()) > maxSteps) {
+        steps.resize(maxSteps);
+    }
+    return true;
+}
+
+int HierarchicalPathfinder::getNodeCount() const {
+    int count = 0;
+    for (const auto& nodes : chunkNodes) {
+        count += static_cast<int>(nodes.size());
+    }
+    return count;
+}
+
+void HierarchicalPathfinder::rebuildBorders(const BlockGrid& terrain, int chunk) {
+    int chunkRow = chunk / CHUNK_COLS;
+    int chunkCol = chunk % CHUNK_COLS;
+
+    // One entrance per run of cells open on both sides, at the run's middle
+    auto scan = [&](std::vector<Entrance>& entrances, Coordinate first, Coordinate along,
+                    Coordinate across, int length) {
+        entrances.clear();
+        int runStart = -1;
+        for (int i = 0; i <= length; ++i) {
+            Coordinate here(first.row + along.row * i, first.col + along.col * i);
+            bool open = i < length && !terrain.isLocationBlocked(here) &&
+                        !terrain.isLocationBlocked(here + across);
+            if (open && runStart < 0) {
+                runStart = i;
+            } else if (!open && runStart >= 0) {
+                int middle = (runStart + i - 1) / 2;
+                Coordinate cell(first.row + along.row * middle, first.col + along.col * middle);
+                entrances.emplace_back(static_cast<std::int16_t>(cell.toIndex()),
+                                       static_cast<std::int16_t>((cell + across).toIndex()));
+                runStart = -1;
+            }
+        }
+    };
+
+    if (chunkRow + 1 < CHUNK_ROWS) {
+        scan(downBorder[chunk], Coordinate(chunkEndRow(chunk) - 1, chunkFirstCol(chunk)),
+             Coordinate(0, 1), Coordinate(1, 0), chunkEndCol(chunk) - chunkFirstCol(chunk));
+    } else {
+        downBorder[chunk].clear();
+    }
+    if (chunkCol + 1 < CHUNK_COLS) {
+        scan(rightBorder[chunk], Coordinate(chunkFirstRow(chunk), chunkEndCol(chunk) - 1),
+             Coordinate(1, 0), Coordinate(0, 1), chunkEndRow(chunk) - chunkFirstRow(chunk));
+    } else {
+        rightBorder[chunk].clear();
+    }
+}
+
+void HierarchicalPathfinder::rebuildChunk(const BlockGrid& terrain, int chunk) {
+    std::vector<std::int16_t>& nodes = chunkNodes[chunk];
+    for (std::int16_t node : nodes) {
+        adjacency[node].clear();
+    }
+    nodes.clear();
+
+    // Inter-chunk edges from the four borders; this chunk is 'first' on
+    // its own down/right borders and 'second' on its neighbours'
+    auto addCrossings = [&](const std::vector<Entrance>& entrances, bool ours) {
+        for (const Entrance& entrance : entrances) {
+            std::int16_t here = ours ? entrance.first : entrance.second;
+            std::int16_t there = ours ? entrance.second : entrance.first;
+            nodes.push_back(here);
+            adjacency[here].push_back(Edge{there, 1});
+        }
+    };
+    addCrossings(downBorder[chunk], true);
+    addCrossings(rightBorder[chunk], true);
+    if (chunk / CHUNK_COLS > 0) addCrossings(downBorder[chunk - CHUNK_COLS], false);
+    if (chunk % CHUNK_COLS > 0) addCrossings(rightBorder[chunk - 1], false);
+
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+
+    // Intra-chunk edges: walking distance between nodes inside the chunk
+    for (std::int16_t node : nodes) {
+        localSearch(terrain, cellAt(node), chunk, chunk);
+        for (std::int16_t other : nodes) {
+            if (other != node && localDist[other] >= 0) {
+                adjacency[node].push_back(Edge{other, localDist[other]});
+            }
+        }
+    }
+}
+
+void HierarchicalPathfinder::localSearch(const BlockGrid& terrain, Coordinate source,
+                                         int chunkA, int chunkB) {
+    for (std::int16_t index : localTouched) {
+        localDist[index] = -1;
+    }
+    localTouched.clear();
+    localQueue.clear();
+    if (terrain.isLocationBlocked(source)) {
+        return;
+    }
+
+    std::int16_t sourceIndex = static_cast<std::int16_t>(source.toIndex());
+    localDist[sourceIndex] = 0;
+    localFrom[sourceIndex] = sourceIndex;
+    localTouched.push_back(sourceIndex);
+    localQueue.push_back(sourceIndex);
+
+    for (std::size_t head = 0; head < localQueue.size(); ++head) {
+        std::int16_t index = localQueue[head];
+        Coordinate cell = cellAt(index);
+        for (Direction dir : DirectionTable::CARDINALS) {
+            Coordinate next = cell + directionOffset(dir);
+            if (!next.isWithinBounds() || terrain.isLocationBlocked(next)) continue;
+            int nextChunk = chunkOf(next);
+            if (nextChunk != chunkA && nextChunk != chunkB) continue;
+            std::int16_t nextIndex = static_cast<std::int16_t>(next.toIndex());
+            if (localDist[nextIndex] >= 0) continue;
+            localDist[nextIndex] = static_cast<std::int16_t>(localDist[index] + 1);
+            localFrom[nextIndex] = index;
+            localTouched.push_back(nextIndex);
+            localQueue.push_back(nextIndex);
+        }
+    }
+}
+
+void HierarchicalPathfinder::linkToNodes(int chunk, std::vector<Edge>& links) const {
+    links.clear();
+    for (std::int16_t node : chunkNodes[chunk]) {
+        if (localDist[node] >= 0) {
+            links.push_back(Edge{node, localDist[node]});
+        }
+    }
+}
+
+void HierarchicalPathfinder::resetSearch() {
+    for (std::int16_t index : searchTouched) {
+        searchCost[index] = UNSEEN;
+    }
+    searchTouched.clear();
+    openHeap.clear();
+}
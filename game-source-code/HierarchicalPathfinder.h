@@ -0,0 +1,139 @@
+#ifndef HIERARCHICALPATHFINDER_H
+#define HIERARCHICALPATHFINDER_H
+
+#include "Coordinate.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+class BlockGrid;
+
+/**
+ * @file HierarchicalPathfinder.h
+ * @brief HPA* tunnel routing over fixed-size terrain chunks
+ */
+
+/**
+ * @class HierarchicalPathfinder
+ * @brief Abstract graph of chunk entrances for long-range tunnel paths
+ *
+ * The grid is cut into CHUNK_SIZE x CHUNK_SIZE chunks. Where open cells
+ * face each other across a chunk border, each run of them becomes an
+ * entrance: one node on each side, joined by a cost-1 edge. Inside each
+ * chunk, a BFS limited to the chunk gives the walking distance between
+ * its nodes. Queries search this small graph instead of every cell.
+ *
+ * Queries:
+ * - findPath() links start and goal into their chunks' nodes and runs
+ *   A* over the graph, giving waypoints (entrances, then the goal)
+ * - refine() turns one waypoint hop into cells with a BFS over at most
+ *   two chunks, so callers only pay for the part of the path they walk
+ * - findSteps() refines just enough for the steps asked for, two chunks
+ *   at a time, which also cuts past entrance midpoints
+ * - Cells in different tunnels are rejected in O(1) with BlockGrid's
+ *   tunnel index; paths never dig
+ *
+ * Repair:
+ * - sync() asks BlockGrid::getChangesSince() what was dug since the
+ *   graph was built and rebuilds only the chunks holding those cells
+ *   (plus the neighbour across a border the cell sits on)
+ * - A whole-map change, or more digging than the terrain logs, falls
+ *   back to a full rebuild
+ *
+ * Paths are near-optimal: routes go through entrance midpoints, so they
+ * can be a few cells longer than a full-grid BFS.
+ */
+class HierarchicalPathfinder {
+public:
+    static const int CHUNK_SIZE = 5;
+    static const int CHUNK_ROWS = (Coordinate::WORLD_ROWS + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    static const int CHUNK_COLS = (Coordinate::WORLD_COLS + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    static const int CHUNKS = CHUNK_ROWS * CHUNK_COLS;
+
+    HierarchicalPathfinder();
+
+    /**
+     * @brief Build the whole graph from scratch
+     */
+    void rebuild(const BlockGrid& terrain);
+
+    /**
+     * @brief Bring the graph up to date with the terrain
+     * @return int Chunks rebuilt (0 = already current, CHUNKS = full rebuild)
+     */
+    int sync(const BlockGrid& terrain);
+
+    /**
+     * @brief Find abstract waypoints from start to goal through tunnels
+     * @param waypoints Receives entrance cells then the goal (start excluded)
+     * @return true if a tunnel route exists (start == goal gives no waypoints)
+     */
+    bool findPath(const BlockGrid& terrain, Coordinate start, Coordinate goal,
+                  std::vector<Coordinate>& waypoints);
+
+    /**
+     * @brief Expand one waypoint hop into cells
+     * @param from Hop start (start or a waypoint)
+     * @param to Next waypoint
+     * @param cells Cells from the step after 'from' up to 'to' are appended
+     * @return false if the hop is not walkable (stale waypoints)
+     */
+    bool refine(const BlockGrid& terrain, Coordinate from, Coordinate to,
+                std::vector<Coordinate>& cells);
+
+    /**
+     * @brief First steps of a tunnel path, refined lazily
+     * @param maxSteps Stop refining once this many steps are known
+     * @param steps Receives up to maxSteps cells (start excluded)
+     * @return true if a tunnel route exists
+     */
+    bool findSteps(const BlockGrid& terrain, Coordinate start, Coordinate goal,
+                   int maxSteps, std::vector<Coordinate>& steps);
+
+    int getNodeCount() const;
+    unsigned int getGeneration() const { return builtGeneration; }
+
+    static int chunkOf(Coordinate cell) {
+        return (cell.row / CHUNK_SIZE) * CHUNK_COLS + cell.col / CHUNK_SIZE;
+    }
+
+private:
+    static const int CELLS = Coordinate::WORLD_ROWS * Coordinate::WORLD_COLS;
+
+    struct Edge {
+        std::int16_t to;    ///< Node cell index
+        std::int16_t cost;  ///< Steps
+    };
+    using Entrance = std::pair<std::int16_t, std::int16_t>; ///< (cell this side, cell across)
+
+    std::vector<Edge> adjacency[CELLS];          ///< Per node cell (empty for non-nodes)
+    std::vector<std::int16_t> chunkNodes[CHUNKS];
+    std::vector<Entrance> downBorder[CHUNKS];    ///< Entrances to the chunk below
+    std::vector<Entrance> rightBorder[CHUNKS];   ///< Entrances to the chunk on the right
+    unsigned int builtGeneration;
+    bool built;
+
+    // Query scratch, reused so queries do not allocate once warm
+    std::int16_t localDist[CELLS];
+    std::int16_t localFrom[CELLS];
+    std::vector<std::int16_t> localTouched;
+    std::vector<std::int16_t> localQueue;
+    int searchCost[CELLS];
+    std::int16_t searchFrom[CELLS];
+    std::vector<std::int16_t> searchTouched;
+    std::vector<std::pair<int, std::int16_t>> openHeap;
+    std::vector<Edge> startLinks;
+    std::vector<Edge> goalLinks;
+    std::vector<Coordinate> changedCells;
+    std::vector<Coordinate> waypointScratch;
+
+    void rebuildBorders(const BlockGrid& terrain, int chunk);
+    void rebuildChunk(const BlockGrid& terrain, int chunk);
+    bool refineWithin(const BlockGrid& terrain, Coordinate from, Coordinate to,
+                      int chunkA, int chunkB, std::vector<Coordinate>& cells);
+    void localSearch(const BlockGrid& terrain, Coordinate source, int chunkA, int chunkB);
+    void linkToNodes(int chunk, std::vector<Edge>& links) const;
+    void resetSearch();
+};
+
+#endif // HIERARCHICALPATHFINDER_H
@@ -0,0 +1,74 @@
+#include "HotReloadService.h"
+#include "GameSimulation.h"
+#include "GameTuning.h"
+#include "EnemyArchetypes.h"
+#include "BlockGrid.h"
+#include "GameLog.h"
+#include <cctype>
+#include <filesystem>
+
+HotReloadService::HotReloadService(const std::string& resourceRoot) : root(resourceRoot) {
+    watcher.watchDirectory(root + "/config");
+    watcher.watchDirectory(root + "/maps");
+}
+
+int HotReloadService::applyPending(GameSimulation& simulation) {
+    int applied = 0;
+    for (const auto& path : watcher.poll()) {
+        if (applyFile(path, simulation)) {
+            applied++;
+        }
+    }
+    return applied;
+}
+
+bool HotReloadService::applyFile(const std::string& path, GameSimulation& simulation) {
+    std::string fileName = std::filesystem::path(path).filename().generic_string();
+    std::string error;
+    bool ok = false;
+    
+    if (fileName == "tuning.cfg") {
+        ok = GameTuning::load(path, &error);
+    } else if (fileName == "enemies.cfg") {
+        ok = EnemyArchetypes::load(path);
+        if (!ok) {
+            error = "enemy table rejected";
+        }
+    } else if (int level = levelFromMapName(fileName); level > 0) {
+        ok = BlockGrid::validateMapFile(path, error);
+        GameState state = simulation.getState();
+        if (ok && level == simulation.getLevel() && 
+            (state == GameState::PLAYING || state == GameState::PAUSED)) {
+            simulation.reloadCurrentLevel();
+        }
+    } else {
+        return false;
+    }
+    
+    if (ok) {
+        GameLog::info() << "Reloaded " << path << std::endl;
+    } else {
+        lastError = path + ": " + error;
+        GameLog::info() << "Kept previous data, " << lastError << std::endl;
+    }
+    return ok;
+}
+
+int HotReloadService::levelFromMapName(const std::string& fileName) {
+    const std::string prefix = "level";
+    const std::string suffix = ".txt";
+    if (fileName.size() <= prefix.size() + suffix.size() ||
+        fileName.compare(0, prefix.size(), prefix) != 0 ||
+        fileName.compare(fileName.size() - suffix.size(), suffix.size(), suffix) != 0) {
+        return 0;
+    }
+    
+    int level = 0;
+    for (size_t i = prefix.size(); i < fileName.size() - suffix.size(); ++i) {
+        if (!std::isdigit(static_cast<unsigned char>(fileName[i])) || level > 1000) {
+            return 0;
+        }
+        level = level * 10 + (fileName[i] - '0');
+    }
+    return level;
+}
@@ -0,0 +1,67 @@
+#ifndef HOTRELOADSERVICE_H
+#define HOTRELOADSERVICE_H
+
+#include "FileWatcher.h"
+#include <string>
+
+class GameSimulation;
+
+/**
+ * @file HotReloadService.h
+ * @brief Applies edited maps and config files to a running game
+ */
+
+/**
+ * @class HotReloadService
+ * @brief Watches resources/ and swaps changed data in between ticks
+ *
+ * Watched files and what a change does:
+ * - config/tuning.cfg: validated and installed into GameTuning
+ * - config/enemies.cfg: validated and installed into EnemyArchetypes
+ * - maps/levelN.txt: validated; if N is the level being played, the
+ *   level restarts from the edited map
+ *
+ * Every file is validated before anything live is touched. A rejected
+ * file leaves the running game as it was and is reported through
+ * getLastError() and the log, so a half-saved edit never crashes play.
+ *
+ * applyPending() must run on the simulation thread at a tick boundary;
+ * it is the only place edited data enters the game.
+ */
+class HotReloadService {
+public:
+    /**
+     * @param resourceRoot Directory holding config/ and maps/
+     */
+    explicit HotReloadService(const std::string& resourceRoot = "resources");
+
+    /**
+     * @brief Apply every file changed since the last call
+     * @param simulation Simulation to update (level reloads)
+     * @return int Number of files applied (rejected files not counted)
+     */
+    int applyPending(GameSimulation& simulation);
+
+    /**
+     * @brief Apply one changed file
+     * @return true if the file was valid and applied
+     */
+    bool applyFile(const std::string& path, GameSimulation& simulation);
+
+    /**
+     * @brief Whether changes arrive from kernel notifications (cheap to
+     *        poll every tick) rather than timestamp scans
+     */
+    bool isEventDriven() const { return watcher.usesNotifications(); }
+
+    const std::string& getLastError() const { return lastError; }
+
+private:
+    FileWatcher watcher;
+    std::string root;
+    std::string lastError;
+
+    static int levelFromMapName(const std::string& fileName);
+};
+
+#endif // HOTRELOADSERVICE_H
@@ -1,52 +1,115 @@
 #include "InputManager.h"
 
 InputAction InputManager::getMenuInput() {
-    if (wasKeyPressed(KEY_ENTER)) return InputAction::CONFIRM;
-    if (wasKeyPressed(KEY_ESCAPE)) return InputAction::EXIT;
+    if (wasKeyPressed(InputButton::CONFIRM)) return InputAction::CONFIRM;
+    if (wasKeyPressed(InputButton::EXIT)) return InputAction::EXIT;
     return InputAction::NONE;
 }
 
 InputAction InputManager::getPauseInput() {
-    if (wasKeyPressed(KEY_P)) return InputAction::CONFIRM;
-    if (wasKeyPressed(KEY_ESCAPE)) return InputAction::EXIT;
+    if (wasKeyPressed(InputButton::PAUSE)) return InputAction::CONFIRM;
+    if (wasKeyPressed(InputButton::EXIT)) return InputAction::EXIT;
     return InputAction::NONE;
 }
 
 InputAction InputManager::getEndGameInput() {
-    if (wasKeyPressed(KEY_R)) return InputAction::RESTART;
-    if (wasKeyPressed(KEY_ENTER)) return InputAction::CONFIRM;
-    if (wasKeyPressed(KEY_ESCAPE)) return InputAction::EXIT;
+    if (wasKeyPressed(InputButton::RESTART)) return InputAction::RESTART;
+    if (wasKeyPressed(InputButton::CONFIRM)) return InputAction::CONFIRM;
+    if (wasKeyPressed(InputButton::EXIT)) return InputAction::EXIT;
     return InputAction::NONE;
 }
 
 Direction InputManager::getMovementInput() {
-    if (isKeyCurrentlyDown(KEY_UP)) return Direction::UP;
-    if (isKeyCurrentlyDown(KEY_DOWN)) return Direction::DOWN;
-    if (isKeyCurrentlyDown(KEY_LEFT)) return Direction::LEFT;
-    if (isKeyCurrentlyDown(KEY_RIGHT)) return Direction::RIGHT;
+    if (isKeyCurrentlyDown(InputButton::UP)) return Direction::UP;
+    if (isKeyCurrentlyDown(InputButton::DOWN)) return Direction::DOWN;
+    if (isKeyCurrentlyDown(InputButton::LEFT)) return Direction::LEFT;
+    if (isKeyCurrentlyDown(InputButton::RIGHT)) return Direction::RIGHT;
+    return Direction::NONE;
+}
+
+Direction InputManager::getPressedDirection() {
+    if (wasKeyPressed(InputButton::UP)) return Direction::UP;
+    if (wasKeyPressed(InputButton::DOWN)) return Direction::DOWN;
+    if (wasKeyPressed(InputButton::LEFT)) return Direction::LEFT;
+    if (wasKeyPressed(InputButton::RIGHT)) return Direction::RIGHT;
     return Direction::NONE;
 }
 
 bool InputManager::isHarpoonPressed() {
-    return wasKeyPressed(KEY_SPACE);
+    return wasKeyPressed(InputButton::FIRE);
 }
 
 bool InputManager::isPausePressed() {
-    return wasKeyPressed(KEY_P);
+    return wasKeyPressed(InputButton::PAUSE);
 }
 
 bool InputManager::isRestartPressed() {
-    return wasKeyPressed(KEY_R);
+    return wasKeyPressed(InputButton::RESTART);
 }
 
 bool InputManager::isExitPressed() {
-    return wasKeyPressed(KEY_ESCAPE);
+    return wasKeyPressed(InputButton::EXIT);
+}
+
+bool InputManager::wasKeyPressed(InputButton button) const {
+    return frame.wasPressed(button);
+}
+
+bool InputManager::isKeyCurrentlyDown(InputButton button) const {
+    return frame.isHeld(button);
+}
+
+namespace {
+    const int BUTTON_KEYS[static_cast<int>(InputButton::COUNT)] = {
+        KEY_UP, KEY_DOWN, KEY_LEFT, KEY_RIGHT,
+        KEY_SPACE, KEY_P, KEY_R, KEY_ENTER, KEY_ESCAPE
+    };
+}
+
+InputFrame InputManager::readKeyboard() {
+    InputFrame input;
+    for (int i = 0; i < static_cast<int>(InputButton::COUNT); ++i) {
+        InputButton button = static_cast<InputButton>(i);
+        if (IsKeyDown(BUTTON_KEYS[i])) input.held |= InputFrame::bit(button);
+        if (IsKeyPressed(BUTTON_KEYS[i])) input.pressed |= InputFrame::bit(button);
+    }
+    return input;
 }
 
-bool InputManager::wasKeyPressed(int key) {
-    return IsKeyPressed(key);
+void InputLatch::sampleKeyboard() {
+    InputFrame input = InputManager::readKeyboard();
+    
+    // raylib queues every key that went down since the last poll, even
+    // one already released again - IsKeyDown/IsKeyPressed miss those
+    for (int key = GetKeyPressed(); key != 0; key = GetKeyPressed()) {
+        for (int i = 0; i < static_cast<int>(InputButton::COUNT); ++i) {
+            if (BUTTON_KEYS[i] == key) {
+                input.pressed |= InputFrame::bit(static_cast<InputButton>(i));
+            }
+        }
+    }
+    record(input.held, input.pressed);
 }
 
-bool InputManager::isKeyCurrentlyDown(int key) {
-    return IsKeyDown(key);
+void InputLatch::record(unsigned int heldMask, unsigned int pressedMask, 
+                        std::int64_t timeMicros) {
+    unsigned int downs = pressedMask | (heldMask & ~lastHeld);
+    unsigned int ups = lastHeld & ~heldMask;
+    lastHeld = heldMask;
+    
+    for (int i = 0; i < static_cast<int>(InputButton::COUNT); ++i) {
+        InputButton button = static_cast<InputButton>(i);
+        unsigned int bit = InputFrame::bit(button);
+        // A tap inside one sample is a press followed by a release
+        if ((downs & bit) && !events.push(InputEvent{button, true, timeMicros})) {
+            droppedEvents.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (((ups | (downs & ~heldMask)) & bit) && 
+            !events.push(InputEvent{button, false, timeMicros})) {
+            droppedEvents.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    
+    held.store(heldMask, std::memory_order_relaxed);
+    pressed.fetch_or(pressedMask, std::memory_order_acq_rel);
 }
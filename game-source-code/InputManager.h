@@ -2,7 +2,11 @@
 #define INPUTMANAGER_H
 
 #include <raylib-cpp.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include "EnemyLogic.h"
+#include "SpscQueue.h"
 
 /**
  * @file InputManager.h
@@ -26,6 +30,190 @@ enum class InputAction {
     EXIT          ///< Exit to menu
 };
 
+/**
+ * @enum InputButton
+ * @brief Logical buttons sampled from the keyboard each frame
+ */
+enum class InputButton {
+    UP,      ///< Arrow up
+    DOWN,    ///< Arrow down
+    LEFT,    ///< Arrow left
+    RIGHT,   ///< Arrow right
+    FIRE,    ///< SPACE
+    PAUSE,   ///< P
+    RESTART, ///< R
+    CONFIRM, ///< ENTER
+    EXIT,    ///< ESC
+    COUNT
+};
+
+/**
+ * @struct InputFrame
+ * @brief Button state for one simulation tick
+ *
+ * held: buttons down when sampled
+ * pressed: buttons that went down since the previous tick
+ */
+struct InputFrame {
+    unsigned int held = 0;
+    unsigned int pressed = 0;
+    
+    static unsigned int bit(InputButton button) {
+        return 1u << static_cast<int>(button);
+    }
+    
+    bool isHeld(InputButton button) const { return (held & bit(button)) != 0; }
+    bool wasPressed(InputButton button) const { return (pressed & bit(button)) != 0; }
+};
+
+/**
+ * @struct InputEvent
+ * @brief One button going down or up, stamped when it was sampled
+ */
+struct InputEvent {
+    InputButton button = InputButton::COUNT;
+    bool down = false;
+    std::int64_t timeMicros = 0;    ///< InputEvent::nowMicros() clock
+    
+    /**
+     * @brief Monotonic time for stamping and measuring input
+     */
+    static std::int64_t nowMicros() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+};
+
+/**
+ * @class InputLatch
+ * @brief Hands keyboard state from the window thread to the simulation
+ *
+ * Only the thread that owns the window may poll raylib input. It calls
+ * sampleKeyboard() every render frame; the simulation calls consume()
+ * once per tick.
+ *
+ * Two channels:
+ * - Button masks: presses are OR-ed until consumed, so a tap shorter
+ *   than a simulation tick is never lost. Taps shorter than a render
+ *   frame come from raylib's key-press queue, which keeps keys that
+ *   went down and up between two polls.
+ * - Events: every press and release with its sampling time, in order,
+ *   through a lock-free SPSC queue. They are for measurement (input
+ *   latency) and never change the InputFrame, so recorded and replayed
+ *   input stays the same. A full queue drops events, never presses.
+ *
+ * @note Lock-free: atomic bitmasks plus one SpscQueue
+ */
+class InputLatch {
+public:
+    static const int EVENT_CAPACITY = 256;
+
+private:
+    std::atomic<unsigned int> held{0};
+    std::atomic<unsigned int> pressed{0};
+    SpscQueue<InputEvent, EVENT_CAPACITY> events;
+    unsigned int lastHeld = 0;      ///< Producer side only
+    std::atomic<unsigned int> droppedEvents{0};
+
+public:
+    /**
+     * @brief Read keyboard and latch state (window thread only)
+     */
+    void sampleKeyboard();
+    
+    /**
+     * @brief Latch explicit button masks (producer thread only)
+     * @param heldMask Buttons currently down
+     * @param pressedMask Buttons newly pressed
+     * @param timeMicros Sampling time stamped on the resulting events
+     */
+    void record(unsigned int heldMask, unsigned int pressedMask, 
+                std::int64_t timeMicros = InputEvent::nowMicros());
+    
+    /**
+     * @brief Take input for one simulation tick
+     * @return InputFrame Held buttons and presses since last consume
+     */
+    InputFrame consume() {
+        return consume([](const InputEvent&) {});
+    }
+    
+    /**
+     * @brief Take input for one tick and hand each queued event to a visitor
+     * @param onEvent Called as onEvent(const InputEvent&), oldest first
+     */
+    template <typename Visitor>
+    InputFrame consume(Visitor&& onEvent) {
+        InputEvent event;
+        while (events.pop(event)) {
+            onEvent(event);
+        }
+        InputFrame frame;
+        frame.held = held.load(std::memory_order_relaxed);
+        frame.pressed = pressed.exchange(0, std::memory_order_acq_rel);
+        return frame;
+    }
+    
+    unsigned int getDroppedEvents() const { 
+        return droppedEvents.load(std::memory_order_relaxed); 
+    }
+};
+
+/**
+ * @class InputLatencyProbe
+ * @brief Measures time from a movement key event to the player moving
+ *
+ * Fed on the simulation thread: movement-button presses from
+ * InputLatch::consume(), then the player's cell after each tick. The
+ * first position change after a press yields one sample, measured from
+ * the oldest press not yet served. A press that moves nothing within
+ * STALE_MICROS (blocked, paused) is dropped rather than charged to a
+ * later move.
+ */
+class InputLatencyProbe {
+public:
+    static constexpr std::int64_t STALE_MICROS = 500000;
+
+    void onEvent(const InputEvent& event) {
+        bool movement = event.button == InputButton::UP || event.button == InputButton::DOWN ||
+                        event.button == InputButton::LEFT || event.button == InputButton::RIGHT;
+        if (movement && event.down && !pending) {
+            pending = true;
+            pressMicros = event.timeMicros;
+        }
+    }
+
+    /**
+     * @brief Report the player's cell after a tick
+     * @param latencyMicros Receives the sample when one is produced
+     * @return true if this move completed a pending press
+     */
+    bool onPlayerCell(Coordinate cell, std::int64_t nowMicros, std::int64_t& latencyMicros) {
+        bool moved = hasCell && !(cell == lastCell);
+        lastCell = cell;
+        hasCell = true;
+        if (!pending) {
+            return false;
+        }
+        if (nowMicros - pressMicros > STALE_MICROS) {
+            pending = false;
+            return false;
+        }
+        if (!moved) {
+            return false;
+        }
+        pending = false;
+        latencyMicros = nowMicros - pressMicros;
+        return true;
+    }
+
+private:
+    bool pending = false;
+    std::int64_t pressMicros = 0;
+    Coordinate lastCell;
+    bool hasCell = false;
+};
+
 /**
  * @class InputManager
  * @brief Centralizes input detection and action mapping
@@ -50,18 +238,37 @@ enum class InputAction {
  * - Paused: P (resume), ESC (exit)
  * - End screens: R (restart), ENTER (continue), ESC (menu)
  * 
+ * Actions are derived from the InputFrame set with setFrame(), so the
+ * same code serves live keyboard input and recorded/scripted input.
+ * 
  * Design benefits:
  * - Easy to remap keys (change once here)
  * - Game logic doesn't reference specific keys
  * - Testable without actual keyboard
  * - Could support gamepad in future
  * 
- * @note Uses raylib's IsKeyPressed() and IsKeyDown()
+ * @note Only readKeyboard() touches raylib input
  */
 class InputManager {
+private:
+    InputFrame frame;
+
 public:
     InputManager() = default;
     
+    /**
+     * @brief Sample raylib keyboard into an InputFrame
+     * @return InputFrame Current held/pressed buttons
+     * @note Must run on the thread that owns the window
+     */
+    static InputFrame readKeyboard();
+    
+    /**
+     * @brief Set input used by the query methods for this tick
+     * @param input Sampled input frame
+     */
+    void setFrame(const InputFrame& input) { frame = input; }
+    
     /**
      * @brief Get input action for menu context
      * @return InputAction Mapped action (CONFIRM, EXIT, or NONE)
@@ -83,10 +290,17 @@ public:
     /**
      * @brief Get movement direction from input
      * @return Direction Current directional input (or NONE)
-     * @note Uses IsKeyDown() for continuous movement
+     * @note Uses held state for continuous movement
      */
     Direction getMovementInput();
     
+    /**
+     * @brief Get a direction newly pressed this tick
+     * @return Direction Pressed direction (or NONE)
+     * @note Catches taps already released when the tick runs
+     */
+    Direction getPressedDirection();
+    
     /**
      * @brief Check if harpoon fire pressed
      * @return true if SPACE pressed this frame
@@ -112,8 +326,8 @@ public:
     bool isExitPressed();
     
 private:
-    bool wasKeyPressed(int key);
-    bool isKeyCurrentlyDown(int key);
+    bool wasKeyPressed(InputButton button) const;
+    bool isKeyCurrentlyDown(InputButton button) const;
 };
 
 #endif // INPUTMANAGER_H
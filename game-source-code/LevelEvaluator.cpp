@@ -0,0 +1,222 @@
+#include "LevelEvaluator.h"
+#include "LevelGenerator.h"
+#include "GameSimulation.h"
+#include "GameClock.h"
+#include "GameRandom.h"
+#include "GameLog.h"
+#include "GameConstants.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+
+using namespace GameConstants;
+
+namespace {
+    const std::uint64_t SEED_STEP = 0x9E3779B97F4A7C15ull;
+    const int MAX_WORKERS = 8;
+
+    const float REACHABILITY_WEIGHT = 0.3f;
+    const float DIFFICULTY_WEIGHT = 0.5f;
+    const float ROCK_WEIGHT = 0.2f;
+
+    InputButton buttonFor(Direction direction) {
+        switch (direction) {
+            case Direction::UP:    return InputButton::UP;
+            case Direction::DOWN:  return InputButton::DOWN;
+            case Direction::LEFT:  return InputButton::LEFT;
+            case Direction::RIGHT: return InputButton::RIGHT;
+            default:               return InputButton::COUNT;
+        }
+    }
+}
+
+LevelLayout LevelEvaluator::selectBest(int level, std::uint64_t seed, const Settings& settings) {
+    int count = std::max(1, settings.candidates);
+    int workers = settings.workers > 0 ? settings.workers
+                                       : static_cast<int>(std::thread::hardware_concurrency());
+    workers = std::max(1, std::min({workers, MAX_WORKERS, count}));
+
+    std::vector<LevelLayout> candidates(count);
+    std::atomic<int> nextCandidate(0);
+
+    auto work = [&]() {
+        GameLog::setQuiet(true);
+        for (int i = nextCandidate++; i < count; i = nextCandidate++) {
+            candidates[i] = LevelGenerator::generate(level, seed + SEED_STEP * (i + 1));
+            candidates[i].score = rate(candidates[i], settings).total;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < workers; ++i) {
+        threads.emplace_back(work);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // First of equal scores wins, so the pick never depends on thread timing
+    auto best = std::max_element(candidates.begin(), candidates.end(),
+        [](const LevelLayout& a, const LevelLayout& b) { return a.score < b.score; });
+    return *best;
+}
+
+LevelRating LevelEvaluator::rate(const LevelLayout& layout, const Settings& settings) {
+    LevelRating rating;
+    rating.reachability = measureReachability(layout);
+    rating.rockPlay = measureRockPlay(layout);
+
+    float outcome = runRollouts(layout, settings);
+    rating.difficulty = std::max(0.0f, 1.0f - 2.0f * std::fabs(outcome - targetDifficulty(layout.level)));
+
+    rating.total = REACHABILITY_WEIGHT * rating.reachability +
+                   DIFFICULTY_WEIGHT * rating.difficulty +
+                   ROCK_WEIGHT * rating.rockPlay;
+    return rating;
+}
+
+float LevelEvaluator::measureReachability(const LevelLayout& layout) {
+    bool visited[LevelLayout::ROWS][LevelLayout::COLS] = {};
+    std::vector<Coordinate> frontier;
+    Coordinate start = layout.playerSpawns.empty()
+        ? Coordinate(Coordinate::PLAYABLE_START_ROW, 1) : layout.playerSpawns.front();
+    if (!layout.isOpen(start)) {
+        return 0.0f;
+    }
+
+    const Coordinate steps[] = {Coordinate(-1, 0), Coordinate(1, 0),
+                                Coordinate(0, -1), Coordinate(0, 1)};
+    frontier.push_back(start);
+    visited[start.row][start.col] = true;
+    int reached = 0;
+
+    while (!frontier.empty()) {
+        Coordinate cell = frontier.back();
+        frontier.pop_back();
+        reached++;
+        for (const auto& step : steps) {
+            Coordinate next = cell + step;
+            if (layout.isOpen(next) && !visited[next.row][next.col]) {
+                visited[next.row][next.col] = true;
+                frontier.push_back(next);
+            }
+        }
+    }
+
+    int open = 0;
+    for (int row = Coordinate::PLAYABLE_START_ROW; row < LevelLayout::ROWS; ++row) {
+        for (int col = 0; col < LevelLayout::COLS; ++col) {
+            if (!layout.blocked[row][col]) open++;
+        }
+    }
+
+    int linkedEnemies = 0;
+    for (const auto& spawn : layout.enemySpawns) {
+        if (visited[spawn.row][spawn.col]) linkedEnemies++;
+    }
+
+    float openShare = open > 0 ? static_cast<float>(reached) / open : 0.0f;
+    float enemyShare = layout.enemySpawns.empty() ? 1.0f
+        : static_cast<float>(linkedEnemies) / layout.enemySpawns.size();
+    return 0.5f * openShare + 0.5f * enemyShare;
+}
+
+float LevelEvaluator::measureRockPlay(const LevelLayout& layout) {
+    if (layout.rockSpawns.empty()) {
+        return 0.0f;
+    }
+
+    float total = 0.0f;
+    for (const auto& rock : layout.rockSpawns) {
+        // Open cell right below: falls the moment the level starts
+        if (layout.isOpen(Coordinate(rock.row + 1, rock.col))) {
+            continue;
+        }
+        total += 0.5f;
+        for (int below = 2; below <= 4; ++below) {
+            if (layout.isOpen(Coordinate(rock.row + below, rock.col))) {
+                total += 0.5f;
+                break;
+            }
+        }
+    }
+    return total / layout.rockSpawns.size();
+}
+
+InputFrame LevelEvaluator::botInput(const GameSimulation& simulation) {
+    InputFrame input;
+    const Player& player = simulation.getPlayer();
+    Coordinate pos = player.getPosition();
+
+    const Enemy* target = nullptr;
+    int targetDistance = 0;
+    for (const auto& enemy : simulation.getEnemies()) {
+        if (!enemy.isActive() || enemy.getIsDestroyed()) continue;
+        int distance = pos.manhattanDistance(enemy.getPosition());
+        if (!target || distance < targetDistance) {
+            target = &enemy;
+            targetDistance = distance;
+        }
+    }
+    if (!target) {
+        return input;
+    }
+
+    int deltaRow = target->getPosition().row - pos.row;
+    int deltaCol = target->getPosition().col - pos.col;
+    bool aligned = deltaRow == 0 || deltaCol == 0;
+
+    Direction direction;
+    if (aligned) {
+        direction = deltaRow != 0 ? (deltaRow > 0 ? Direction::DOWN : Direction::UP)
+                                  : (deltaCol > 0 ? Direction::RIGHT : Direction::LEFT);
+    } else if (std::abs(deltaRow) <= std::abs(deltaCol)) {
+        direction = deltaRow > 0 ? Direction::DOWN : Direction::UP;
+    } else {
+        direction = deltaCol > 0 ? Direction::RIGHT : Direction::LEFT;
+    }
+
+    bool inRange = aligned && targetDistance <= static_cast<int>(HARPOON_MAX_RANGE);
+    bool facing = player.getLastMoveDirection() == direction;
+    if (inRange && facing) {
+        input.pressed = InputFrame::bit(InputButton::FIRE);
+    } else {
+        input.held = InputFrame::bit(buttonFor(direction));
+    }
+    return input;
+}
+
+float LevelEvaluator::targetDifficulty(int level) {
+    return std::min(0.8f, 0.25f + 0.06f * (level - 1));
+}
+
+float LevelEvaluator::runRollouts(const LevelLayout& layout, const Settings& settings) {
+    int rollouts = std::max(1, settings.rollouts);
+    float total = 0.0f;
+
+    for (int r = 0; r < rollouts; ++r) {
+        GameRandom::seed(layout.seed ^ (SEED_STEP * (r + 7)));
+        GameClock::setFixedStep(SIMULATION_TICK, 0.0);
+
+        GameSimulation simulation(false);
+        simulation.startTrial(layout.level, layout);
+        for (int t = 0; t < settings.rolloutTicks &&
+                        simulation.getState() == GameState::PLAYING; ++t) {
+            simulation.step(botInput(simulation));
+            simulation.getEvents().clear();
+        }
+
+        int remaining = 0;
+        for (const auto& enemy : simulation.getEnemies()) {
+            if (enemy.isActive() && !enemy.getIsDestroyed()) remaining++;
+        }
+        int enemyCount = std::max<int>(1, static_cast<int>(layout.enemySpawns.size()));
+        int livesLost = std::max(0, std::min(STARTING_LIVES, STARTING_LIVES - simulation.getLives()));
+
+        total += 0.6f * livesLost / STARTING_LIVES +
+                 0.4f * static_cast<float>(remaining) / enemyCount;
+    }
+    return total / rollouts;
+}
@@ -0,0 +1,104 @@
+#ifndef LEVELEVALUATOR_H
+#define LEVELEVALUATOR_H
+
+#include <cstdint>
+#include "LevelLayout.h"
+#include "InputManager.h"
+
+class GameSimulation;
+
+/**
+ * @file LevelEvaluator.h
+ * @brief Parallel generation and ranking of procedural level candidates
+ */
+
+/**
+ * @struct LevelRating
+ * @brief Breakdown of a candidate's score (each part 0.0-1.0)
+ */
+struct LevelRating {
+    float reachability = 0.0f; ///< Open cells and enemy chambers linked to the start
+    float difficulty = 0.0f;   ///< Closeness of bot outcome to the level's target
+    float rockPlay = 0.0f;     ///< Rocks usable as traps, none falling unprovoked
+    float total = 0.0f;        ///< Weighted sum used for ranking
+};
+
+/**
+ * @class LevelEvaluator
+ * @brief Generates many LevelGenerator candidates across threads and keeps the best
+ *
+ * Each candidate is scored on:
+ * - Reachability: flood fill of open cells from the player start
+ * - Rock play: rocks resting over tunnels are good, loose rocks bad
+ * - Difficulty: headless GameSimulation rollouts driven by a simple
+ *   chase-and-fire bot; lives lost and enemies left are compared with
+ *   a target that rises with the level
+ *
+ * Work is split over worker threads (the caller's thread only waits),
+ * so the per-thread GameClock, GameRandom and GameLog state of the
+ * caller is never disturbed. Candidate seeds and rollouts are fixed,
+ * so the chosen layout depends only on (level, seed) - never on thread
+ * timing.
+ *
+ * Budget: defaults are sized to finish well within the LEVEL_COMPLETE
+ * screen when run in the background (see GameSimulation).
+ */
+class LevelEvaluator {
+public:
+    struct Settings {
+        int candidates = 16;       ///< Layouts generated per level
+        int workers = 0;           ///< Threads (0 = hardware concurrency, max 8)
+        int rollouts = 3;          ///< Bot games per candidate
+        int rolloutTicks = 1200;   ///< Ticks per bot game (20 s of play)
+    };
+
+    /**
+     * @brief Generate, rate and pick the best layout for a level
+     * @param level Level number
+     * @param seed Base seed; candidate i uses a seed derived from it
+     * @param settings Work budget
+     * @return LevelLayout Highest-rated candidate (score filled in)
+     */
+    static LevelLayout selectBest(int level, std::uint64_t seed, const Settings& settings);
+
+    static LevelLayout selectBest(int level, std::uint64_t seed) {
+        return selectBest(level, seed, Settings());
+    }
+
+    /**
+     * @brief Rate one layout (runs rollouts on the calling thread)
+     * @param layout Candidate
+     * @param settings Rollout budget
+     * @return LevelRating Score breakdown
+     * @note Reseeds the calling thread's GameRandom and GameClock -
+     *       selectBest() only calls it from worker threads
+     */
+    static LevelRating rate(const LevelLayout& layout, const Settings& settings);
+
+    /**
+     * @brief Fraction of open cells and enemy spawns connected to the start
+     */
+    static float measureReachability(const LevelLayout& layout);
+
+    /**
+     * @brief Share of rocks that rest on earth above a tunnel
+     */
+    static float measureRockPlay(const LevelLayout& layout);
+
+    /**
+     * @brief Input the rollout bot would give this tick
+     * @param simulation Running simulation
+     * @return InputFrame Chase nearest enemy, fire when lined up
+     */
+    static InputFrame botInput(const GameSimulation& simulation);
+
+    /**
+     * @brief Difficulty a level should have for the bot (0 easy - 1 hard)
+     */
+    static float targetDifficulty(int level);
+
+private:
+    static float runRollouts(const LevelLayout& layout, const Settings& settings);
+};
+
+#endif // LEVELEVALUATOR_H
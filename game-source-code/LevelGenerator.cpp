@@ -0,0 +1,196 @@
+#include "LevelGenerator.h"
+#include "GameRandom.h"
+#include "EnemyArchetypes.h"
+#include <algorithm>
+
+namespace {
+    const Coordinate PLAYER_START(Coordinate::PLAYABLE_START_ROW, 1);
+    const int MIN_CHAMBER_DISTANCE = 8;   ///< Chambers keep clear of the start pocket
+    const int MIN_ROCK_SPACING = 3;       ///< Manhattan distance between rocks
+    const int MIN_ROCK_START_DISTANCE = 6;
+    const int MAX_CHAMBERS = 6;
+}
+
+LevelLayout LevelGenerator::generate(int level, std::uint64_t seed) {
+    std::uint64_t savedRandom = GameRandom::getState();
+    GameRandom::seed(seed);
+
+    LevelLayout layout;
+    layout.level = level;
+    layout.seed = seed;
+    for (int row = Coordinate::PLAYABLE_START_ROW; row < LevelLayout::ROWS; ++row) {
+        for (int col = 0; col < LevelLayout::COLS; ++col) {
+            layout.blocked[row][col] = true;
+        }
+    }
+
+    clearRect(layout, Coordinate(Coordinate::PLAYABLE_START_ROW, 0),
+              Coordinate(Coordinate::PLAYABLE_START_ROW + 1, 3));
+    layout.playerSpawns.push_back(PLAYER_START);
+
+    int chamberCount = std::min(MAX_CHAMBERS, 3 + level / 3);
+    Chamber chambers[MAX_CHAMBERS];
+    for (int i = 0; i < chamberCount; ++i) {
+        chambers[i] = makeChamber();
+        clearRect(layout, chambers[i].topLeft, chambers[i].bottomRight);
+    }
+
+    int linkChance = std::min(90, 40 + 8 * level);
+    Coordinate previous(Coordinate::PLAYABLE_START_ROW + 1, 3);
+    for (int i = 0; i < chamberCount; ++i) {
+        Coordinate center = centerOf(chambers[i]);
+        if (GameRandom::nextInt(100) < linkChance) {
+            carveCorridor(layout, previous, center);
+        }
+        previous = center;
+    }
+
+    int walks = 2 + GameRandom::nextInt(2);
+    for (int i = 0; i < walks; ++i) {
+        carveRandomWalk(layout, centerOf(chambers[GameRandom::nextInt(chamberCount)]),
+                        5 + GameRandom::nextInt(8));
+    }
+
+    placeEnemies(layout, chambers, chamberCount);
+    placeRocks(layout);
+
+    GameRandom::setState(savedRandom);
+    return layout;
+}
+
+void LevelGenerator::clearRect(LevelLayout& layout, Coordinate topLeft,
+                               Coordinate bottomRight) {
+    for (int row = topLeft.row; row <= bottomRight.row; ++row) {
+        for (int col = topLeft.col; col <= bottomRight.col; ++col) {
+            if (Coordinate(row, col).isInPlayableArea()) {
+                layout.blocked[row][col] = false;
+            }
+        }
+    }
+}
+
+void LevelGenerator::carveCorridor(LevelLayout& layout, Coordinate from, Coordinate to) {
+    clearRect(layout, Coordinate(from.row, std::min(from.col, to.col)),
+              Coordinate(from.row, std::max(from.col, to.col)));
+    clearRect(layout, Coordinate(std::min(from.row, to.row), to.col),
+              Coordinate(std::max(from.row, to.row), to.col));
+}
+
+void LevelGenerator::carveRandomWalk(LevelLayout& layout, Coordinate start, int length) {
+    const Coordinate steps[] = {Coordinate(-1, 0), Coordinate(1, 0),
+                                Coordinate(0, -1), Coordinate(0, 1)};
+    Coordinate pos = start;
+    int direction = GameRandom::nextInt(4);
+
+    for (int i = 0; i < length; ++i) {
+        if (GameRandom::nextInt(4) == 0) {
+            direction = GameRandom::nextInt(4);
+        }
+        Coordinate next = pos + steps[direction];
+        if (!next.isInPlayableArea()) {
+            direction = GameRandom::nextInt(4);
+            continue;
+        }
+        pos = next;
+        layout.blocked[pos.row][pos.col] = false;
+    }
+}
+
+LevelGenerator::Chamber LevelGenerator::makeChamber() {
+    Chamber chamber;
+    for (int attempt = 0; attempt < 20; ++attempt) {
+        int width = 3 + GameRandom::nextInt(3);
+        int height = 2 + GameRandom::nextInt(2);
+        int top = 6 + GameRandom::nextInt(LevelLayout::ROWS - 1 - height - 6);
+        int left = 3 + GameRandom::nextInt(LevelLayout::COLS - 3 - width - 3);
+
+        chamber.topLeft = Coordinate(top, left);
+        chamber.bottomRight = Coordinate(top + height - 1, left + width - 1);
+        if (centerOf(chamber).manhattanDistance(PLAYER_START) >= MIN_CHAMBER_DISTANCE) {
+            break;
+        }
+    }
+    return chamber;
+}
+
+void LevelGenerator::placeEnemies(LevelLayout& layout, const Chamber* chambers,
+                                  int chamberCount) {
+    int enemyCount = std::min(3 + layout.level, 8);
+
+    for (int i = 0; i < enemyCount; ++i) {
+        EnemyType type;
+        if (i == 0) {
+            type = EnemyType::GREEN_DRAGON;
+        } else if (i == 1) {
+            type = EnemyType::RED_MONSTER;
+        } else {
+            type = EnemyArchetypes::pickSpawnType(layout.level);
+        }
+
+        const Chamber& chamber = chambers[i % chamberCount];
+        Coordinate spawn = centerOf(chamber);
+        for (int attempt = 0; attempt < 10; ++attempt) {
+            Coordinate candidate(
+                chamber.topLeft.row + GameRandom::nextInt(chamber.bottomRight.row - chamber.topLeft.row + 1),
+                chamber.topLeft.col + GameRandom::nextInt(chamber.bottomRight.col - chamber.topLeft.col + 1));
+            if (std::find(layout.enemySpawns.begin(), layout.enemySpawns.end(), candidate)
+                == layout.enemySpawns.end()) {
+                spawn = candidate;
+                break;
+            }
+        }
+
+        layout.enemySpawns.push_back(spawn);
+        layout.enemyTypes.push_back(type);
+    }
+}
+
+void LevelGenerator::placeRocks(LevelLayout& layout) {
+    int rockCount = std::min(4 + layout.level / 2, 10);
+    const int attempts = 300;
+
+    for (int attempt = 0; attempt < attempts &&
+         static_cast<int>(layout.rockSpawns.size()) < rockCount; ++attempt) {
+        Coordinate pos(5 + GameRandom::nextInt(LevelLayout::ROWS - 8),
+                       2 + GameRandom::nextInt(LevelLayout::COLS - 4));
+
+        // Rocks sit on earth so they never fall on their own
+        if (!layout.blocked[pos.row][pos.col] || !layout.blocked[pos.row + 1][pos.col]) {
+            continue;
+        }
+        if (pos.manhattanDistance(PLAYER_START) < MIN_ROCK_START_DISTANCE) {
+            continue;
+        }
+
+        bool crowded = false;
+        for (const auto& rock : layout.rockSpawns) {
+            if (rock.manhattanDistance(pos) < MIN_ROCK_SPACING) {
+                crowded = true;
+                break;
+            }
+        }
+        if (crowded) {
+            continue;
+        }
+
+        // First half of the attempts only accept rocks that can drop into a tunnel
+        bool overTunnel = false;
+        for (int below = 2; below <= 4; ++below) {
+            if (layout.isOpen(Coordinate(pos.row + below, pos.col))) {
+                overTunnel = true;
+                break;
+            }
+        }
+        if (!overTunnel && attempt < attempts / 2) {
+            continue;
+        }
+
+        layout.blocked[pos.row][pos.col] = false;
+        layout.rockSpawns.push_back(pos);
+    }
+}
+
+Coordinate LevelGenerator::centerOf(const Chamber& chamber) {
+    return Coordinate((chamber.topLeft.row + chamber.bottomRight.row) / 2,
+                      (chamber.topLeft.col + chamber.bottomRight.col) / 2);
+}
@@ -0,0 +1,56 @@
+#ifndef LEVELGENERATOR_H
+#define LEVELGENERATOR_H
+
+#include <cstdint>
+#include "LevelLayout.h"
+
+/**
+ * @file LevelGenerator.h
+ * @brief Seeded procedural terrain, chamber, rock and enemy placement
+ */
+
+/**
+ * @class LevelGenerator
+ * @brief Builds a LevelLayout from a level number and a seed
+ *
+ * Generation steps:
+ * 1. Solid earth below the HUD, open starting pocket top-left
+ * 2. Chambers (small open rectangles) away from the player start
+ * 3. Corridors linking chambers - link chance grows with level, so
+ *    later levels give enemies open routes to the player
+ * 4. A few random-walk side tunnels
+ * 5. Enemies spread over chambers (same type mix as LevelManager)
+ * 6. Rocks resting on earth, preferring spots above tunnels
+ *
+ * Counts follow LevelManager: 3 + level enemies (max 8) and
+ * 4 + level/2 rocks (max 10).
+ *
+ * @note Same level and seed always give the same layout; the calling
+ *       thread's GameRandom state is left untouched
+ */
+class LevelGenerator {
+public:
+    /**
+     * @brief Generate a layout
+     * @param level Level number (drives density and counts)
+     * @param seed Generator seed
+     * @return LevelLayout Complete layout (score left at 0)
+     */
+    static LevelLayout generate(int level, std::uint64_t seed);
+
+private:
+    struct Chamber {
+        Coordinate topLeft;
+        Coordinate bottomRight;
+    };
+
+    static void clearRect(LevelLayout& layout, Coordinate topLeft, Coordinate bottomRight);
+    static void carveCorridor(LevelLayout& layout, Coordinate from, Coordinate to);
+    static void carveRandomWalk(LevelLayout& layout, Coordinate start, int length);
+    static Chamber makeChamber();
+    static void placeEnemies(LevelLayout& layout, const Chamber* chambers, int chamberCount);
+    static void placeRocks(LevelLayout& layout);
+    static Coordinate centerOf(const Chamber& chamber);
+};
+
+#endif // LEVELGENERATOR_H
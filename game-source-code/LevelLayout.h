@@ -0,0 +1,46 @@
+#ifndef LEVELLAYOUT_H
+#define LEVELLAYOUT_H
+
+#include <cstdint>
+#include <vector>
+#include "Coordinate.h"
+#include "Enemy.h"
+
+/**
+ * @file LevelLayout.h
+ * @brief Plain description of a level: terrain cells and spawns
+ */
+
+/**
+ * @struct LevelLayout
+ * @brief Everything needed to set up a level without a map file
+ *
+ * Produced by LevelGenerator, ranked by LevelEvaluator and applied with
+ * BlockGrid::applyLayout() + LevelManager::initializeLevel().
+ * Unlike map files it also fixes enemy types, so a layout plays the
+ * same way every time it is loaded.
+ */
+struct LevelLayout {
+    static const int ROWS = Coordinate::WORLD_ROWS;
+    static const int COLS = Coordinate::WORLD_COLS;
+
+    bool blocked[ROWS][COLS] = {};        ///< true = earth
+    std::vector<Coordinate> playerSpawns;
+    std::vector<Coordinate> enemySpawns;
+    std::vector<EnemyType> enemyTypes;    ///< Parallel to enemySpawns
+    std::vector<Coordinate> rockSpawns;
+    int level = 0;
+    std::uint64_t seed = 0;               ///< Generator seed (reproduces the layout)
+    float score = 0.0f;                   ///< Evaluator rating (higher is better)
+
+    /**
+     * @brief Check for an open (dug) playable cell
+     * @param pos Cell to test
+     * @return false for earth and anything outside the playable area
+     */
+    bool isOpen(Coordinate pos) const {
+        return pos.isInPlayableArea() && !blocked[pos.row][pos.col];
+    }
+};
+
+#endif // LEVELLAYOUT_H
@@ -1,18 +1,33 @@
 #include "LevelManager.h"
-#include <iostream>
+#include "StateSerializer.h"
+#include "GameLog.h"
+#include "GameRandom.h"
+#include "LevelLayout.h"
+#include "DistanceField.h"
+#include "EnemyArchetypes.h"
+#include "GameTuning.h"
+#include "MemoryTracker.h"
+#include <algorithm>
 #include <cstdlib>
+#include <fstream>
 
 LevelManager::LevelManager() : currentLevel(1), targetScore(1000), 
-                               nextPowerUpTime(15.0f) {
+                               nextPowerUpTime(GameTuning::get().firstPowerUpTime) {
 }
 
 void LevelManager::initializeLevel(int level, BlockGrid& terrain, Player& player, 
                                   std::vector<Enemy>& enemies, 
                                   std::vector<PowerUp>& powerUps,
-                                  std::vector<Rock>& rocks) {
+                                  std::vector<Rock>& rocks, const LevelLayout* layout) {
     currentLevel = level;
-    std::string mapFile = getLevelMapFile(level);
-    terrain.importMapFromFile(mapFile);
+    {
+        MemoryScope memory(MemoryTag::TERRAIN);
+        if (layout) {
+            terrain.applyLayout(*layout);
+        } else {
+            terrain.importMapFromFile(getLevelMapFile(level));
+        }
+    }
     
     enemies.clear();
     powerUps.clear();
@@ -20,46 +35,44 @@ void LevelManager::initializeLevel(int level, BlockGrid& terrain, Player& player
     
     player.reset(Coordinate(Coordinate::PLAYABLE_START_ROW, 1));
     
-    spawnEnemies(enemies);
+    {
+        MemoryScope memory(MemoryTag::ENEMIES);
+        if (layout) {
+            for (size_t i = 0; i < layout->enemySpawns.size(); ++i) {
+                enemies.emplace_back(layout->enemySpawns[i], layout->enemyTypes[i]);
+            }
+        } else {
+            spawnEnemies(enemies, terrain);
+        }
+    }
     spawnRocks(rocks, terrain);
     
-    nextPowerUpTime = 15.0f;
+    nextPowerUpTime = GameTuning::get().firstPowerUpTime;
     
-    std::cout << "Level " << level << " initialized" << std::endl;
+    GameLog::info() << "Level " << level << " initialized" << std::endl;
 }
 
-void LevelManager::spawnEnemies(std::vector<Enemy>& enemies) {
+void LevelManager::spawnEnemies(std::vector<Enemy>& enemies, const BlockGrid& terrain) {
     int numEnemies = 3 + currentLevel;
     numEnemies = std::min(numEnemies, 8);
     
     Coordinate spawnPos;
     
-    spawnPos = findValidSpawnPosition(Player(Coordinate(Coordinate::PLAYABLE_START_ROW, 1)));
+    spawnPos = findEnemySpawnPosition(terrain, enemies);
     enemies.emplace_back(spawnPos, EnemyType::GREEN_DRAGON);
-    std::cout << "  Spawned GREEN_DRAGON" << std::endl;
+    GameLog::info() << "  Spawned GREEN_DRAGON" << std::endl;
     
-    spawnPos = findValidSpawnPosition(Player(Coordinate(Coordinate::PLAYABLE_START_ROW, 1)));
+    spawnPos = findEnemySpawnPosition(terrain, enemies);
     enemies.emplace_back(spawnPos, EnemyType::RED_MONSTER);
-    std::cout << "  Spawned RED_MONSTER" << std::endl;
+    GameLog::info() << "  Spawned RED_MONSTER" << std::endl;
     
     for (int i = 2; i < numEnemies; ++i) {
-        spawnPos = findValidSpawnPosition(Player(Coordinate(Coordinate::PLAYABLE_START_ROW, 1)));
-        
-        EnemyType type;
-        int typeRoll = std::rand() % 100;
-        
-        if (typeRoll < 30) {
-            type = EnemyType::GREEN_DRAGON;
-        } else if (typeRoll < 60) {
-            type = EnemyType::AGGRESSIVE_MONSTER;
-        } else {
-            type = EnemyType::RED_MONSTER;
-        }
+        spawnPos = findEnemySpawnPosition(terrain, enemies);
         
-        enemies.emplace_back(spawnPos, type);
+        enemies.emplace_back(spawnPos, EnemyArchetypes::pickSpawnType(currentLevel));
     }
     
-    std::cout << "Spawned " << enemies.size() << " enemies total" << std::endl;
+    GameLog::info() << "Spawned " << enemies.size() << " enemies total" << std::endl;
 }
 
 void LevelManager::spawnRocks(std::vector<Rock>& rocks, const BlockGrid& terrain) {
@@ -73,8 +86,8 @@ void LevelManager::spawnRocks(std::vector<Rock>& rocks, const BlockGrid& terrain
             int sectionWidth = Coordinate::WORLD_COLS / 3;
             int section = i % 3;
             
-            int col = (section * sectionWidth) + 3 + (std::rand() % (sectionWidth - 6));
-            int row = Coordinate::PLAYABLE_START_ROW + 3 + (std::rand() % 8);
+            int col = (section * sectionWidth) + 3 + GameRandom::nextInt(sectionWidth - 6);
+            int row = Coordinate::PLAYABLE_START_ROW + 3 + GameRandom::nextInt(8);
             
             if (col < 8 && row < Coordinate::PLAYABLE_START_ROW + 5) {
                 col += 8;
@@ -88,43 +101,54 @@ void LevelManager::spawnRocks(std::vector<Rock>& rocks, const BlockGrid& terrain
         }
         
         int extraRocks = std::max(0, (4 + currentLevel / 2) - static_cast<int>(rockSpawns.size()));
-        for (int i = 0; i < extraRocks; ++i) {
-            Coordinate pos = findValidRockPosition(rockSpawns);
-            rocks.emplace_back(pos);
+        if (extraRocks == 0) {
+            return;
         }
-    }
-}
-
-Coordinate LevelManager::findValidRockPosition(const std::vector<Coordinate>& existingRocks) const {
-    for (int attempts = 0; attempts < 50; ++attempts) {
-        int row = Coordinate::PLAYABLE_START_ROW + 2 + (std::rand() % 10);
-        int col = 5 + (std::rand() % (Coordinate::WORLD_COLS - 10));
-        Coordinate pos(row, col);
         
-        bool tooClose = false;
-        for (const auto& existing : existingRocks) {
-            if (pos.calculateDistance(existing) < 4.0f) {
-                tooClose = true;
-                break;
-            }
+        // Valid cells: >8 from the player start and >=4 from every rock
+        Coordinate playerStart(Coordinate::PLAYABLE_START_ROW, 1);
+        DistanceField startField;
+        startField.addSource(playerStart);
+        std::vector<Coordinate> candidates;
+        startField.collectCellsBeyond(DistanceMetric::EUCLIDEAN_SQUARED, 8 * 8,
+                                      Coordinate(Coordinate::PLAYABLE_START_ROW + 2, 5),
+                                      Coordinate(Coordinate::PLAYABLE_START_ROW + 11, 
+                                                 Coordinate::WORLD_COLS - 6),
+                                      candidates);
+        
+        DistanceField rockField;
+        for (const auto& rockPos : rockSpawns) {
+            rockField.addSource(rockPos);
         }
+        rockField.discardCellsWithin(candidates, DistanceMetric::EUCLIDEAN_SQUARED, 4 * 4 - 1);
         
-        Coordinate playerStart(Coordinate::PLAYABLE_START_ROW, 1);
-        if (!tooClose && pos.calculateDistance(playerStart) > 8.0f) {
-            return pos;
+        for (int i = 0; i < extraRocks && !candidates.empty(); ++i) {
+            Coordinate pos = candidates[GameRandom::nextInt(static_cast<int>(candidates.size()))];
+            rocks.emplace_back(pos);
+            rockField.addSource(pos);
+            rockField.discardCellsWithin(candidates, DistanceMetric::EUCLIDEAN_SQUARED, 4 * 4 - 1);
         }
     }
-    
-    return Coordinate(12, 15);
 }
 
 bool LevelManager::shouldSpawnPowerUp(float levelTimer) const {
     return levelTimer >= nextPowerUpTime;
 }
 
-PowerUp LevelManager::createRandomPowerUp() {
-    Coordinate spawnPos = findValidSpawnPosition(
-        Player(Coordinate(Coordinate::PLAYABLE_START_ROW, 1)));
+PowerUp LevelManager::createRandomPowerUp(const BlockGrid& terrain, Coordinate playerPos) {
+    std::vector<Coordinate> reachable;
+    for (int row = Coordinate::PLAYABLE_START_ROW; row < Coordinate::WORLD_ROWS; ++row) {
+        for (int col = 0; col < Coordinate::WORLD_COLS; ++col) {
+            Coordinate cell(row, col);
+            if (cell.manhattanDistance(playerPos) > 4 && terrain.areConnected(cell, playerPos)) {
+                reachable.push_back(cell);
+            }
+        }
+    }
+    
+    Coordinate spawnPos = reachable.empty() 
+        ? findValidSpawnPosition(Coordinate(Coordinate::PLAYABLE_START_ROW, 1))
+        : reachable[GameRandom::nextInt(static_cast<int>(reachable.size()))];
     
     PowerUpType types[] = {
         PowerUpType::EXTRA_LIFE,
@@ -134,12 +158,12 @@ PowerUp LevelManager::createRandomPowerUp() {
         PowerUpType::SPEED_BOOST
     };
     
-    PowerUpType selectedType = types[std::rand() % 5];
+    PowerUpType selectedType = types[GameRandom::nextInt(5)];
     return PowerUp(spawnPos, selectedType);
 }
 
 void LevelManager::updatePowerUpSpawnTime(float levelTimer) {
-    nextPowerUpTime = levelTimer + 20.0f + (std::rand() % 10);
+    nextPowerUpTime = levelTimer + GameTuning::get().powerUpInterval + GameRandom::nextInt(10);
 }
 
 bool LevelManager::isLevelComplete(const std::vector<Enemy>& enemies, 
@@ -156,7 +180,7 @@ bool LevelManager::isLevelComplete(const std::vector<Enemy>& enemies,
 }
 
 int LevelManager::calculateTimeBonus(float levelTimer, int level) const {
-    float maxTime = 180.0f;
+    float maxTime = GameTuning::get().levelTimeLimit;
     float timeRatio = std::max(0.0f, (maxTime - levelTimer) / maxTime);
     float bonusMultiplier = 1.0f + (level - 1) * 0.2f;
     return static_cast<int>(1000 * timeRatio * bonusMultiplier);
@@ -170,23 +194,73 @@ void LevelManager::nextLevel() {
 void LevelManager::reset() {
     currentLevel = 1;
     targetScore = 1000;
-    nextPowerUpTime = 15.0f;
+    nextPowerUpTime = GameTuning::get().firstPowerUpTime;
 }
 
-Coordinate LevelManager::findValidSpawnPosition(const Player& player) const {
-    for (int attempts = 0; attempts < 50; ++attempts) {
-        int row = Coordinate::PLAYABLE_START_ROW + 2 + 
-                 (std::rand() % (Coordinate::PLAYABLE_ROWS - 5));
-        int col = 5 + (std::rand() % (Coordinate::WORLD_COLS - 10));
-        Coordinate pos(row, col);
-        
-        if (pos.calculateDistance(player.getPosition()) > 6.0f) {
-            return pos;
+Coordinate LevelManager::findValidSpawnPosition(Coordinate avoid) const {
+    DistanceField field;
+    field.addSource(avoid);
+    std::vector<Coordinate> candidates;
+    field.collectCellsBeyond(DistanceMetric::EUCLIDEAN_SQUARED, 6 * 6,
+                             Coordinate(Coordinate::PLAYABLE_START_ROW + 2, 5),
+                             Coordinate(Coordinate::WORLD_ROWS - 4, Coordinate::WORLD_COLS - 6),
+                             candidates);
+    
+    if (candidates.empty()) {
+        return Coordinate(15, 20);
+    }
+    return candidates[GameRandom::nextInt(static_cast<int>(candidates.size()))];
+}
+
+bool LevelManager::hasMapFile(int level) const {
+    std::ifstream file(getLevelMapFile(level));
+    return file.is_open();
+}
+
+Coordinate LevelManager::findEnemySpawnPosition(const BlockGrid& terrain, 
+                                                const std::vector<Enemy>& placed) const {
+    Coordinate playerStart(Coordinate::PLAYABLE_START_ROW, 1);
+    std::vector<Coordinate> rockCells = terrain.getRockSpawns();
+    std::vector<Coordinate> pockets;
+    
+    for (int row = Coordinate::PLAYABLE_START_ROW + 2; row < Coordinate::WORLD_ROWS; ++row) {
+        for (int col = 0; col < Coordinate::WORLD_COLS; ++col) {
+            Coordinate cell(row, col);
+            if (terrain.isLocationBlocked(cell) || terrain.areConnected(cell, playerStart) ||
+                cell.distanceSquared(playerStart) <= 6 * 6) {
+                continue;
+            }
+            bool taken = std::find(rockCells.begin(), rockCells.end(), cell) != rockCells.end();
+            for (const auto& enemy : placed) {
+                if (enemy.getPosition() == cell) {
+                    taken = true;
+                    break;
+                }
+            }
+            if (!taken) {
+                pockets.push_back(cell);
+            }
         }
     }
-    return Coordinate(15, 20);
+    
+    if (pockets.empty()) {
+        return findValidSpawnPosition(playerStart);
+    }
+    return pockets[GameRandom::nextInt(static_cast<int>(pockets.size()))];
 }
 
 std::string LevelManager::getLevelMapFile(int level) const {
     return "resources/maps/level" + std::to_string(level) + ".txt";
 }
+
+void LevelManager::serialize(StateWriter& writer) const {
+    writer.write(currentLevel);
+    writer.write(targetScore);
+    writer.write(nextPowerUpTime);
+}
+
+void LevelManager::deserialize(StateReader& reader) {
+    reader.read(currentLevel);
+    reader.read(targetScore);
+    reader.read(nextPowerUpTime);
+}
@@ -7,8 +7,13 @@
 #include "PowerUp.h"
 #include "Rock.h"
 #include "Coordinate.h"
+#include <string>
 #include <vector>
 
+class StateWriter;
+class StateReader;
+struct LevelLayout;
+
 /**
  * @file LevelManager.h
  * @brief Level progression and entity spawning system
@@ -27,14 +32,18 @@
  * 
  * Level progression system:
  * - Level 1-2: Use custom map files (level1.txt, level2.txt)
- * - Level 3+: Procedural default maps
+ * - Levels without a map file: LevelLayout from LevelGenerator
+ *   (chosen by LevelEvaluator, see GameSimulation)
  * - Enemy count: 3 + level (capped at 8)
  * - Rock count: 4 + level/2 (capped at 10)
  * - Target score: Increases by 1000 per level
  * 
  * Spawning strategy:
- * - Enemies: Randomized types with GREEN_DRAGON and RED_MONSTER guaranteed
+ * - Enemies: Randomized types with GREEN_DRAGON and RED_MONSTER guaranteed,
+ *   placed in open pockets not connected to the player's tunnel
  * - Rocks: Spread across 3 sections, avoid player start area
+ * - Random placement picks from the cells a DistanceField marks valid
+ *   (no retry loops; extra rocks update the field as they are placed)
  * - PowerUps: Spawn every 20-30 seconds during play
  * 
  * Completion conditions:
@@ -60,10 +69,19 @@ public:
      * @param enemies Enemy vector to populate
      * @param powerUps PowerUp vector to clear
      * @param rocks Rock vector to populate
+     * @param layout Generated layout to use instead of the level's map
+     *        file (enemy positions and types come from the layout)
      */
     void initializeLevel(int level, BlockGrid& terrain, Player& player, 
                         std::vector<Enemy>& enemies, std::vector<PowerUp>& powerUps,
-                        std::vector<Rock>& rocks);
+                        std::vector<Rock>& rocks, const LevelLayout* layout = nullptr);
+    
+    /**
+     * @brief Check whether a hand-made map exists for a level
+     * @param level Level number
+     * @return true if the level's map file can be opened
+     */
+    bool hasMapFile(int level) const;
     
     /**
      * @brief Check if should spawn power-up
@@ -74,9 +92,12 @@ public:
     
     /**
      * @brief Create random power-up at valid position
+     * @param terrain Current terrain (tunnel index)
+     * @param playerPos Player position
      * @return PowerUp Newly created power-up
+     * @note Prefers cells in the player's tunnel, reachable without digging
      */
-    PowerUp createRandomPowerUp();
+    PowerUp createRandomPowerUp(const BlockGrid& terrain, Coordinate playerPos);
     
     /**
      * @brief Update next power-up spawn time
@@ -113,11 +134,24 @@ public:
     int getCurrentLevel() const { return currentLevel; }
     int getTargetScore() const { return targetScore; }
 
+    /**
+     * @brief Write level number, target score and power-up schedule to a state snapshot
+     * @param writer Destination
+     */
+    void serialize(StateWriter& writer) const;
+    
+    /**
+     * @brief Restore state written by serialize()
+     * @param reader Source
+     */
+    void deserialize(StateReader& reader);
+
 private:
-    void spawnEnemies(std::vector<Enemy>& enemies);
+    void spawnEnemies(std::vector<Enemy>& enemies, const BlockGrid& terrain);
     void spawnRocks(std::vector<Rock>& rocks, const BlockGrid& terrain);
-    Coordinate findValidSpawnPosition(const Player& player) const;
-    Coordinate findValidRockPosition(const std::vector<Coordinate>& existingRocks) const;
+    Coordinate findValidSpawnPosition(Coordinate avoid) const;
+    Coordinate findEnemySpawnPosition(const BlockGrid& terrain, 
+                                      const std::vector<Enemy>& placed) const;
     std::string getLevelMapFile(int level) const;
 };
 
@@ -0,0 +1,62 @@
+#ifndef LIVETABLE_H
+#define LIVETABLE_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @file LiveTable.h
+ * @brief Read-mostly value that can be replaced while other threads read it
+ */
+
+/**
+ * @class LiveTable
+ * @brief Publishes immutable copies of a config table through one atomic pointer
+ *
+ * Used for data that is read every tick but replaced only when a
+ * config file is edited (enemy archetypes, tuning values):
+ * - get() is a single acquire load, no lock
+ * - install() copies the new value and swaps the pointer; the old copy
+ *   is retired rather than freed, so a reader on another thread that
+ *   still holds it stays valid
+ * - Retired copies cost a few hundred bytes per edit and are released
+ *   at exit
+ *
+ * @tparam T Trivially copyable table type
+ */
+template <typename T>
+class LiveTable {
+private:
+    const T builtIn;
+    std::atomic<const T*> live;
+    std::mutex mutex;
+    std::vector<std::unique_ptr<T>> retired;
+
+public:
+    explicit LiveTable(const T& defaults) : builtIn(defaults), live(&builtIn) {}
+
+    LiveTable(const LiveTable&) = delete;
+    LiveTable& operator=(const LiveTable&) = delete;
+
+    const T& get() const {
+        return *live.load(std::memory_order_acquire);
+    }
+
+    const T& defaults() const {
+        return builtIn;
+    }
+
+    void install(const T& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        retired.push_back(std::make_unique<T>(value));
+        live.store(retired.back().get(), std::memory_order_release);
+    }
+
+    void reset() {
+        live.store(&builtIn, std::memory_order_release);
+    }
+};
+
+#endif // LIVETABLE_H
@@ -0,0 +1,75 @@
+#ifndef LOCALWORLDVIEW_H
+#define LOCALWORLDVIEW_H
+
+#include "Coordinate.h"
+#include "Direction.h"
+#include "BlockGrid.h"
+#include <cstdint>
+
+/**
+ * @file LocalWorldView.h
+ * @brief Small copyable snapshot of the world around one enemy
+ */
+
+/**
+ * @struct LocalWorldView
+ * @brief Terrain window plus player state for cheap what-if searches
+ *
+ * Holds a (2 * RADIUS + 1)² window of earth cells centred on the enemy
+ * and the player's cell, heading and move interval. It is plain data
+ * (about 300 bytes), so a search can copy it freely instead of cloning
+ * the whole simulation.
+ *
+ * Cells outside the window count as blocked, which makes predictions
+ * conservative: anything the window cannot see is assumed to stop a
+ * projectile.
+ */
+struct LocalWorldView {
+    static const int RADIUS = 8;
+    static const int SIZE = 2 * RADIUS + 1;
+
+    Coordinate origin;                    ///< World cell at window (0, 0)
+    Coordinate player;                    ///< Player cell
+    Direction playerHeading;              ///< Player's move direction (NONE = standing)
+    float playerMoveInterval;             ///< Seconds between player steps
+    std::uint8_t blocked[SIZE][SIZE];     ///< 1 = earth
+
+    /**
+     * @brief Copy the window around a cell out of the live grid
+     * @param terrain Live terrain
+     * @param center Window centre (the enemy)
+     * @param playerPos Player cell
+     * @param heading Player heading (NONE if not moving)
+     * @param moveInterval Player seconds per step
+     */
+    static LocalWorldView capture(const BlockGrid& terrain, Coordinate center, 
+                                  Coordinate playerPos, Direction heading, 
+                                  float moveInterval) {
+        LocalWorldView view;
+        view.origin = Coordinate(center.row - RADIUS, center.col - RADIUS);
+        view.player = playerPos;
+        view.playerHeading = heading;
+        view.playerMoveInterval = moveInterval;
+        for (int row = 0; row < SIZE; ++row) {
+            for (int col = 0; col < SIZE; ++col) {
+                Coordinate cell(view.origin.row + row, view.origin.col + col);
+                view.blocked[row][col] = !cell.isWithinBounds() || terrain.isLocationBlocked(cell);
+            }
+        }
+        return view;
+    }
+
+    /**
+     * @brief Check a world cell (outside the window = blocked)
+     */
+    bool isBlocked(Coordinate cell) const {
+        int row = cell.row - origin.row;
+        int col = cell.col - origin.col;
+        if (row < 0 || row >= SIZE || col < 0 || col >= SIZE) {
+            return true;
+        }
+        return blocked[row][col] != 0;
+    }
+};
+
+#endif // LOCALWORLDVIEW_H
@@ -0,0 +1,157 @@
+#ifndef LOOPBACKSESSION_H
+#define LOOPBACKSESSION_H
+
+#include <deque>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include "GameSimulation.h"
+#include "RollbackBuffer.h"
+#include "GameClock.h"
+#include "GameRandom.h"
+#include "GameConstants.h"
+
+/**
+ * @file LoopbackSession.h
+ * @brief Two simulations joined by a fake delayed link
+ */
+
+/**
+ * @class LoopbackSession
+ * @brief Stand-in for a networked session to exercise input correction
+ *
+ * Two peers run the same simulation in one thread:
+ * - Host applies local input immediately (authoritative)
+ * - Remote receives the same input latencyTicks later, predicts in the
+ *   meantime (held buttons repeat, one-shot presses do not) and rolls
+ *   back through its RollbackBuffer when a prediction was wrong
+ *
+ * After flush() both peers must hold byte-identical state - the check
+ * a real link would rely on.
+ *
+ * Each peer keeps its own GameClock time and GameRandom state, swapped
+ * in around its step, since both are per-thread.
+ *
+ * @note Latency must stay below ROLLBACK_WINDOW_TICKS
+ * @note Puts GameClock into fixed-step mode for the calling thread
+ */
+class LoopbackSession {
+private:
+    struct Peer {
+        GameSimulation simulation;
+        RollbackBuffer history{GameConstants::ROLLBACK_WINDOW_TICKS};
+        double clockTime = 0.0;
+        std::uint64_t randomState = 0;
+    };
+
+    struct Packet {
+        unsigned int tick;
+        InputFrame input;
+        int deliverAt;
+    };
+
+    Peer host;
+    Peer remote;
+    std::deque<Packet> link;
+    InputFrame lastConfirmed;
+    int latencyTicks;
+    int stepCount;
+    int corrections;
+    int resimulatedTicks;
+
+public:
+    /**
+     * @brief Start both peers from the same state
+     * @param latency One-way input delay in ticks (at least 1)
+     * @param startTime Clock time of tick 0
+     */
+    explicit LoopbackSession(int latency, double startTime = 0.0)
+        : latencyTicks(std::max(1, std::min(latency, GameConstants::ROLLBACK_WINDOW_TICKS - 1))),
+          stepCount(0), corrections(0), resimulatedTicks(0) {
+        GameClock::setFixedStep(GameConstants::SIMULATION_TICK, startTime);
+
+        std::vector<unsigned char> initial;
+        host.simulation.saveState(initial);
+        remote.simulation.restoreState(initial);
+        leave(host);
+        leave(remote);
+        host.history.reset(host.simulation);
+        remote.history.reset(remote.simulation);
+    }
+
+    /**
+     * @brief Advance both peers one tick
+     * @param input Host's local input for this tick
+     */
+    void step(const InputFrame& input) {
+        enter(host);
+        link.push_back({host.simulation.getTick(), input, stepCount + latencyTicks});
+        host.history.advance(host.simulation, input);
+        leave(host);
+
+        enter(remote);
+        deliver(stepCount);
+        InputFrame predicted;
+        predicted.held = lastConfirmed.held;
+        remote.history.advance(remote.simulation, predicted);
+        leave(remote);
+
+        stepCount++;
+    }
+
+    /**
+     * @brief Deliver every input still in flight
+     */
+    void flush() {
+        enter(remote);
+        deliver(stepCount + latencyTicks);
+        leave(remote);
+    }
+
+    /**
+     * @brief Check whether both peers hold identical state
+     */
+    bool isSynchronized() const {
+        std::vector<unsigned char> hostState;
+        std::vector<unsigned char> remoteState;
+        host.simulation.saveState(hostState);
+        remote.simulation.saveState(remoteState);
+        // saveState records the calling thread's clock and RNG, so the
+        // per-peer copies are compared separately
+        return hostState == remoteState &&
+               host.clockTime == remote.clockTime &&
+               host.randomState == remote.randomState;
+    }
+
+    const GameSimulation& getHost() const { return host.simulation; }
+    const GameSimulation& getRemote() const { return remote.simulation; }
+    int getCorrections() const { return corrections; }
+    int getResimulatedTicks() const { return resimulatedTicks; }
+
+private:
+    void enter(Peer& peer) {
+        GameClock::setTime(peer.clockTime);
+        GameRandom::setState(peer.randomState);
+    }
+
+    void leave(Peer& peer) {
+        peer.clockTime = GameClock::now();
+        peer.randomState = GameRandom::getState();
+    }
+
+    void deliver(int upToStep) {
+        while (!link.empty() && link.front().deliverAt <= upToStep) {
+            const Packet& packet = link.front();
+            int replayed = remote.history.correctInput(remote.simulation, packet.tick,
+                                                       packet.input);
+            if (replayed > 0) {
+                corrections++;
+                resimulatedTicks += replayed;
+            }
+            lastConfirmed = packet.input;
+            link.pop_front();
+        }
+    }
+};
+
+#endif // LOOPBACKSESSION_H
@@ -0,0 +1,231 @@
+#include "MemoryTracker.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    const int TAGS = static_cast<int>(MemoryTag::COUNT);
+
+    // Header in front of every tracked block; keeps the block aligned
+    // for any fundamental type, as malloc does
+    struct alignas(alignof(std::max_align_t)) BlockHeader {
+        std::size_t size;
+        MemoryTag tag;
+    };
+
+    // Zero-initialized statics: valid before any dynamic initialization,
+    // since operator new may run that early
+    struct TagCounters {
+        std::atomic<std::int64_t> bytes;
+        std::atomic<std::int64_t> peakBytes;
+        std::atomic<std::uint64_t> allocations;
+        std::atomic<std::uint64_t> frees;
+        std::atomic<std::int64_t> inlineBytes;
+        std::atomic<std::int64_t> budgetBytes;
+    };
+    TagCounters counters[TAGS];
+
+    thread_local MemoryTag threadTag = MemoryTag::GENERAL;
+
+    const char* const TAG_NAMES[TAGS] = {
+        "general", "terrain", "enemies", "projectiles", "particles", "ui_text"
+    };
+
+    void raisePeak(TagCounters& tag, std::int64_t bytes) {
+        std::int64_t peak = tag.peakBytes.load(std::memory_order_relaxed);
+        while (bytes > peak &&
+               !tag.peakBytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {
+        }
+    }
+
+    void* allocateOrThrow(std::size_t size) {
+        while (true) {
+            if (void* block = MemoryTracker::allocate(size)) {
+                return block;
+            }
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+    }
+}
+
+MemoryTracker::Usage MemoryTracker::usage(MemoryTag tag) {
+    const TagCounters& source = counters[static_cast<int>(tag)];
+    Usage result;
+    result.bytes = source.bytes.load(std::memory_order_relaxed);
+    result.peakBytes = source.peakBytes.load(std::memory_order_relaxed);
+    result.allocations = source.allocations.load(std::memory_order_relaxed);
+    result.frees = source.frees.load(std::memory_order_relaxed);
+    result.inlineBytes = source.inlineBytes.load(std::memory_order_relaxed);
+    result.budgetBytes = source.budgetBytes.load(std::memory_order_relaxed);
+    return result;
+}
+
+MemoryTracker::Usage MemoryTracker::total() {
+    Usage sum;
+    for (int i = 0; i < TAGS; ++i) {
+        Usage tag = usage(static_cast<MemoryTag>(i));
+        sum.bytes += tag.bytes;
+        sum.peakBytes += tag.peakBytes;
+        sum.allocations += tag.allocations;
+        sum.frees += tag.frees;
+        sum.inlineBytes += tag.inlineBytes;
+        sum.budgetBytes += tag.budgetBytes;
+    }
+    return sum;
+}
+
+const char* MemoryTracker::tagName(MemoryTag tag) {
+    int index = static_cast<int>(tag);
+    return index >= 0 && index < TAGS ? TAG_NAMES[index] : "unknown";
+}
+
+bool MemoryTracker::tagFromName(const std::string& name, MemoryTag& tag) {
+    for (int i = 0; i < TAGS; ++i) {
+        if (name == TAG_NAMES[i]) {
+            tag = static_cast<MemoryTag>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+void MemoryTracker::addInlineBytes(MemoryTag tag, std::int64_t bytes) {
+    counters[static_cast<int>(tag)].inlineBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void MemoryTracker::setBudget(MemoryTag tag, std::int64_t bytes) {
+    counters[static_cast<int>(tag)].budgetBytes.store(bytes, std::memory_order_relaxed);
+}
+
+bool MemoryTracker::isOverBudget(MemoryTag tag) {
+    Usage tagUsage = usage(tag);
+    return tagUsage.budgetBytes > 0 && tagUsage.peakBytes > tagUsage.budgetBytes;
+}
+
+void MemoryTracker::resetPeaks() {
+    for (TagCounters& tag : counters) {
+        tag.peakBytes.store(tag.bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+std::string MemoryTracker::report() {
+    std::string text = "Memory by subsystem (KiB):\n";
+    char line[160];
+    std::snprintf(line, sizeof(line), "  %-12s %10s %10s %12s %10s %10s\n",
+                  "subsystem", "live", "peak", "allocations", "inline", "budget");
+    text += line;
+
+    auto row = [&](const char* name, const Usage& entry, bool over) {
+        char budget[24] = "-";
+        if (entry.budgetBytes > 0) {
+            std::snprintf(budget, sizeof(budget), "%.1f", entry.budgetBytes / 1024.0);
+        }
+        std::snprintf(line, sizeof(line), "  %-12s %10.1f %10.1f %12llu %10.1f %10s%s\n",
+                      name, entry.bytes / 1024.0, entry.peakBytes / 1024.0,
+                      static_cast<unsigned long long>(entry.allocations),
+                      entry.inlineBytes / 1024.0, budget, over ? "  OVER BUDGET" : "");
+        text += line;
+    };
+    for (int i = 0; i < TAGS; ++i) {
+        MemoryTag tag = static_cast<MemoryTag>(i);
+        row(tagName(tag), usage(tag), isOverBudget(tag));
+    }
+    row("total", total(), false);
+    return text;
+}
+
+MemoryTag MemoryTracker::currentTag() {
+    return threadTag;
+}
+
+MemoryTag MemoryTracker::exchangeTag(MemoryTag tag) {
+    MemoryTag previous = threadTag;
+    threadTag = tag;
+    return previous;
+}
+
+void* MemoryTracker::allocate(std::size_t size) {
+    if (size > static_cast<std::size_t>(-1) - sizeof(BlockHeader)) {
+        return nullptr;
+    }
+    auto* header = static_cast<BlockHeader*>(std::malloc(sizeof(BlockHeader) + size));
+    if (!header) {
+        return nullptr;
+    }
+    header->size = size;
+    header->tag = threadTag;
+
+    TagCounters& tag = counters[static_cast<int>(header->tag)];
+    tag.allocations.fetch_add(1, std::memory_order_relaxed);
+    std::int64_t bytes = tag.bytes.fetch_add(static_cast<std::int64_t>(size),
+                                             std::memory_order_relaxed) + static_cast<std::int64_t>(size);
+    raisePeak(tag, bytes);
+    return header + 1;
+}
+
+void MemoryTracker::release(void* block) {
+    if (!block) {
+        return;
+    }
+    BlockHeader* header = static_cast<BlockHeader*>(block) - 1;
+    TagCounters& tag = counters[static_cast<int>(header->tag)];
+    tag.frees.fetch_add(1, std::memory_order_relaxed);
+    tag.bytes.fetch_sub(static_cast<std::int64_t>(header->size), std::memory_order_relaxed);
+    std::free(header);
+}
+
+// Replaceable global allocation functions. Over-aligned (align_val_t)
+// allocations keep the standard library's versions and are not counted.
+
+void* operator new(std::size_t size) {
+    return allocateOrThrow(size);
+}
+
+void* operator new[](std::size_t size) {
+    return allocateOrThrow(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocateOrThrow(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocateOrThrow(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* block) noexcept {
+    MemoryTracker::release(block);
+}
+
+void operator delete[](void* block) noexcept {
+    MemoryTracker::release(block);
+}
+
+void operator delete(void* block, std::size_t) noexcept {
+    MemoryTracker::release(block);
+}
+
+void operator delete[](void* block, std::size_t) noexcept {
+    MemoryTracker::release(block);
+}
+
+void operator delete(void* block, const std::nothrow_t&) noexcept {
+    MemoryTracker::release(block);
+}
+
+void operator delete[](void* block, const std::nothrow_t&) noexcept {
+    MemoryTracker::release(block);
+}
@@ -0,0 +1,121 @@
+#ifndef MEMORYTRACKER_H
+#define MEMORYTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @file MemoryTracker.h
+ * @brief Per-subsystem heap accounting through global allocation hooks
+ */
+
+/**
+ * @enum MemoryTag
+ * @brief Subsystem an allocation is charged to
+ */
+enum class MemoryTag : std::uint8_t {
+    GENERAL = 0,    ///< Anything not inside a MemoryScope
+    TERRAIN,        ///< BlockGrid and map loading
+    ENEMIES,        ///< Enemy vector, EnemyLogic paths, pathfinding scratch
+    PROJECTILES,    ///< Harpoons and fire
+    PARTICLES,      ///< ParticleSystem
+    UI_TEXT,        ///< Cached UI strings
+    COUNT
+};
+
+/**
+ * @class MemoryTracker
+ * @brief Live bytes, allocation counts and high-water marks per MemoryTag
+ *
+ * How attribution works:
+ * - The global operator new/delete are replaced (MemoryTracker.cpp).
+ *   Each block carries a small header with its size and tag, so a free
+ *   is charged back to the subsystem that allocated it, whichever
+ *   thread or scope frees it.
+ * - The tag is the innermost MemoryScope on the allocating thread
+ *   (thread_local), GENERAL outside any scope.
+ * - Counters are relaxed atomics; the cost per allocation is a header
+ *   and a few uncontended adds.
+ *
+ * Entities kept in fixed in-place storage (ObjectPool, BlockGrid
+ * arrays) never touch the heap; each owner adds its footprint with
+ * addInlineBytes() and takes it back when destroyed, so the report
+ * shows the sum over every live owner.
+ *
+ * Budgets: setBudget() gives a subsystem a byte limit for its peak
+ * heap use; report() and isOverBudget() flag subsystems that hit it.
+ */
+class MemoryTracker {
+public:
+    struct Usage {
+        std::int64_t bytes = 0;             ///< Live heap bytes
+        std::int64_t peakBytes = 0;         ///< High-water mark of bytes
+        std::uint64_t allocations = 0;      ///< Allocations made so far
+        std::uint64_t frees = 0;
+        std::int64_t inlineBytes = 0;       ///< Fixed in-place storage
+        std::int64_t budgetBytes = 0;       ///< 0 = no budget
+    };
+
+    static Usage usage(MemoryTag tag);
+
+    /**
+     * @brief Sum over all tags (peak is the sum of per-tag peaks)
+     */
+    static Usage total();
+
+    static const char* tagName(MemoryTag tag);
+
+    /**
+     * @brief Parse a tagName() (case-sensitive)
+     * @return false if unknown
+     */
+    static bool tagFromName(const std::string& name, MemoryTag& tag);
+
+    /**
+     * @brief Add (or, negative, remove) in-place storage charged to a tag
+     */
+    static void addInlineBytes(MemoryTag tag, std::int64_t bytes);
+    static void setBudget(MemoryTag tag, std::int64_t bytes);
+    static bool isOverBudget(MemoryTag tag);
+
+    /**
+     * @brief Start high-water marks again from current usage
+     */
+    static void resetPeaks();
+
+    /**
+     * @brief Table of every subsystem: live, peak, allocations, inline, budget
+     */
+    static std::string report();
+
+    static MemoryTag currentTag();
+
+    // Allocation hooks used by the replaced operator new/delete
+    static void* allocate(std::size_t size);
+    static void release(void* block);
+
+private:
+    friend class MemoryScope;
+    static MemoryTag exchangeTag(MemoryTag tag);
+};
+
+/**
+ * @class MemoryScope
+ * @brief Charges this thread's allocations to a tag until destroyed
+ *
+ * Scopes nest; the previous tag comes back when the scope ends.
+ */
+class MemoryScope {
+public:
+    explicit MemoryScope(MemoryTag tag) : previous(MemoryTracker::exchangeTag(tag)) {}
+    ~MemoryScope() { MemoryTracker::exchangeTag(previous); }
+
+    MemoryScope(const MemoryScope&) = delete;
+    MemoryScope& operator=(const MemoryScope&) = delete;
+
+private:
+    MemoryTag previous;
+};
+
+#endif // MEMORYTRACKER_H
@@ -0,0 +1,204 @@
+#include "MetricsExporter.h"
+#include "MetricsRegistry.h"
+#include "GameLog.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const int POLL_MILLIS = 100;        ///< Endpoint poll; also bounds stop() latency
+    const int REQUEST_BYTES = 2048;     ///< Request line and headers we bother reading
+    const int MAX_PORT = 65535;
+}
+
+MetricsExporter::MetricsExporter(const MetricsRegistry& registry)
+    : registry(registry), listenHandle(-1), boundPort(-1), scrapesServed(0), stopping(false) {
+}
+
+MetricsExporter::~MetricsExporter() {
+    stop();
+}
+
+bool MetricsExporter::start(const Settings& newSettings) {
+    stop();
+    settings = newSettings;
+
+    if (settings.port >= 0 && !openEndpoint(settings.port)) {
+        GameLog::info() << "Metrics endpoint unavailable on port " << settings.port << std::endl;
+    }
+    if (!isServing() && settings.filePath.empty()) {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(wakeLock);
+        stopping = false;
+    }
+    worker = std::thread(&MetricsExporter::run, this);
+    return true;
+}
+
+void MetricsExporter::stop() {
+    if (!worker.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(wakeLock);
+        stopping = true;
+    }
+    wake.notify_all();
+    worker.join();
+    closeEndpoint();
+
+    if (!settings.filePath.empty()) {
+        dumpToFile(settings.filePath);
+    }
+}
+
+bool MetricsExporter::dumpToFile(const std::string& path) const {
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file << registry.renderPrometheus();
+        if (!file) {
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    return !error;
+}
+
+void MetricsExporter::run() {
+    using Clock = std::chrono::steady_clock;
+    const auto interval = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(settings.dumpIntervalSeconds));
+    auto nextDump = Clock::now() + interval;
+
+    while (true) {
+        if (isServing()) {
+            serveOne();
+        } else {
+            std::unique_lock<std::mutex> guard(wakeLock);
+            wake.wait_until(guard, nextDump, [this] { return stopping; });
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(wakeLock);
+            if (stopping) break;
+        }
+
+        if (!settings.filePath.empty() && Clock::now() >= nextDump) {
+            dumpToFile(settings.filePath);
+            nextDump = Clock::now() + interval;
+        }
+    }
+}
+
+#ifdef __linux__
+
+bool MetricsExporter::openEndpoint(int port) {
+    if (port < 0 || port > MAX_PORT) {
+        return false;
+    }
+    int handle = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (handle < 0) {
+        return false;
+    }
+    int reuse = 1;
+    setsockopt(handle, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(static_cast<std::uint16_t>(port));
+    socklen_t length = sizeof(address);
+    if (bind(handle, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(handle, 4) != 0 ||
+        getsockname(handle, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+        close(handle);
+        return false;
+    }
+
+    listenHandle = handle;
+    boundPort = ntohs(address.sin_port);
+    return true;
+}
+
+void MetricsExporter::closeEndpoint() {
+    if (listenHandle >= 0) {
+        close(listenHandle);
+    }
+    listenHandle = -1;
+    boundPort = -1;
+}
+
+void MetricsExporter::serveOne() {
+    pollfd waiting{listenHandle, POLLIN, 0};
+    if (poll(&waiting, 1, POLL_MILLIS) <= 0) {
+        return;
+    }
+    int client = accept4(listenHandle, nullptr, nullptr, SOCK_CLOEXEC);
+    if (client < 0) {
+        return;
+    }
+
+    // One short request per connection; a client that sends nothing
+    // within a poll interval is dropped rather than waited on
+    char request[REQUEST_BYTES];
+    std::size_t received = 0;
+    pollfd reading{client, POLLIN, 0};
+    while (received < sizeof(request) && poll(&reading, 1, POLL_MILLIS) > 0) {
+        ssize_t got = recv(client, request + received, sizeof(request) - received, 0);
+        if (got <= 0) break;
+        received += static_cast<std::size_t>(got);
+        if (std::string(request, received).find("\r\n\r\n") != std::string::npos) break;
+    }
+
+    std::string requestLine(request, received);
+    requestLine = requestLine.substr(0, requestLine.find("\r\n"));
+    bool metrics = requestLine.rfind("GET /metrics ", 0) == 0 || requestLine == "GET /metrics";
+
+    std::string body = metrics ? registry.renderPrometheus() : "not found\n";
+    std::string response = std::string(metrics ? "HTTP/1.1 200 OK\r\n" : "HTTP/1.1 404 Not Found\r\n") +
+        "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+        "Content-Length: " + std::to_string(body.size()) + "\r\n"
+        "Connection: close\r\n\r\n" + body;
+
+    std::size_t sent = 0;
+    while (sent < response.size()) {
+        ssize_t wrote = send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+        if (wrote <= 0) break;
+        sent += static_cast<std::size_t>(wrote);
+    }
+    close(client);
+
+    if (metrics) {
+        scrapesServed.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+#else
+
+bool MetricsExporter::openEndpoint(int) {
+    return false;
+}
+
+void MetricsExporter::closeEndpoint() {
+}
+
+void MetricsExporter::serveOne() {
+}
+
+#endif
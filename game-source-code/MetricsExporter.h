@@ -0,0 +1,87 @@
+#ifndef METRICSEXPORTER_H
+#define METRICSEXPORTER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class MetricsRegistry;
+
+/**
+ * @file MetricsExporter.h
+ * @brief Serves a MetricsRegistry to monitoring from a background thread
+ */
+
+/**
+ * @class MetricsExporter
+ * @brief Prometheus scrape endpoint and/or periodic metrics file
+ *
+ * Outputs (either or both):
+ * - HTTP endpoint: GET /metrics on 127.0.0.1:port returns the registry in
+ *   Prometheus text format. Loopback only - a local agent scrapes it.
+ *   Linux only (POSIX sockets); elsewhere start() reports it unavailable.
+ * - File dump: the same text written every dumpIntervalSeconds, through
+ *   a temporary file and a rename so readers never see half a dump.
+ *   Works everywhere (node_exporter's textfile collector reads these).
+ *
+ * All exporting happens on the exporter's own thread. The game only
+ * records into the registry's atomics, so a slow or stuck scraper never
+ * delays a frame or a tick.
+ */
+class MetricsExporter {
+public:
+    struct Settings {
+        int port = -1;                      ///< -1 = no endpoint, 0 = any free port (max 65535)
+        std::string filePath;               ///< Empty = no file dump
+        double dumpIntervalSeconds = 10.0;
+    };
+
+    explicit MetricsExporter(const MetricsRegistry& registry);
+    ~MetricsExporter();
+
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+    /**
+     * @brief Open the endpoint and start the exporter thread
+     * @return false if nothing could be started (endpoint asked for but
+     *         unavailable and no file dump)
+     */
+    bool start(const Settings& settings);
+
+    /**
+     * @brief Stop the thread; writes a final file dump if one is set
+     */
+    void stop();
+
+    /**
+     * @brief Write the registry to a file now (temp file, then rename)
+     */
+    bool dumpToFile(const std::string& path) const;
+
+    bool isRunning() const { return worker.joinable(); }
+    bool isServing() const { return listenHandle >= 0; }
+    int getPort() const { return boundPort; }
+    int getScrapesServed() const { return scrapesServed.load(std::memory_order_relaxed); }
+
+private:
+    const MetricsRegistry& registry;
+    Settings settings;
+    int listenHandle;
+    int boundPort;
+    std::atomic<int> scrapesServed;
+
+    std::thread worker;
+    std::mutex wakeLock;
+    std::condition_variable wake;
+    bool stopping;
+
+    bool openEndpoint(int port);
+    void closeEndpoint();
+    void run();
+    void serveOne();
+};
+
+#endif // METRICSEXPORTER_H
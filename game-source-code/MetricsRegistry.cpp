@@ -0,0 +1,179 @@
+#include "MetricsRegistry.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+    const double QUANTILES[] = {0.5, 0.9, 0.99, 0.999};
+
+    std::string formatValue(double value) {
+        char text[32];
+        std::snprintf(text, sizeof(text), "%.9g", value);
+        return text;
+    }
+
+    std::string joinLabels(const std::string& labels, const std::string& extra) {
+        if (labels.empty() && extra.empty()) return "";
+        if (labels.empty()) return "{" + extra + "}";
+        if (extra.empty()) return "{" + labels + "}";
+        return "{" + labels + "," + extra + "}";
+    }
+}
+
+void MetricHistogram::record(std::uint64_t sample) {
+    sample = std::min(sample, MAX_VALUE);
+    buckets[bucketFor(sample)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(sample, std::memory_order_relaxed);
+
+    std::uint64_t seen = max.load(std::memory_order_relaxed);
+    while (sample > seen && !max.compare_exchange_weak(seen, sample, std::memory_order_relaxed)) {
+    }
+}
+
+std::uint64_t MetricHistogram::percentile(double quantile) const {
+    std::uint64_t total = 0;
+    for (const auto& bucket : buckets) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    quantile = std::clamp(quantile, 0.0, 1.0);
+    std::uint64_t rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(
+        std::ceil(quantile * static_cast<double>(total))));
+    std::uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; ++i) {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::min(bucketUpperEdge(i), getMax());
+        }
+    }
+    return getMax();
+}
+
+void MetricHistogram::reset() {
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    max.store(0, std::memory_order_relaxed);
+}
+
+int MetricHistogram::bucketFor(std::uint64_t sample) {
+    sample = std::min(sample, MAX_VALUE);
+    if (sample < static_cast<std::uint64_t>(SUB_BUCKETS)) {
+        return static_cast<int>(sample);
+    }
+    // Top SUB_BUCKET_BITS + 1 bits pick the slice within the power of two
+    int exponent = static_cast<int>(std::bit_width(sample)) - 1;
+    int shift = exponent - SUB_BUCKET_BITS;
+    int slice = static_cast<int>(sample >> shift) - SUB_BUCKETS;
+    return SUB_BUCKETS * (shift + 1) + slice;
+}
+
+std::uint64_t MetricHistogram::bucketUpperEdge(int bucket) {
+    if (bucket < SUB_BUCKETS) {
+        return static_cast<std::uint64_t>(bucket);
+    }
+    int shift = bucket / SUB_BUCKETS - 1;
+    std::uint64_t slice = static_cast<std::uint64_t>(bucket % SUB_BUCKETS);
+    std::uint64_t lower = (SUB_BUCKETS + slice) << shift;
+    return lower + (std::uint64_t(1) << shift) - 1;
+}
+
+MetricCounter& MetricsRegistry::counter(const std::string& name, const std::string& help,
+                                        const std::string& labels) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (Entry* entry = find(Kind::COUNTER, name, labels)) {
+        return *static_cast<MetricCounter*>(entry->metric);
+    }
+    counters.emplace_back();
+    entries.push_back({Kind::COUNTER, name, help, labels, 1.0, &counters.back()});
+    return counters.back();
+}
+
+MetricGauge& MetricsRegistry::gauge(const std::string& name, const std::string& help,
+                                    const std::string& labels) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (Entry* entry = find(Kind::GAUGE, name, labels)) {
+        return *static_cast<MetricGauge*>(entry->metric);
+    }
+    gauges.emplace_back();
+    entries.push_back({Kind::GAUGE, name, help, labels, 1.0, &gauges.back()});
+    return gauges.back();
+}
+
+MetricHistogram& MetricsRegistry::histogram(const std::string& name, const std::string& help,
+                                            double scale) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (Entry* entry = find(Kind::HISTOGRAM, name, "")) {
+        return *static_cast<MetricHistogram*>(entry->metric);
+    }
+    histograms.emplace_back();
+    entries.push_back({Kind::HISTOGRAM, name, help, "", scale, &histograms.back()});
+    return histograms.back();
+}
+
+std::string MetricsRegistry::renderPrometheus() const {
+    std::lock_guard<std::mutex> guard(lock);
+    std::string text;
+    std::vector<bool> written(entries.size(), false);
+
+    // One HELP/TYPE header per family, then every labelled member of it
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        if (written[i]) continue;
+        const Entry& family = entries[i];
+        const char* type = family.kind == Kind::COUNTER ? "counter" :
+                           family.kind == Kind::GAUGE ? "gauge" : "summary";
+        text += "# HELP " + family.name + " " + family.help + "\n";
+        text += "# TYPE " + family.name + " " + type + "\n";
+
+        for (std::size_t j = i; j < entries.size(); ++j) {
+            const Entry& entry = entries[j];
+            if (written[j] || entry.name != family.name || entry.kind != family.kind) continue;
+            written[j] = true;
+
+            if (entry.kind == Kind::COUNTER) {
+                auto* counter = static_cast<const MetricCounter*>(entry.metric);
+                text += entry.name + joinLabels(entry.labels, "") + " " +
+                        std::to_string(counter->get()) + "\n";
+            } else if (entry.kind == Kind::GAUGE) {
+                auto* gauge = static_cast<const MetricGauge*>(entry.metric);
+                text += entry.name + joinLabels(entry.labels, "") + " " +
+                        std::to_string(gauge->get()) + "\n";
+            } else {
+                auto* histogram = static_cast<const MetricHistogram*>(entry.metric);
+                for (double quantile : QUANTILES) {
+                    double value = static_cast<double>(histogram->percentile(quantile)) * entry.scale;
+                    text += entry.name + joinLabels(entry.labels, "quantile=\"" +
+                            formatValue(quantile) + "\"") + " " + formatValue(value) + "\n";
+                }
+                double total = static_cast<double>(histogram->getSum()) * entry.scale;
+                text += entry.name + "_sum" + joinLabels(entry.labels, "") + " " +
+                        formatValue(total) + "\n";
+                text += entry.name + "_count" + joinLabels(entry.labels, "") + " " +
+                        std::to_string(histogram->getCount()) + "\n";
+            }
+        }
+    }
+    return text;
+}
+
+int MetricsRegistry::size() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return static_cast<int>(entries.size());
+}
+
+MetricsRegistry::Entry* MetricsRegistry::find(Kind kind, const std::string& name,
+                                              const std::string& labels) {
+    for (Entry& entry : entries) {
+        if (entry.kind == kind && entry.name == name && entry.labels == labels) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,157 @@
+#ifndef METRICSREGISTRY_H
+#define METRICSREGISTRY_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @file MetricsRegistry.h
+ * @brief Lock-free counters, gauges and histograms for runtime telemetry
+ */
+
+/**
+ * @class MetricCounter
+ * @brief Monotonic count (Prometheus counter)
+ */
+class MetricCounter {
+public:
+    void add(std::uint64_t amount = 1) { value.fetch_add(amount, std::memory_order_relaxed); }
+    std::uint64_t get() const { return value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::uint64_t> value{0};
+};
+
+/**
+ * @class MetricGauge
+ * @brief Value that goes up and down (Prometheus gauge)
+ */
+class MetricGauge {
+public:
+    void set(std::int64_t amount) { value.store(amount, std::memory_order_relaxed); }
+    void add(std::int64_t amount) { value.fetch_add(amount, std::memory_order_relaxed); }
+    std::int64_t get() const { return value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::int64_t> value{0};
+};
+
+/**
+ * @class MetricHistogram
+ * @brief HDR-style histogram of non-negative integer samples
+ *
+ * Buckets are log-linear, as in HdrHistogram: every power of two is split
+ * into SUB_BUCKETS equal slices, so any recorded value is known to within
+ * 1/SUB_BUCKETS (about 6%) from 1 up to MAX_VALUE, with a fixed array of
+ * atomic bucket counts and no allocation after construction.
+ *
+ * Recording is a handful of relaxed atomic adds, safe from any thread.
+ * Readers (percentile(), the exporter) may run concurrently and see a
+ * slightly torn but never corrupt view - fine for monitoring.
+ */
+class MetricHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 4;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr int MAX_BITS = 40;     ///< Samples are clamped to 2^40 - 1
+    static constexpr std::uint64_t MAX_VALUE = (std::uint64_t(1) << MAX_BITS) - 1;
+    static constexpr int BUCKETS = SUB_BUCKETS * (MAX_BITS - SUB_BUCKET_BITS + 1);
+
+    void record(std::uint64_t sample);
+
+    /**
+     * @brief Value at or below which a fraction of samples fall
+     * @param quantile 0.0 - 1.0
+     * @return Upper edge of the bucket holding that sample (0 if empty)
+     */
+    std::uint64_t percentile(double quantile) const;
+
+    std::uint64_t getCount() const { return count.load(std::memory_order_relaxed); }
+    std::uint64_t getSum() const { return sum.load(std::memory_order_relaxed); }
+    std::uint64_t getMax() const { return max.load(std::memory_order_relaxed); }
+
+    void reset();
+
+    static int bucketFor(std::uint64_t sample);
+    static std::uint64_t bucketUpperEdge(int bucket);
+
+private:
+    std::atomic<std::uint64_t> buckets[BUCKETS]{};
+    std::atomic<std::uint64_t> count{0};
+    std::atomic<std::uint64_t> sum{0};
+    std::atomic<std::uint64_t> max{0};
+};
+
+/**
+ * @class MetricsRegistry
+ * @brief Owns named metrics and renders them in Prometheus text format
+ *
+ * Usage:
+ * - Register metrics once at startup; the returned references stay
+ *   valid for the registry's lifetime and registering the same name and
+ *   labels again returns the same metric
+ * - Hot paths only touch the metric itself (atomics, no lock)
+ * - renderPrometheus() is called from the exporter thread; it takes the
+ *   registration lock, never the recording side
+ *
+ * Names follow Prometheus conventions: counters end in _total, and
+ * histograms scaled to seconds end in _seconds. Metrics sharing a name
+ * with different labels (e.g. entities{kind="enemy"}) form one family.
+ */
+class MetricsRegistry {
+public:
+    MetricsRegistry() = default;
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    /**
+     * @param name Metric name ([a-zA-Z_:][a-zA-Z0-9_:]*)
+     * @param help One-line description
+     * @param labels Optional label set without braces, e.g. kind="enemy"
+     */
+    MetricCounter& counter(const std::string& name, const std::string& help,
+                           const std::string& labels = "");
+    MetricGauge& gauge(const std::string& name, const std::string& help,
+                       const std::string& labels = "");
+
+    /**
+     * @param scale Multiplier applied when rendering (1e-6 turns recorded
+     *              microseconds into seconds)
+     */
+    MetricHistogram& histogram(const std::string& name, const std::string& help,
+                               double scale = 1.0);
+
+    /**
+     * @brief Text exposition format 0.0.4; histograms render as summaries
+     *        (quantiles, _sum, _count)
+     */
+    std::string renderPrometheus() const;
+
+    int size() const;
+
+private:
+    enum class Kind { COUNTER, GAUGE, HISTOGRAM };
+
+    struct Entry {
+        Kind kind;
+        std::string name;
+        std::string help;
+        std::string labels;
+        double scale;
+        void* metric;
+    };
+
+    mutable std::mutex lock;
+    std::vector<Entry> entries;     ///< Registration order
+    std::deque<MetricCounter> counters;
+    std::deque<MetricGauge> gauges;
+    std::deque<MetricHistogram> histograms;
+
+    Entry* find(Kind kind, const std::string& name, const std::string& labels);
+};
+
+#endif // METRICSREGISTRY_H
@@ -0,0 +1,118 @@
+#ifndef OBJECTPOOL_H
+#define OBJECTPOOL_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+/**
+ * @file ObjectPool.h
+ * @brief Fixed-capacity, allocation-free storage for short-lived entities
+ */
+
+/**
+ * @class ObjectPool
+ * @brief Contiguous in-place storage for up to Capacity objects
+ *
+ * Replaces std::vector for entities that are spawned and retired many
+ * times per second (harpoons, fire projectiles):
+ * - All slots live inside the pool object, so spawning never allocates
+ * - Live objects stay packed at the front in spawn order, so iteration,
+ *   serialization and std::span views are the same as with a vector
+ * - removeIf() compacts in place (stable) instead of erase(remove_if)
+ * - emplace() returns nullptr when full; callers drop the spawn
+ *
+ * @tparam T Object type (copy/move assignable)
+ * @tparam Capacity Maximum live objects
+ */
+template <typename T, std::size_t Capacity>
+class ObjectPool {
+private:
+    alignas(T) unsigned char storage[Capacity * sizeof(T)];
+    std::size_t count;
+
+    T* slot(std::size_t index) {
+        return std::launder(reinterpret_cast<T*>(storage)) + index;
+    }
+    const T* slot(std::size_t index) const {
+        return std::launder(reinterpret_cast<const T*>(storage)) + index;
+    }
+
+public:
+    ObjectPool() : count(0) {}
+
+    ObjectPool(const ObjectPool& other) : count(0) {
+        for (const T& item : other) emplace(item);
+    }
+
+    ObjectPool& operator=(const ObjectPool& other) {
+        if (this != &other) {
+            clear();
+            for (const T& item : other) emplace(item);
+        }
+        return *this;
+    }
+
+    ~ObjectPool() {
+        clear();
+    }
+
+    /**
+     * @brief Construct a new object in the next free slot
+     * @return T* New object, or nullptr if the pool is full
+     */
+    template <typename... Args>
+    T* emplace(Args&&... args) {
+        if (count == Capacity) {
+            return nullptr;
+        }
+        T* item = new (slot(count)) T(std::forward<Args>(args)...);
+        count++;
+        return item;
+    }
+
+    /**
+     * @brief Drop every object matching a predicate, keeping order
+     * @return std::size_t Number of objects removed
+     */
+    template <typename Predicate>
+    std::size_t removeIf(Predicate predicate) {
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (predicate(*slot(i))) continue;
+            if (kept != i) {
+                *slot(kept) = std::move(*slot(i));
+            }
+            kept++;
+        }
+        std::size_t removed = count - kept;
+        while (count > kept) {
+            slot(--count)->~T();
+        }
+        return removed;
+    }
+
+    void clear() {
+        while (count > 0) {
+            slot(--count)->~T();
+        }
+    }
+
+    T* data() { return slot(0); }
+    const T* data() const { return slot(0); }
+    T* begin() { return slot(0); }
+    T* end() { return slot(count); }
+    const T* begin() const { return slot(0); }
+    const T* end() const { return slot(count); }
+
+    T& operator[](std::size_t index) { return *slot(index); }
+    const T& operator[](std::size_t index) const { return *slot(index); }
+    T& back() { return *slot(count - 1); }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    bool full() const { return count == Capacity; }
+    static constexpr std::size_t capacity() { return Capacity; }
+};
+
+#endif // OBJECTPOOL_H
@@ -5,6 +5,7 @@
 #include <vector>
 #include "Coordinate.h"
 #include "GameConstants.h"
+#include "MemoryTracker.h"
 
 /**
  * @file ParticleSystem.h
@@ -68,6 +69,7 @@ struct Particle {
  * 
  * Performance:
  * - Particles auto-removed when lifetime expires
+ * - draw(view) skips particles outside the camera view
  * - Typical count: 20-50 active particles
  * - Minimal performance impact
  * 
@@ -91,6 +93,7 @@ public:
      * @param count Number of particles (default: 8)
      */
     void emit(Vector2 position, Color color, int count = 8) {
+        MemoryScope memory(MemoryTag::PARTICLES);
         for (int i = 0; i < count; ++i) {
             float angle = (360.0f / count * i) * DEG2RAD;
             float speed = 50.0f + (rand() % 100);
@@ -109,6 +112,7 @@ public:
      * @param count Number of particles (default: 12)
      */
     void emitBurst(Vector2 position, Color color, int count = 12) {
+        MemoryScope memory(MemoryTag::PARTICLES);
         for (int i = 0; i < count; ++i) {
             float angle = ((rand() % 360)) * DEG2RAD;
             float speed = 100.0f + (rand() % 150);
@@ -127,6 +131,7 @@ public:
      * @param color Particle color
      */
     void emitTrail(Vector2 position, Color color) {
+        MemoryScope memory(MemoryTag::PARTICLES);
         Vector2 velocity = {
             (rand() % 60 - 30) * 0.5f,
             (rand() % 60 - 30) * 0.5f
@@ -158,6 +163,20 @@ public:
         }
     }
     
+    /**
+     * @brief Render particles overlapping a view rectangle
+     * @param view Visible area in the same space as particle positions
+     */
+    void draw(Rectangle view) const {
+        for (const auto& particle : particles) {
+            const Vector2& p = particle.position;
+            if (p.x + particle.size >= view.x && p.x - particle.size <= view.x + view.width &&
+                p.y + particle.size >= view.y && p.y - particle.size <= view.y + view.height) {
+                particle.draw();
+            }
+        }
+    }
+    
     /**
      * @brief Remove all particles
      */
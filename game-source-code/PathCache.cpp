@@ -0,0 +1,170 @@
+#include "PathCache.h"
+#include "BlockGrid.h"
+#include "HierarchicalPathfinder.h"
+#include "StateSerializer.h"
+#include <algorithm>
+
+PathCache::PathCache() : count(0), useClock(0), syncedGeneration(0), synced(false) {
+}
+
+bool PathCache::lookup(const BlockGrid& terrain, Coordinate start, Coordinate goal,
+                       std::vector<Coordinate>& path) {
+    sync(terrain);
+
+    // Best suffix: longest remaining path, then most recently used
+    int region = HierarchicalPathfinder::chunkOf(goal);
+    int best = -1;
+    int bestFirst = 0;
+    int bestLength = 0;
+    for (int i = 0; i < count; ++i) {
+        Entry& entry = entries[i];
+        if (entry.start == start && entry.goal == goal) {
+            entry.lastUsed = ++useClock;
+            path.assign(entry.cells, entry.cells + entry.length);
+            stats.hits++;
+            return true;
+        }
+        if (HierarchicalPathfinder::chunkOf(entry.goal) != region) continue;
+
+        int first = -1;
+        if (entry.start == start) {
+            first = 0;
+        } else {
+            for (int step = 0; step + 1 < entry.length; ++step) {
+                if (entry.cells[step] == start) {
+                    first = step + 1;
+                    break;
+                }
+            }
+        }
+        int remaining = entry.length - first;
+        if (first < 0 || remaining <= 0) continue;
+        if (remaining > bestLength ||
+            (remaining == bestLength && entry.lastUsed > entries[best].lastUsed)) {
+            best = i;
+            bestFirst = first;
+            bestLength = remaining;
+        }
+    }
+
+    if (best < 0) {
+        stats.misses++;
+        return false;
+    }
+    Entry& entry = entries[best];
+    entry.lastUsed = ++useClock;
+    path.assign(entry.cells + bestFirst, entry.cells + entry.length);
+    stats.suffixHits++;
+    return true;
+}
+
+void PathCache::store(const BlockGrid& terrain, Coordinate start, Coordinate goal,
+                      const std::vector<Coordinate>& path) {
+    sync(terrain);
+    if (path.empty()) {
+        return;
+    }
+
+    int slot = -1;
+    for (int i = 0; i < count; ++i) {
+        if (entries[i].start == start && entries[i].goal == goal) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0 && count < CAPACITY) {
+        slot = count++;
+    }
+    if (slot < 0) {
+        slot = 0;
+        for (int i = 1; i < count; ++i) {
+            if (entries[i].lastUsed < entries[slot].lastUsed) slot = i;
+        }
+        stats.evictions++;
+    }
+
+    Entry& entry = entries[slot];
+    entry.start = start;
+    entry.goal = goal;
+    entry.length = static_cast<std::uint8_t>(std::min<std::size_t>(path.size(), MAX_STEPS));
+    std::copy(path.begin(), path.begin() + entry.length, entry.cells);
+    entry.lastUsed = ++useClock;
+}
+
+void PathCache::sync(const BlockGrid& terrain) {
+    if (synced && terrain.getGeneration() == syncedGeneration) {
+        return;
+    }
+    if (!synced || !terrain.getChangesSince(syncedGeneration, changedCells)) {
+        stats.invalidations += count;
+        count = 0;
+    } else {
+        for (int i = count - 1; i >= 0; --i) {
+            for (const Coordinate& cell : changedCells) {
+                if (isNearPath(entries[i], cell)) {
+                    remove(i);
+                    stats.invalidations++;
+                    break;
+                }
+            }
+        }
+    }
+    syncedGeneration = terrain.getGeneration();
+    synced = true;
+}
+
+void PathCache::clear() {
+    count = 0;
+}
+
+void PathCache::serialize(StateWriter& writer, const BlockGrid& terrain) const {
+    bool current = synced && terrain.getGeneration() == syncedGeneration;
+    writer.write(useClock);
+    writer.write(static_cast<std::uint32_t>(current ? count : 0));
+    for (int i = 0; current && i < count; ++i) {
+        const Entry& entry = entries[i];
+        writer.write(entry.start);
+        writer.write(entry.goal);
+        writer.write(entry.lastUsed);
+        writer.write(entry.length);
+        writer.writeBytes(entry.cells, entry.length * sizeof(Coordinate));
+    }
+}
+
+void PathCache::deserialize(StateReader& reader) {
+    reader.read(useClock);
+    count = static_cast<int>(reader.readCount(CAPACITY));
+    for (int i = 0; i < count; ++i) {
+        Entry& entry = entries[i];
+        reader.readPosition(entry.start);
+        reader.readPosition(entry.goal);
+        reader.read(entry.lastUsed);
+        reader.read(entry.length);
+        entry.length = std::min<std::uint8_t>(entry.length, MAX_STEPS);
+        reader.readPositions(entry.cells, entry.length);
+    }
+    synced = false;
+}
+
+void PathCache::adopt(const BlockGrid& terrain) {
+    syncedGeneration = terrain.getGeneration();
+    synced = true;
+}
+
+bool PathCache::isNearPath(const Entry& entry, Coordinate cell) const {
+    if (entry.start.manhattanDistance(cell) <= NEAR_DISTANCE) {
+        return true;
+    }
+    for (int step = 0; step < entry.length; ++step) {
+        if (entry.cells[step].manhattanDistance(cell) <= NEAR_DISTANCE) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PathCache::remove(int index) {
+    // Keep order: lookups scan in slot order, and saved state must replay the same way
+    std::copy(entries + index + 1, entries + count, entries + index);
+    count--;
+}
@@ -0,0 +1,124 @@
+#ifndef PATHCACHE_H
+#define PATHCACHE_H
+
+#include "Coordinate.h"
+#include <cstdint>
+#include <vector>
+
+class BlockGrid;
+class StateWriter;
+class StateReader;
+
+/**
+ * @file PathCache.h
+ * @brief Shared LRU cache of enemy tunnel paths
+ */
+
+/**
+ * @class PathCache
+ * @brief Remembers recent (start, goal) tunnel paths for the current terrain
+ *
+ * Enemies chasing the same player ask for nearly the same paths over and
+ * over; this keeps the last CAPACITY answers.
+ *
+ * Lookup:
+ * - Exact hit: same start and goal, valid at the current terrain generation
+ * - Suffix hit: the start lies on a cached path whose goal is in the same
+ *   region (pathfinder chunk) as the asked goal - the enemy keeps walking
+ *   the rest of that path while the player moves about nearby
+ * - Least recently used entries are evicted when full
+ *
+ * Invalidation:
+ * - sync() asks BlockGrid::getChangesSince() which cells changed and
+ *   drops only entries whose path passes on or next to one of them;
+ *   the rest carry over to the new generation
+ * - Whole-map changes (or an overflowed change log) clear the cache
+ *
+ * The cache changes which path an enemy takes, so its entries are saved
+ * with the game state (replays and rollback see the same hits).
+ * Statistics are for tuning only and are not saved.
+ */
+class PathCache {
+public:
+    static const int CAPACITY = 64;
+    static const int MAX_STEPS = 8;       ///< Steps kept per path (EnemyLogic plans 8 ahead)
+    static const int NEAR_DISTANCE = 1;   ///< A change this close to a path invalidates it
+
+    struct Stats {
+        int hits = 0;           ///< Exact (start, goal) hits
+        int suffixHits = 0;     ///< Walked the rest of a cached path
+        int misses = 0;
+        int evictions = 0;      ///< LRU entries pushed out by new paths
+        int invalidations = 0;  ///< Entries dropped because terrain changed
+
+        float hitRate() const {
+            int lookups = hits + suffixHits + misses;
+            return lookups > 0 ? static_cast<float>(hits + suffixHits) / lookups : 0.0f;
+        }
+    };
+
+    PathCache();
+
+    /**
+     * @brief Find a cached path from start toward goal
+     * @param path Receives the steps (start excluded) on a hit
+     * @return true on an exact or suffix hit
+     */
+    bool lookup(const BlockGrid& terrain, Coordinate start, Coordinate goal,
+                std::vector<Coordinate>& path);
+
+    /**
+     * @brief Remember a freshly computed path (first MAX_STEPS steps)
+     */
+    void store(const BlockGrid& terrain, Coordinate start, Coordinate goal,
+               const std::vector<Coordinate>& path);
+
+    /**
+     * @brief Drop entries near cells changed since the last sync
+     */
+    void sync(const BlockGrid& terrain);
+
+    void clear();
+    void resetStats() { stats = Stats(); }
+
+    int size() const { return count; }
+    const Stats& getStats() const { return stats; }
+
+    /**
+     * @brief Write entries (none if the cache lags the terrain)
+     */
+    void serialize(StateWriter& writer, const BlockGrid& terrain) const;
+
+    /**
+     * @brief Read entries written by serialize()
+     * @note Call adopt() once the matching terrain is in place
+     */
+    void deserialize(StateReader& reader);
+
+    /**
+     * @brief Treat the entries as valid for this terrain (after a restore)
+     */
+    void adopt(const BlockGrid& terrain);
+
+private:
+    struct Entry {
+        Coordinate start;
+        Coordinate goal;
+        std::uint8_t length;
+        Coordinate cells[MAX_STEPS];
+        std::uint32_t lastUsed;
+    };
+
+    Entry entries[CAPACITY];    ///< entries [0, count) in use
+    int count;
+    std::uint32_t useClock;
+    unsigned int syncedGeneration;
+    bool synced;
+    Stats stats;
+    std::vector<Coordinate> changedCells;
+
+    bool isNearPath(const Entry& entry, Coordinate cell) const;
+    void remove(int index);
+};
+
+#endif // PATHCACHE_H
@@ -1,7 +1,9 @@
 #include "Player.h"
+#include "StateSerializer.h"
+#include "GameClock.h"
 #include "Rock.h"
 #include "GameConstants.h"
-#include <raylib-cpp.hpp>
+#include "GameTuning.h"
 #include <iostream>
 #include <algorithm>
 
@@ -11,9 +13,10 @@ Player::Player(Coordinate startPos)
     : GameObject(startPos), moveTimer(0.0f), digEffectTimer(0.0f), 
       isDigging(false), lastMoveDirection(Direction::NONE), 
       currentInputDirection(Direction::NONE), tunnelsCreated(0), 
-      moveCooldown(BASE_MOVE_COOLDOWN), isMoving(false), speedMultiplier(1.0f),
+      moveCooldown(GameTuning::get().playerMoveCooldown), isMoving(false), speedMultiplier(1.0f),
       consecutiveMoves(0), canDigDiagonally(false), hasHarpoon(false),
-      harpoonCooldown(HARPOON_COOLDOWN_TIME), lastHarpoonTime(0.0f) {
+      harpoonCooldown(HARPOON_COOLDOWN_TIME), lastHarpoonTime(0.0f), 
+      lastMoveTime(0.0f) {
 }
 
 void Player::update() {
@@ -25,35 +28,34 @@ void Player::update() {
 void Player::render() {
 }
 
-bool Player::handleMovement(BlockGrid& terrain) {
-    Direction inputDirection = processInputBuffer();
-    
-    if (inputDirection == Direction::NONE || !canMove()) {
+bool Player::handleMovementWithRocks(Direction inputDirection, BlockGrid& terrain, 
+                                     const std::vector<Rock>& rocks) {
+    if (!canMove()) {
         isMoving = false;
         return false;
     }
     
-    bool moved = moveInDirection(inputDirection, terrain);
-    updateMovementState(moved);
-    return moved;
-}
-
-bool Player::handleMovementWithRocks(BlockGrid& terrain, const std::vector<Rock>& rocks) {
-    Direction inputDirection = processInputBuffer();
-    
-    if (inputDirection == Direction::NONE || !canMove()) {
+    Direction direction = queuedMoves.take(GameClock::now(), INPUT_BUFFER_WINDOW);
+    if (direction == Direction::NONE) {
+        direction = inputDirection;
+    }
+    if (direction == Direction::NONE) {
         isMoving = false;
         return false;
     }
     
-    bool moved = moveInDirectionWithRocks(inputDirection, terrain, rocks);
+    bool moved = moveInDirectionWithRocks(direction, terrain, rocks);
     updateMovementState(moved);
     return moved;
 }
 
+void Player::queueDirection(Direction direction) {
+    queuedMoves.push(direction, GameClock::now());
+}
+
 bool Player::moveInDirectionWithRocks(Direction direction, BlockGrid& terrain, 
                                      const std::vector<Rock>& rocks) {
-    Coordinate offset = getDirectionOffset(direction);
+    Coordinate offset = directionOffset(direction);
     Coordinate newPos = position + offset;
     
     if (!newPos.isWithinBounds()) {
@@ -88,7 +90,7 @@ bool Player::isPositionBlockedByRock(Coordinate pos, const std::vector<Rock>& ro
 }
 
 bool Player::moveInDirection(Direction direction, BlockGrid& terrain) {
-    Coordinate offset = getDirectionOffset(direction);
+    Coordinate offset = directionOffset(direction);
     Coordinate newPos = position + offset;
     
     if (!newPos.isWithinBounds()) {
@@ -117,7 +119,7 @@ bool Player::digTunnel(Coordinate pos, BlockGrid& terrain) {
     terrain.clearPassageAt(pos);
     tunnelsCreated++;
     isDigging = true;
-    digEffectTimer = GetTime();
+    digEffectTimer = GameClock::now();
     return true;
 }
 
@@ -156,7 +158,7 @@ float Player::getSpeedMultiplier() const {
 }
 
 bool Player::canFireHarpoon() const {
-    float currentTime = GetTime();
+    float currentTime = GameClock::now();
     return (currentTime - lastHarpoonTime) >= harpoonCooldown;
 }
 
@@ -178,9 +180,10 @@ void Player::reset(Coordinate newPos) {
     tunnelsCreated = 0;
     isMoving = false;
     consecutiveMoves = 0;
-    moveCooldown = BASE_MOVE_COOLDOWN;
+    moveCooldown = GameTuning::get().playerMoveCooldown;
     hasHarpoon = false;
     lastHarpoonTime = 0.0f;
+    queuedMoves.clear();
     setActive(true);
 }
 
@@ -189,7 +192,7 @@ void Player::updateMovementTimer() {
 
 void Player::updateDiggingEffects() {
     if (isDigging) {
-        float currentTime = GetTime();
+        float currentTime = GameClock::now();
         if (currentTime - digEffectTimer >= DIG_EFFECT_DURATION) {
             isDigging = false;
         }
@@ -197,22 +200,13 @@ void Player::updateDiggingEffects() {
 }
 
 bool Player::canMove() const {
-    float currentTime = GetTime();
+    float currentTime = GameClock::now();
     float effectiveCooldown = moveCooldown * speedMultiplier;
     return (currentTime - moveTimer) >= effectiveCooldown;
 }
 
-Direction Player::processInputBuffer() {
-    if (IsKeyDown(KEY_UP)) return Direction::UP;
-    if (IsKeyDown(KEY_DOWN)) return Direction::DOWN;
-    if (IsKeyDown(KEY_LEFT)) return Direction::LEFT;
-    if (IsKeyDown(KEY_RIGHT)) return Direction::RIGHT;
-    return Direction::NONE;
-}
-
 void Player::updateMovementStats() {
-    static float lastMoveTime = 0.0f;
-    float currentTime = GetTime();
+    float currentTime = GameClock::now();
     
     if (!isMoving && (currentTime - lastMoveTime) > 1.0f) {
         if (consecutiveMoves > 0) {
@@ -226,23 +220,13 @@ void Player::updateMovementStats() {
 }
 
 float Player::getDynamicMoveCooldown() const {
+    const TuningValues& tuning = GameTuning::get();
     if (consecutiveMoves >= CONSECUTIVE_MOVES_FOR_SPEEDUP) {
-        return FAST_MOVE_COOLDOWN;
+        return tuning.playerFastMoveCooldown;
     }
     
     float speedupFactor = 1.0f - (consecutiveMoves * 0.02f);
-    return BASE_MOVE_COOLDOWN * std::max(0.7f, speedupFactor);
-}
-
-Coordinate Player::getDirectionOffset(Direction direction) const {
-    switch (direction) {
-        case Direction::UP:    return Coordinate(-1, 0);
-        case Direction::DOWN:  return Coordinate(1, 0);
-        case Direction::LEFT:  return Coordinate(0, -1);
-        case Direction::RIGHT: return Coordinate(0, 1);
-        case Direction::NONE:  return Coordinate(0, 0);
-    }
-    return Coordinate(0, 0);
+    return tuning.playerMoveCooldown * std::max(0.7f, speedupFactor);
 }
 
 void Player::updateDirectionState(Direction direction) {
@@ -252,7 +236,7 @@ void Player::updateDirectionState(Direction direction) {
 
 void Player::updateMovementState(bool moved) {
     if (moved) {
-        moveTimer = GetTime();
+        moveTimer = GameClock::now();
         isMoving = true;
         consecutiveMoves++;
         moveCooldown = getDynamicMoveCooldown();
@@ -261,3 +245,45 @@ void Player::updateMovementState(bool moved) {
         consecutiveMoves = 0;
     }
 }
+
+void Player::serialize(StateWriter& writer) const {
+    writer.write(position);
+    writer.write(active);
+    writer.write(moveTimer);
+    writer.write(digEffectTimer);
+    writer.write(isDigging);
+    writer.write(lastMoveDirection);
+    writer.write(currentInputDirection);
+    writer.write(tunnelsCreated);
+    writer.write(moveCooldown);
+    writer.write(isMoving);
+    writer.write(speedMultiplier);
+    writer.write(consecutiveMoves);
+    writer.write(canDigDiagonally);
+    writer.write(hasHarpoon);
+    writer.write(harpoonCooldown);
+    writer.write(lastHarpoonTime);
+    writer.write(lastMoveTime);
+    queuedMoves.serialize(writer);
+}
+
+void Player::deserialize(StateReader& reader) {
+    reader.readPosition(position);
+    reader.read(active);
+    reader.read(moveTimer);
+    reader.read(digEffectTimer);
+    reader.read(isDigging);
+    reader.readEnum(lastMoveDirection, Direction::NONE);
+    reader.readEnum(currentInputDirection, Direction::NONE);
+    reader.read(tunnelsCreated);
+    reader.read(moveCooldown);
+    reader.read(isMoving);
+    reader.read(speedMultiplier);
+    reader.read(consecutiveMoves);
+    reader.read(canDigDiagonally);
+    reader.read(hasHarpoon);
+    reader.read(harpoonCooldown);
+    reader.read(lastHarpoonTime);
+    reader.read(lastMoveTime);
+    queuedMoves.deserialize(reader);
+}
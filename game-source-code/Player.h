@@ -5,8 +5,12 @@
 #include "Coordinate.h"
 #include "BlockGrid.h"
 #include "EnemyLogic.h"
+#include "DirectionBuffer.h"
 #include <vector>
 
+class StateWriter;
+class StateReader;
+
 class Rock; // Forward declaration
 
 /**
@@ -27,6 +31,8 @@ class Rock; // Forward declaration
  * - Speed boost: Modified by power-ups (0.5x = twice as fast)
  * - Consecutive moves: Slight speed increase after multiple moves
  * - Digging: Automatically clears earth blocks when moving
+ * - Taps during the cooldown are queued (DirectionBuffer) and played
+ *   once the player can move, ahead of the held direction
  * 
  * @note Player is both GameObject and Collidable
  */
@@ -46,6 +52,8 @@ private:
     bool hasHarpoon;
     float harpoonCooldown;
     float lastHarpoonTime;
+    float lastMoveTime;
+    DirectionBuffer queuedMoves;
 
 public:
     /**
@@ -58,19 +66,24 @@ public:
     void render() override;
     
     /**
-     * @brief Process player movement without rock checking
-     * @param terrain Game terrain to check for earth blocks
+     * @brief Process movement from an already-sampled direction
+     * @param inputDirection Direction requested this tick (NONE = idle)
+     * @param terrain Game terrain to check
+     * @param rocks Active rocks to check for collisions
      * @return true if movement successful
+     * @note Input always arrives as data (keyboard, replay or bot), so
+     *       Player never reads the keyboard itself
      */
-    bool handleMovement(BlockGrid& terrain);
+    bool handleMovementWithRocks(Direction inputDirection, BlockGrid& terrain, 
+                                 const std::vector<Rock>& rocks);
     
     /**
-     * @brief Process player movement with rock avoidance
-     * @param terrain Game terrain to check
-     * @param rocks Active rocks to check for collisions
-     * @return true if movement successful
+     * @brief Remember a direction press for the next allowed move
+     * @param direction Direction newly pressed this tick
      */
-    bool handleMovementWithRocks(BlockGrid& terrain, const std::vector<Rock>& rocks);
+    void queueDirection(Direction direction);
+    
+    int getQueuedMoveCount() const { return queuedMoves.size(); }
     
     /**
      * @brief Move player in specified direction
@@ -115,16 +128,26 @@ public:
     void setDiagonalDigging(bool enabled);
     void reset(Coordinate newPos);
 
+    /**
+     * @brief Write player movement, digging and cooldown state to a state snapshot
+     * @param writer Destination
+     */
+    void serialize(StateWriter& writer) const;
+    
+    /**
+     * @brief Restore state written by serialize()
+     * @param reader Source
+     */
+    void deserialize(StateReader& reader);
+
 private:
     void updateMovementTimer();
     void updateDiggingEffects();
     bool canMove() const;
-    Direction processInputBuffer();
     void updateMovementStats();
     float getDynamicMoveCooldown() const;
     bool isPositionBlockedByRock(Coordinate pos, const std::vector<Rock>& rocks) const;
     
-    Coordinate getDirectionOffset(Direction direction) const;
     void updateDirectionState(Direction direction);
     void updateMovementState(bool moved);
 };
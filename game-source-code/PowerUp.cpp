@@ -1,9 +1,11 @@
 #include "PowerUp.h"
+#include "StateSerializer.h"
+#include "GameClock.h"
 #include <raylib-cpp.hpp>
 
 PowerUp::PowerUp(Coordinate pos, PowerUpType powerType) 
     : GameObject(pos), type(powerType), value(0), duration(0.0f),
-      spawnTime(GetTime()), lifetime(30.0f), collected(false) {
+      spawnTime(GameClock::now()), lifetime(30.0f), collected(false) {
     initializePowerUp();
 }
 
@@ -39,7 +41,7 @@ void PowerUp::collect() {
 }
 
 bool PowerUp::shouldDespawn() const {
-    float currentTime = GetTime();
+    float currentTime = GameClock::now();
     return (currentTime - spawnTime) >= lifetime;
 }
 
@@ -70,3 +72,25 @@ void PowerUp::initializePowerUp() {
             break;
     }
 }
+
+void PowerUp::serialize(StateWriter& writer) const {
+    writer.write(position);
+    writer.write(active);
+    writer.write(type);
+    writer.write(value);
+    writer.write(duration);
+    writer.write(spawnTime);
+    writer.write(lifetime);
+    writer.write(collected);
+}
+
+void PowerUp::deserialize(StateReader& reader) {
+    reader.readPosition(position);
+    reader.read(active);
+    reader.readEnum(type, PowerUpType::POWER_SHOT);
+    reader.read(value);
+    reader.read(duration);
+    reader.read(spawnTime);
+    reader.read(lifetime);
+    reader.read(collected);
+}
@@ -4,6 +4,9 @@
 #include "GameObject.h"
 #include "Coordinate.h"
 
+class StateWriter;
+class StateReader;
+
 /**
  * @file PowerUp.h
  * @brief Collectible power-ups with timed effects
@@ -84,6 +87,18 @@ public:
      */
     bool shouldDespawn() const;
 
+    /**
+     * @brief Write power-up type, value and despawn timing to a state snapshot
+     * @param writer Destination
+     */
+    void serialize(StateWriter& writer) const;
+    
+    /**
+     * @brief Restore state written by serialize()
+     * @param reader Source
+     */
+    void deserialize(StateReader& reader);
+
 private:
     void initializePowerUp();
 };
@@ -2,6 +2,7 @@
 #define POWERUPEFFECT_H
 
 #include "PowerUp.h"
+#include "GameClock.h"
 #include <raylib-cpp.hpp>
 
 /**
@@ -37,7 +38,7 @@
  * - Automatic cleanup when expired
  * - Provides time remaining for UI display
  * 
- * @note Uses GetTime() for timestamp-based expiration
+ * @note Uses GameClock::now() (simulation time) for expiration
  */
 struct PowerUpEffect {
     PowerUpType type;  ///< Type of power-up effect
@@ -50,7 +51,7 @@ struct PowerUpEffect {
      * @param t Power-up type
      * @param d Effect duration in seconds
      */
-    PowerUpEffect(PowerUpType t, float d) : type(t), startTime(GetTime()), 
+    PowerUpEffect(PowerUpType t, float d) : type(t), startTime(GameClock::now()), 
                                            duration(d), active(true) {}
     
     /**
@@ -58,7 +59,7 @@ struct PowerUpEffect {
      * @return true if current time exceeds start + duration
      */
     bool isExpired() const {
-        return (GetTime() - startTime) >= duration;
+        return (GameClock::now() - startTime) >= duration;
     }
     
     /**
@@ -66,7 +67,7 @@ struct PowerUpEffect {
      * @return float Seconds remaining (0.0 if expired)
      */
     float getTimeRemaining() const {
-        return duration - (GetTime() - startTime);
+        return duration - (GameClock::now() - startTime);
     }
 };
 
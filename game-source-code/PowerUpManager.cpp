@@ -1,6 +1,9 @@
 #include "PowerUpManager.h"
+#include "StateSerializer.h"
+#include "GameLog.h"
+#include "GameClock.h"
+#include "GameTuning.h"
 #include <raylib-cpp.hpp>
-#include <iostream>
 #include <algorithm>
 
 PowerUpManager::PowerUpManager() : lastPowerUpCollected(0.0f), powerUpMessage(""),
@@ -15,7 +18,7 @@ void PowerUpManager::update() {
 void PowerUpManager::updatePowerUpEffects() {
     for (auto it = activePowerUps.begin(); it != activePowerUps.end();) {
         if (it->isExpired()) {
-            std::cout << "Power-up expired: ";
+            GameLog::info() << "Power-up expired: ";
             handlePowerUpExpiration(it->type);
             it = activePowerUps.erase(it);
         } else {
@@ -25,36 +28,37 @@ void PowerUpManager::updatePowerUpEffects() {
     
     hasRapidFire = hasPowerUpEffect(PowerUpType::RAPID_FIRE);
     hasPowerShot = hasPowerUpEffect(PowerUpType::POWER_SHOT);
-    harpoonCooldown = hasRapidFire ? 0.3f : 0.8f;
+    const TuningValues& tuning = GameTuning::get();
+    harpoonCooldown = hasRapidFire ? tuning.rapidFireCooldown : tuning.harpoonCooldown;
 }
 
 void PowerUpManager::collectPowerUp(const PowerUp& powerUp, Player& player, 
                                    int& playerLives, int& score) {
-    lastPowerUpCollected = GetTime();
+    lastPowerUpCollected = GameClock::now();
     
     switch (powerUp.getType()) {
         case PowerUpType::EXTRA_LIFE:
             playerLives++;
             powerUpMessage = "+1 LIFE!";
-            std::cout << "Extra Life! Lives: " << playerLives << std::endl;
+            GameLog::info() << "Extra Life! Lives: " << playerLives << std::endl;
             break;
             
         case PowerUpType::SCORE_MULTIPLIER:
             score += 500;
             powerUpMessage = "+500 BONUS!";
-            std::cout << "Score Bonus! +500 points" << std::endl;
+            GameLog::info() << "Score Bonus! +500 points" << std::endl;
             break;
             
         case PowerUpType::RAPID_FIRE:
             activePowerUps.emplace_back(PowerUpType::RAPID_FIRE, 15.0f);
             powerUpMessage = "RAPID FIRE!";
-            std::cout << "Rapid Fire activated for 15 seconds!" << std::endl;
+            GameLog::info() << "Rapid Fire activated for 15 seconds!" << std::endl;
             break;
             
         case PowerUpType::POWER_SHOT:
             activePowerUps.emplace_back(PowerUpType::POWER_SHOT, 20.0f);
             powerUpMessage = "POWER SHOT!";
-            std::cout << "Power Shot activated for 20 seconds!" << std::endl;
+            GameLog::info() << "Power Shot activated for 20 seconds!" << std::endl;
             break;
             
         case PowerUpType::SPEED_BOOST:
@@ -62,13 +66,13 @@ void PowerUpManager::collectPowerUp(const PowerUp& powerUp, Player& player,
             activePowerUps.emplace_back(PowerUpType::SPEED_BOOST, 12.0f);
             player.setSpeedMultiplier(0.5f);
             powerUpMessage = "SPEED BOOST!";
-            std::cout << "Speed Boost activated for 12 seconds!" << std::endl;
+            GameLog::info() << "Speed Boost activated for 12 seconds!" << std::endl;
             break;
             
         case PowerUpType::INVINCIBILITY:
             activePowerUps.emplace_back(PowerUpType::INVINCIBILITY, 10.0f);
             powerUpMessage = "INVINCIBLE!";
-            std::cout << "Invincibility activated for 10 seconds!" << std::endl;
+            GameLog::info() << "Invincibility activated for 10 seconds!" << std::endl;
             break;
             
         default:
@@ -88,30 +92,30 @@ bool PowerUpManager::hasPowerUpEffect(PowerUpType type) const {
 }
 
 float PowerUpManager::getTimeSinceLastCollection() const {
-    return GetTime() - lastPowerUpCollected;
+    return GameClock::now() - lastPowerUpCollected;
 }
 
 void PowerUpManager::handlePowerUpExpiration(PowerUpType type) {
     switch (type) {
         case PowerUpType::RAPID_FIRE:
-            std::cout << "Rapid Fire expired" << std::endl;
+            GameLog::info() << "Rapid Fire expired" << std::endl;
             powerUpMessage = "Rapid Fire ended";
-            lastPowerUpCollected = GetTime();
+            lastPowerUpCollected = GameClock::now();
             break;
         case PowerUpType::POWER_SHOT:
-            std::cout << "Power Shot expired" << std::endl;
+            GameLog::info() << "Power Shot expired" << std::endl;
             powerUpMessage = "Power Shot ended";
-            lastPowerUpCollected = GetTime();
+            lastPowerUpCollected = GameClock::now();
             break;
         case PowerUpType::SPEED_BOOST:
-            std::cout << "Speed Boost expired - resetting to normal" << std::endl;
+            GameLog::info() << "Speed Boost expired - resetting to normal" << std::endl;
             powerUpMessage = "Speed normal";
-            lastPowerUpCollected = GetTime();
+            lastPowerUpCollected = GameClock::now();
             break;
         case PowerUpType::INVINCIBILITY:
-            std::cout << "Invincibility expired" << std::endl;
+            GameLog::info() << "Invincibility expired" << std::endl;
             powerUpMessage = "Invincibility ended";
-            lastPowerUpCollected = GetTime();
+            lastPowerUpCollected = GameClock::now();
             break;
         default:
             break;
@@ -130,7 +134,7 @@ void PowerUpManager::reset() {
     activePowerUps.clear();
     lastPowerUpCollected = 0.0f;
     powerUpMessage = "";
-    harpoonCooldown = 0.8f;
+    harpoonCooldown = GameTuning::get().harpoonCooldown;
     hasRapidFire = false;
     hasPowerShot = false;
 }
@@ -146,6 +150,39 @@ void PowerUpManager::setPlayerReference(Player* player) {
 void PowerUpManager::applySpeedReset(Player& player) {
     if (!hasPowerUpEffect(PowerUpType::SPEED_BOOST)) {
         player.setSpeedMultiplier(1.0f);
-        std::cout << "Speed reset to normal (1.0x)" << std::endl;
+        GameLog::info() << "Speed reset to normal (1.0x)" << std::endl;
     }
 }
+
+void PowerUpManager::serialize(StateWriter& writer) const {
+    writer.write(static_cast<std::uint32_t>(activePowerUps.size()));
+    for (const auto& effect : activePowerUps) {
+        writer.write(effect.type);
+        writer.write(effect.startTime);
+        writer.write(effect.duration);
+        writer.write(effect.active);
+    }
+    writer.write(lastPowerUpCollected);
+    writer.writeString(powerUpMessage);
+    writer.write(harpoonCooldown);
+    writer.write(hasRapidFire);
+    writer.write(hasPowerShot);
+}
+
+void PowerUpManager::deserialize(StateReader& reader) {
+    std::uint32_t count = reader.readCount(static_cast<std::uint32_t>(PowerUpType::POWER_SHOT) + 1);
+    activePowerUps.clear();
+    for (std::uint32_t i = 0; i < count; ++i) {
+        PowerUpEffect effect(PowerUpType::EXTRA_LIFE, 0.0f);
+        reader.readEnum(effect.type, PowerUpType::POWER_SHOT);
+        reader.read(effect.startTime);
+        reader.read(effect.duration);
+        reader.read(effect.active);
+        activePowerUps.push_back(effect);
+    }
+    reader.read(lastPowerUpCollected);
+    powerUpMessage = reader.readString();
+    reader.read(harpoonCooldown);
+    reader.read(hasRapidFire);
+    reader.read(hasPowerShot);
+}
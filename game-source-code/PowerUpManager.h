@@ -7,6 +7,9 @@
 #include <vector>
 #include <string>
 
+class StateWriter;
+class StateReader;
+
 /**
  * @file PowerUpManager.h
  * @brief Manages active power-up effects and player stat modifications
@@ -82,7 +85,7 @@ public:
         return activePowerUps; 
     }
     
-    std::string getPowerUpMessage() const { return powerUpMessage; }
+    const std::string& getPowerUpMessage() const { return powerUpMessage; }
     float getTimeSinceLastCollection() const;
     
     /**
@@ -99,6 +102,18 @@ public:
     void setPlayerReference(Player* player);
     Player* getPlayerReference();
 
+    /**
+     * @brief Write active effects, cooldown and notification to a state snapshot
+     * @param writer Destination
+     */
+    void serialize(StateWriter& writer) const;
+    
+    /**
+     * @brief Restore state written by serialize()
+     * @param reader Source
+     */
+    void deserialize(StateReader& reader);
+
 private:
     void handlePowerUpExpiration(PowerUpType type);
     void updatePowerUpEffects();
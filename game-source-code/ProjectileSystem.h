@@ -0,0 +1,63 @@
+#ifndef PROJECTILESYSTEM_H
+#define PROJECTILESYSTEM_H
+
+#include "FireProjectile.h"
+#include "BlockGrid.h"
+#include <span>
+
+/**
+ * @file ProjectileSystem.h
+ * @brief Batch kinematic stepping for fire projectiles
+ */
+
+/**
+ * @class ProjectileSystem
+ * @brief Advances every live projectile by one shared time step
+ *
+ * The step is read once per tick and applied to the whole batch, so
+ * each projectile's motion depends only on its own timer and the step
+ * size - never on the number of projectiles alive. Hit tests run as a
+ * separate pass afterwards (see GameSimulation::updateFireProjectiles).
+ */
+class ProjectileSystem {
+public:
+    /**
+     * @brief Advance all projectiles
+     * @param fires Projectiles (pool or vector)
+     * @param deltaTime Seconds to simulate
+     */
+    static void step(std::span<FireProjectile> fires, float deltaTime) {
+        for (auto& fire : fires) {
+            fire.advance(deltaTime);
+        }
+    }
+    
+    /**
+     * @brief Advance all projectiles through terrain
+     * @param fires Projectiles (pool or vector)
+     * @param deltaTime Seconds to simulate
+     * @param terrain Grid whose earth blocks stop fireballs
+     */
+    static void step(std::span<FireProjectile> fires, float deltaTime, const BlockGrid& terrain) {
+        for (auto& fire : fires) {
+            fire.advance(deltaTime, [&terrain](Coordinate cell) { 
+                return terrain.isLocationBlocked(cell); 
+            });
+        }
+    }
+    
+    /**
+     * @brief Exact (sub-cell) position of a projectile in cell units
+     * @param fire Projectile
+     * @param row Output row (fractional)
+     * @param col Output column (fractional)
+     */
+    static void exactPosition(const FireProjectile& fire, float& row, float& col) {
+        Coordinate offset = directionOffset(fire.getDirection());
+        float progress = fire.getMoveProgress();
+        row = fire.getPosition().row + offset.row * progress;
+        col = fire.getPosition().col + offset.col * progress;
+    }
+};
+
+#endif // PROJECTILESYSTEM_H
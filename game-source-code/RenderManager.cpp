@@ -1,24 +1,51 @@
 #include "RenderManager.h"
 #include "AnimationSystem.h"
 #include <cmath>
+#include <algorithm>
 
 RenderManager::RenderManager(int cellSz, int screenW, int screenH) 
     : cellSize(cellSz), screenWidth(screenW), screenHeight(screenH),
-      hudHeight(Coordinate::HUD_ROWS * cellSz) {
+      hudHeight(Coordinate::HUD_ROWS * cellSz),
+      camera(screenW, screenH, Coordinate::WORLD_COLS * cellSz, Coordinate::WORLD_ROWS * cellSz),
+      cameraEpoch(0), cameraPlaced(false) {
+    atlas.build();
 }
 
-void RenderManager::drawTerrain(const BlockGrid& terrain) {
-    for (int row = 0; row < Coordinate::WORLD_ROWS; ++row) {
-        for (int col = 0; col < Coordinate::WORLD_COLS; ++col) {
-            Coordinate pos(row, col);
+void RenderManager::updateCamera(const RenderSnapshot& previous, 
+                                 const RenderSnapshot& current, float alpha, Vector2 shake) {
+    Coordinate from = canInterpolate(previous, current) ? 
+                      previous.player.position : current.player.position;
+    Vector2 focus = interpolatedCenter(from, current.player.position, alpha);
+    
+    if (!cameraPlaced || current.levelEpoch != cameraEpoch) {
+        camera.snapTo(focus);
+        cameraEpoch = current.levelEpoch;
+        cameraPlaced = true;
+    } else {
+        camera.follow(focus, GetFrameTime());
+    }
+    camera.setShake(shake);
+}
+
+void RenderManager::beginWorld() const {
+    BeginMode2D(camera.getCamera2D());
+}
+
+void RenderManager::endWorld() const {
+    EndMode2D();
+}
+
+void RenderManager::drawTerrain(const RenderSnapshot& snapshot) {
+    CellRange visible = camera.visibleCells(cellSize, Coordinate::WORLD_ROWS, 
+                                            Coordinate::WORLD_COLS);
+    // HUD rows are screen space (drawSky and the HUD), never world cells
+    int firstRow = std::max(visible.firstRow, static_cast<int>(Coordinate::HUD_ROWS));
+    for (int row = firstRow; row < visible.endRow; ++row) {
+        for (int col = visible.firstCol; col < visible.endCol; ++col) {
             int screenX = col * cellSize;
             int screenY = row * cellSize;
             
-            if (row < Coordinate::HUD_ROWS) {
-                if (row == 2) {
-                    drawSkyCell(screenX, screenY);
-                }
-            } else if (terrain.isLocationBlocked(pos)) {
+            if (snapshot.blocked[row][col]) {
                 drawEarthBlock(screenX, screenY);
             } else {
                 drawTunnelCell(screenX, screenY);
@@ -27,6 +54,13 @@ void RenderManager::drawTerrain(const BlockGrid& terrain) {
     }
 }
 
+void RenderManager::drawSky() {
+    int skyY = hudHeight - cellSize;
+    for (int x = 0; x < screenWidth; x += cellSize) {
+        drawSkyCell(x, skyY);
+    }
+}
+
 void RenderManager::drawSkyCell(int x, int y) {
     float time = GetTime() * 0.3f;
     float skyVariation = AnimationSystem::wave(0.5f, x * 0.01f) * 0.1f + 0.9f;
@@ -66,49 +100,51 @@ void RenderManager::drawTunnelCell(int x, int y) {
     DrawCircle(x + cellSize/2, y + cellSize/2, 1, LIGHTGRAY);
 }
 
-void RenderManager::drawPlayer(const Player& player, bool hasSpeedBoost, 
-                              bool isDigging) {
-    Coordinate pos = player.getPosition();
-    int screenX = pos.col * cellSize + cellSize / 2;
-    int screenY = pos.row * cellSize + cellSize / 2;
-    
-    Color playerColor = YELLOW;
+void RenderManager::drawPlayer(const RenderSnapshot& previous, 
+                              const RenderSnapshot& current, float alpha) {
+    Coordinate from = canInterpolate(previous, current) ? 
+                      previous.player.position : current.player.position;
+    Vector2 center = interpolatedCenter(from, current.player.position, alpha);
+    if (!camera.isVisible(center, cellSize)) return;
     
-    if (hasSpeedBoost) {
+    if (current.player.speedBoost) {
         float pulse = AnimationSystem::pulse(8.0f);
-        DrawCircleLines(screenX, screenY, 20, ColorAlpha(YELLOW, pulse));
-        DrawCircleLines(screenX, screenY, 24, ColorAlpha(SKYBLUE, pulse * 0.5f));
+        batch.addRing(center, 20, ColorAlpha(YELLOW, pulse));
+        batch.addRing(center, 24, ColorAlpha(SKYBLUE, pulse * 0.5f));
     }
     
     float scale = 1.0f;
-    if (isDigging) {
+    if (current.player.digging) {
         scale = 1.0f + AnimationSystem::pulse(10.0f) * 0.15f;
     }
     
-    int radius = static_cast<int>(16 * scale);
-    DrawCircle(screenX, screenY, radius, playerColor);
-    DrawCircleLines(screenX, screenY, radius, ORANGE);
-    DrawCircle(screenX - 6, screenY - 6, 3, BLACK);
-    DrawCircle(screenX + 6, screenY - 6, 3, BLACK);
+    batch.add(SpriteId::PLAYER, center, 16 * scale);
 }
 
-void RenderManager::drawEnemies(const std::vector<Enemy>& enemies) {
-    for (const auto& enemy : enemies) {
-        if (!enemy.isActive()) continue;
+void RenderManager::drawEnemies(const RenderSnapshot& previous, 
+                               const RenderSnapshot& current, float alpha) {
+    float phasePulse = AnimationSystem::pulse(6.0f);
+    bool interpolate = canInterpolate(previous, current);
+    
+    for (int i = 0; i < current.enemyCount; ++i) {
+        const RenderSnapshot::EnemyView& enemy = current.enemies[i];
+        if (!enemy.active) continue;
         
-        Coordinate pos = enemy.getPosition();
-        int screenX = pos.col * cellSize + cellSize / 2;
-        int screenY = pos.row * cellSize + cellSize / 2;
+        Coordinate from = (interpolate && i < previous.enemyCount) ? 
+                          previous.enemies[i].position : enemy.position;
+        Vector2 center = interpolatedCenter(from, enemy.position, alpha);
+        // Destroy burst spreads up to ~1.5 cells
+        if (!camera.isVisible(center, cellSize * 1.5f)) continue;
         
-        if (enemy.getIsDestroyed()) {
-            drawDestroyedEnemy(screenX, screenY, enemy.getDestroyProgress());
+        if (enemy.destroyed) {
+            drawDestroyedEnemy(center, enemy.destroyProgress);
         } else {
-            drawActiveEnemy(screenX, screenY, enemy);
+            drawActiveEnemy(center, enemy, phasePulse);
         }
     }
 }
 
-void RenderManager::drawDestroyedEnemy(int x, int y, float progress) {
+void RenderManager::drawDestroyedEnemy(Vector2 center, float progress) {
     float scale = 1.0f + AnimationSystem::easeOut(progress) * 2.0f;
     float alpha = 1.0f - AnimationSystem::easeIn(progress);
     
@@ -117,179 +153,166 @@ void RenderManager::drawDestroyedEnemy(int x, int y, float progress) {
     
     for (int i = 0; i < 3; ++i) {
         float circleScale = scale + i * 0.3f;
-        int radius = static_cast<int>(15 * circleScale);
-        DrawCircleLines(x, y, radius, destroyColor);
+        batch.addRing(center, 15 * circleScale, destroyColor);
     }
     
+    float distance = AnimationSystem::easeOut(progress) * 30;
     for (int i = 0; i < 8; ++i) {
         float angle = (i * 45.0f) * DEG2RAD;
-        float distance = AnimationSystem::easeOut(progress) * 30;
-        int px = x + static_cast<int>(cos(angle) * distance);
-        int py = y + static_cast<int>(sin(angle) * distance);
-        DrawCircle(px, py, 2, destroyColor);
+        Vector2 dot = {center.x + std::cos(angle) * distance, 
+                       center.y + std::sin(angle) * distance};
+        batch.addCircle(dot, 2, destroyColor);
     }
 }
 
-void RenderManager::drawActiveEnemy(int x, int y, const Enemy& enemy) {
-    Color color;
-    
-    if (enemy.getEnemyType() == EnemyType::GREEN_DRAGON) {
-        color = GREEN;
-    } else if (enemy.getEnemyType() == EnemyType::AGGRESSIVE_MONSTER) {
-        color = Color{139, 0, 0, 255};
-    } else {
-        color = RED;
-    }
+void RenderManager::drawActiveEnemy(Vector2 center, 
+                                   const RenderSnapshot::EnemyView& enemy, 
+                                   float phasePulse) {
+    Color tint = WHITE;
     
-    if (enemy.getIsPhasing()) {
-        float pulse = AnimationSystem::pulse(6.0f);
-        color = ColorAlpha(color, 0.4f + pulse * 0.3f);
+    if (enemy.phasing) {
+        tint = ColorAlpha(WHITE, 0.4f + phasePulse * 0.3f);
     }
     
-    DrawCircle(x, y, 15, color);
-    DrawCircleLines(x, y, 15, MAROON);
-    DrawCircle(x - 5, y - 5, 2, BLACK);
-    DrawCircle(x + 5, y - 5, 2, BLACK);
-    
-    if (enemy.getEnemyType() == EnemyType::GREEN_DRAGON) {
-        DrawCircle(x, y + 8, 3, ORANGE);
-    }
+    batch.add(SpriteAtlas::getEnemySprite(enemy.type), center, 15, tint);
 }
 
-void RenderManager::drawHarpoons(const std::vector<Harpoon>& harpoons, 
-                                bool hasPowerShot) {
-    for (const auto& harpoon : harpoons) {
-        if (!harpoon.isActive()) continue;
-        
-        const auto& segments = harpoon.getSegments();
-        float pulse = AnimationSystem::pulse(8.0f);
-        
-        Color color = hasPowerShot ? 
-            AnimationSystem::lerpColor(ORANGE, RED, pulse * 0.3f) :
-            Color{50, 255, 50, 255};
+void RenderManager::drawHarpoons(const RenderSnapshot& snapshot) {
+    bool hasPowerShot = snapshot.hud.hasPowerShot;
+    float pulse = AnimationSystem::pulse(8.0f);
+    Color color = hasPowerShot ? 
+        AnimationSystem::lerpColor(ORANGE, RED, pulse * 0.3f) :
+        Color{50, 255, 50, 255};
+    
+    for (int h = 0; h < snapshot.harpoonCount; ++h) {
+        const RenderSnapshot::HarpoonView& harpoon = snapshot.harpoons[h];
         
-        for (size_t i = 0; i < segments.size(); ++i) {
-            Coordinate pos = segments[i];
-            int screenX = pos.col * cellSize + cellSize / 2;
-            int screenY = pos.row * cellSize + cellSize / 2;
+        for (int i = 0; i < harpoon.segmentCount; ++i) {
+            Vector2 center = cellCenter(harpoon.segments[i]);
+            if (!camera.isVisible(center, cellSize)) continue;
+            
+            if (i > 0) {
+                addLine(cellCenter(harpoon.segments[i - 1]), center, color);
+            }
             
-            if (i == segments.size() - 1) {
+            if (i == harpoon.segmentCount - 1) {
                 int tipSize = hasPowerShot ? 7 : 5;
                 float scale = 1.0f + pulse * 0.2f;
-                DrawCircle(screenX, screenY, static_cast<int>(tipSize * scale), color);
-                DrawCircleLines(screenX, screenY, tipSize + 2, WHITE);
+                batch.addCircle(center, tipSize * scale, color);
+                batch.addRing(center, tipSize + 2, WHITE);
             } else {
-                DrawCircle(screenX, screenY, i == 0 ? 4 : 3, color);
-            }
-            
-            if (i > 0) {
-                Coordinate prevPos = segments[i-1];
-                int prevX = prevPos.col * cellSize + cellSize / 2;
-                int prevY = prevPos.row * cellSize + cellSize / 2;
-                DrawLine(prevX, prevY, screenX, screenY, color);
+                batch.addCircle(center, i == 0 ? 4 : 3, color);
             }
         }
     }
 }
 
-void RenderManager::drawPowerUps(const std::vector<PowerUp>& powerUps) {
-    for (const auto& powerUp : powerUps) {
-        if (!powerUp.isActive()) continue;
-        
-        Coordinate pos = powerUp.getPosition();
-        int screenX = pos.col * cellSize + cellSize / 2;
-        int screenY = pos.row * cellSize + cellSize / 2;
-        
-        float pulse = AnimationSystem::pulse(4.0f);
-        float bounce = AnimationSystem::wave(2.0f) * 6;
-        float scale = 1.0f + pulse * 0.3f;
-        
-        Color color = getPowerUpColor(powerUp.getType());
-        Color glowColor = ColorAlpha(color, 0.4f);
-        
-        int baseY = screenY - static_cast<int>(bounce);
-        int size = static_cast<int>(18 * scale);
+void RenderManager::drawPowerUps(const RenderSnapshot& snapshot) {
+    float pulse = AnimationSystem::pulse(4.0f);
+    float bounce = AnimationSystem::wave(2.0f) * 6;
+    float scale = 1.0f + pulse * 0.3f;
+    
+    for (int i = 0; i < snapshot.powerUpCount; ++i) {
+        const RenderSnapshot::PowerUpView& powerUp = snapshot.powerUps[i];
         
-        DrawCircle(screenX, baseY, size + 6, glowColor);
-        DrawCircle(screenX, baseY, size + 3, ColorAlpha(WHITE, 0.3f));
-        DrawCircle(screenX, baseY, size, color);
-        DrawCircleLines(screenX, baseY, size + 1, WHITE);
+        Vector2 center = cellCenter(powerUp.position);
+        center.y -= bounce;
+        if (!camera.isVisible(center, cellSize)) continue;
         
-        std::string symbol = getPowerUpSymbol(powerUp.getType());
-        int symbolSize = 20;
-        int symbolWidth = MeasureText(symbol.c_str(), symbolSize);
-        DrawText(symbol.c_str(), screenX - symbolWidth/2, 
-                baseY - symbolSize/2, symbolSize, BLACK);
+        batch.add(SpriteAtlas::getPowerUpSprite(powerUp.type), center, 24 * scale);
     }
 }
 
-void RenderManager::drawRocks(const std::vector<Rock>& rocks, const Player& player) {
-    for (const auto& rock : rocks) {
-        if (!rock.isActive()) continue;
-        
-        Coordinate pos = rock.getPosition();
-        int screenX = pos.col * cellSize + cellSize / 2;
-        int screenY = pos.row * cellSize + cellSize / 2;
+void RenderManager::drawRocks(const RenderSnapshot& previous, 
+                             const RenderSnapshot& current, float alpha) {
+    float pulse = AnimationSystem::pulse(10.0f);
+    bool interpolate = canInterpolate(previous, current);
+    
+    for (int i = 0; i < current.rockCount; ++i) {
+        const RenderSnapshot::RockView& rock = current.rocks[i];
+        if (!rock.active) continue;
         
-        Color rockColor = PURPLE;
+        Coordinate from = (interpolate && i < previous.rockCount) ? 
+                          previous.rocks[i].position : rock.position;
+        Vector2 center = interpolatedCenter(from, rock.position, alpha);
+        if (!camera.isVisible(center, cellSize)) continue;
         
-        if (rock.getIsFalling()) {
-            float pulse = AnimationSystem::pulse(10.0f);
-            rockColor = AnimationSystem::lerpColor(PURPLE, RED, pulse);
-            
-            DrawCircle(screenX, screenY - 5, 16, ColorAlpha(RED, 0.3f));
+        if (rock.falling) {
+            batch.addCircle(Vector2{center.x, center.y - 5}, 16, ColorAlpha(RED, 0.3f));
+            batch.add(SpriteId::ROCK, center, 18);
+            batch.add(SpriteId::ROCK_FALLING, center, 18, ColorAlpha(WHITE, pulse));
+        } else {
+            batch.add(SpriteId::ROCK, center, 18);
         }
-        
-        DrawCircle(screenX, screenY, 18, rockColor);
-        DrawCircleLines(screenX, screenY, 18, WHITE);
-        DrawText("ROCK", screenX - 15, screenY - 6, 12, WHITE);
     }
 }
 
-void RenderManager::drawFireProjectiles(const std::vector<FireProjectile>& fires) {
-    for (const auto& fire : fires) {
-        if (!fire.isActive()) continue;
-        
-        const auto& trail = fire.getTrail();
-        float pulse = AnimationSystem::pulse(15.0f);
+void RenderManager::drawFireProjectiles(const RenderSnapshot& snapshot) {
+    float pulse = AnimationSystem::pulse(15.0f);
+    Color baseColor = AnimationSystem::lerpColor(ORANGE, RED, pulse);
+    
+    for (int f = 0; f < snapshot.fireCount; ++f) {
+        const RenderSnapshot::FireView& fire = snapshot.fires[f];
         
-        for (size_t i = 0; i < trail.size(); ++i) {
-            Coordinate pos = trail[i];
-            int screenX = pos.col * cellSize + cellSize / 2;
-            int screenY = pos.row * cellSize + cellSize / 2;
+        for (int i = 0; i < fire.trailLength; ++i) {
+            bool isHead = (i == fire.trailLength - 1);
+            Vector2 center = cellCenter(fire.trail[i]);
+            if (isHead) {
+                // Head glides toward its next cell between steps
+                Coordinate step = directionOffset(fire.direction);
+                center.x += step.col * cellSize * fire.progress;
+                center.y += step.row * cellSize * fire.progress;
+            }
+            if (!camera.isVisible(center, cellSize)) continue;
             
-            float alpha = (i + 1.0f) / trail.size();
-            Color fireColor = AnimationSystem::lerpColor(ORANGE, RED, pulse);
-            fireColor = ColorAlpha(fireColor, alpha);
+            float alpha = (i + 1.0f) / fire.trailLength;
+            Color fireColor = ColorAlpha(baseColor, alpha);
             
-            int size = (i == trail.size() - 1) ? 8 : 5;
-            DrawCircle(screenX, screenY, size, fireColor);
+            int size = isHead ? 8 : 5;
+            batch.addCircle(center, size, fireColor);
             
-            if (i == trail.size() - 1) {
-                DrawCircleLines(screenX, screenY, size + 2, YELLOW);
+            if (isHead) {
+                batch.addRing(center, size + 2, YELLOW);
             }
         }
     }
 }
 
-std::string RenderManager::getPowerUpSymbol(PowerUpType type) {
-    switch (type) {
-        case PowerUpType::EXTRA_LIFE: return "+";
-        case PowerUpType::SCORE_MULTIPLIER: return "$";
-        case PowerUpType::RAPID_FIRE: return "R";
-        case PowerUpType::POWER_SHOT: return "P";
-        case PowerUpType::SPEED_BOOST: return "S";
-        default: return "?";
-    }
+void RenderManager::flushEntities() {
+    batch.flush(atlas);
+}
+
+Vector2 RenderManager::cellCenter(Coordinate pos) const {
+    return Vector2{
+        pos.col * cellSize + cellSize / 2.0f,
+        pos.row * cellSize + cellSize / 2.0f
+    };
 }
 
-Color RenderManager::getPowerUpColor(PowerUpType type) {
-    switch (type) {
-        case PowerUpType::EXTRA_LIFE: return Color{0, 255, 100, 255};
-        case PowerUpType::SCORE_MULTIPLIER: return GOLD;
-        case PowerUpType::RAPID_FIRE: return Color{0, 255, 255, 255};
-        case PowerUpType::POWER_SHOT: return ORANGE;
-        case PowerUpType::SPEED_BOOST: return Color{255, 255, 0, 255};
-        default: return WHITE;
+Vector2 RenderManager::interpolatedCenter(Coordinate from, Coordinate to, 
+                                          float alpha) const {
+    Vector2 target = cellCenter(to);
+    if (from == to || from.manhattanDistance(to) != 1) {
+        return target;
     }
+    
+    Vector2 origin = cellCenter(from);
+    return Vector2{
+        origin.x + (target.x - origin.x) * alpha,
+        origin.y + (target.y - origin.y) * alpha
+    };
+}
+
+bool RenderManager::canInterpolate(const RenderSnapshot& previous, 
+                                   const RenderSnapshot& current) {
+    return previous.levelEpoch == current.levelEpoch && 
+           previous.tick + 1 == current.tick;
+}
+
+void RenderManager::addLine(Vector2 from, Vector2 to, Color color) {
+    float left = std::min(from.x, to.x);
+    float top = std::min(from.y, to.y);
+    float width = std::max(1.0f, std::fabs(to.x - from.x));
+    float height = std::max(1.0f, std::fabs(to.y - from.y));
+    batch.addRect(Rectangle{left, top, width, height}, color);
 }
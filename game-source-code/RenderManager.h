@@ -3,14 +3,10 @@
 
 #include <raylib-cpp.hpp>
 #include "Coordinate.h"
-#include "Player.h"
-#include "Enemy.h"
-#include "Harpoon.h"
-#include "PowerUp.h"
-#include "Rock.h"
-#include "BlockGrid.h"
-#include "FireProjectile.h"
-#include <string>
+#include "GameCamera.h"
+#include "RenderSnapshot.h"
+#include "SpriteAtlas.h"
+#include "SpriteBatch.h"
 
 /**
  * @file RenderManager.h
@@ -34,6 +30,27 @@
  * 4. Weapons (harpoons, fire projectiles)
  * 5. Particles and effects
  * 
+ * Entity batching:
+ * - All entity looks are baked once into a SpriteAtlas
+ * - Entity draws queue quads into a SpriteBatch
+ * - flushEntities() submits every quad from one texture
+ * 
+ * Camera and culling:
+ * - World layers draw between beginWorld()/endWorld() through a
+ *   GameCamera that follows the (interpolated) player
+ * - Terrain draws only the cells inside the view; entities, harpoon
+ *   segments and fireballs outside it queue no quads
+ * - Draw cost therefore follows what is on screen, not the world size
+ * - The world is the fixed WORLD_COLS x WORLD_ROWS grid, which matches
+ *   the window, so today the view stays put and only shakes
+ * - HUD rows (sky strip, HUD, overlays) draw after endWorld() in screen
+ *   space, so the camera never moves them
+ * 
+ * Snapshot input:
+ * - Draws only from RenderSnapshot, never from live game objects
+ * - Player, enemies and rocks move smoothly between two snapshots
+ *   (one-cell steps only; teleports and level changes snap)
+ * 
  * Visual features:
  * - Smooth animations using easing functions
  * - Pulsing effects for active states
@@ -42,7 +59,7 @@
  * - Phase-through transparency
  * 
  * Coordinate system:
- * - Grid: 20 rows × 30 columns
+ * - Grid: 20 rows × 30 columns (world space, playable rows only)
  * - Cell size: 40×40 pixels
  * - Screen: 1200×800 pixels
  * - HUD area: Top 3 rows (120 pixels)
@@ -55,6 +72,11 @@ private:
     const int screenWidth;
     const int screenHeight;
     const int hudHeight;
+    SpriteAtlas atlas;
+    SpriteBatch batch;
+    GameCamera camera;
+    unsigned int cameraEpoch;
+    bool cameraPlaced;
 
 public:
     /**
@@ -66,50 +88,90 @@ public:
     RenderManager(int cellSz, int screenW, int screenH);
     
     /**
-     * @brief Draw terrain grid (earth blocks and tunnels)
-     * @param terrain BlockGrid to render
+     * @brief Move the camera toward the player for this frame
+     * @param previous Snapshot of the previous tick
+     * @param current Latest snapshot
+     * @param alpha Interpolation factor between ticks (0.0-1.0)
+     * @param shake Screen shake offset in pixels
+     * @note Snaps instead of easing on a new level
+     */
+    void updateCamera(const RenderSnapshot& previous, const RenderSnapshot& current,
+                      float alpha, Vector2 shake);
+    
+    /**
+     * @brief Start drawing in world space (BeginMode2D with the camera)
      */
-    void drawTerrain(const BlockGrid& terrain);
+    void beginWorld() const;
+    
+    /**
+     * @brief Return to screen space for HUD and overlays
+     */
+    void endWorld() const;
+    
+    const GameCamera& getCamera() const { return camera; }
+    
+    /**
+     * @brief Draw visible terrain cells (earth blocks and tunnels)
+     * @param snapshot Snapshot holding terrain cells
+     */
+    void drawTerrain(const RenderSnapshot& snapshot);
+    
+    /**
+     * @brief Draw the animated sky strip under the HUD (screen space)
+     * @note Call after endWorld(), before the HUD text
+     */
+    void drawSky();
     
     /**
      * @brief Draw player character
-     * @param player Player to render
-     * @param hasSpeedBoost true if speed boost active (glow effect)
-     * @param isDigging true if digging (pulse effect)
+     * @param previous Snapshot of the previous tick
+     * @param current Latest snapshot
+     * @param alpha Interpolation factor between ticks (0.0-1.0)
      */
-    void drawPlayer(const Player& player, bool hasSpeedBoost, bool isDigging);
+    void drawPlayer(const RenderSnapshot& previous, const RenderSnapshot& current, 
+                   float alpha);
     
     /**
-     * @brief Draw all enemies
-     * @param enemies Enemy vector to render
+     * @brief Draw all enemies (interpolated by slot)
+     * @param previous Snapshot of the previous tick
+     * @param current Latest snapshot
+     * @param alpha Interpolation factor between ticks (0.0-1.0)
      */
-    void drawEnemies(const std::vector<Enemy>& enemies);
+    void drawEnemies(const RenderSnapshot& previous, const RenderSnapshot& current, 
+                    float alpha);
     
     /**
      * @brief Draw all harpoons
-     * @param harpoons Harpoon vector to render
-     * @param hasPowerShot true for enhanced visual effect
+     * @param snapshot Latest snapshot (power shot flag from HUD)
      */
-    void drawHarpoons(const std::vector<Harpoon>& harpoons, bool hasPowerShot);
+    void drawHarpoons(const RenderSnapshot& snapshot);
     
     /**
      * @brief Draw all power-ups
-     * @param powerUps PowerUp vector to render
+     * @param snapshot Latest snapshot
      */
-    void drawPowerUps(const std::vector<PowerUp>& powerUps);
+    void drawPowerUps(const RenderSnapshot& snapshot);
     
     /**
-     * @brief Draw all rocks
-     * @param rocks Rock vector to render
-     * @param player Player reference for danger indication
+     * @brief Draw all rocks (interpolated by slot)
+     * @param previous Snapshot of the previous tick
+     * @param current Latest snapshot
+     * @param alpha Interpolation factor between ticks (0.0-1.0)
      */
-    void drawRocks(const std::vector<Rock>& rocks, const Player& player);
+    void drawRocks(const RenderSnapshot& previous, const RenderSnapshot& current, 
+                  float alpha);
     
     /**
      * @brief Draw fire projectiles
-     * @param fires FireProjectile vector to render
+     * @param snapshot Latest snapshot
+     */
+    void drawFireProjectiles(const RenderSnapshot& snapshot);
+    
+    /**
+     * @brief Submit all entity quads queued by the draw calls
+     * @note Call once after the last entity layer, before particles
      */
-    void drawFireProjectiles(const std::vector<FireProjectile>& fires);
+    void flushEntities();
     
     /**
      * @brief Draw sky cell with animated clouds
@@ -121,10 +183,14 @@ public:
 private:
     void drawEarthBlock(int x, int y);
     void drawTunnelCell(int x, int y);
-    void drawDestroyedEnemy(int x, int y, float progress);
-    void drawActiveEnemy(int x, int y, const Enemy& enemy);
-    Color getPowerUpColor(PowerUpType type);
-    std::string getPowerUpSymbol(PowerUpType type);
+    void drawDestroyedEnemy(Vector2 center, float progress);
+    void drawActiveEnemy(Vector2 center, const RenderSnapshot::EnemyView& enemy, 
+                        float phasePulse);
+    Vector2 cellCenter(Coordinate pos) const;
+    Vector2 interpolatedCenter(Coordinate from, Coordinate to, float alpha) const;
+    static bool canInterpolate(const RenderSnapshot& previous, 
+                               const RenderSnapshot& current);
+    void addLine(Vector2 from, Vector2 to, Color color);
 };
 
 #endif // RENDERMANAGER_H
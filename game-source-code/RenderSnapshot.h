@@ -0,0 +1,126 @@
+#ifndef RENDERSNAPSHOT_H
+#define RENDERSNAPSHOT_H
+
+#include "Coordinate.h"
+#include "Direction.h"
+#include "GameState.h"
+#include "Enemy.h"
+#include "PowerUp.h"
+
+/**
+ * @file RenderSnapshot.h
+ * @brief Immutable per-tick view of the simulation for rendering
+ */
+
+/**
+ * @struct RenderSnapshot
+ * @brief Compact, fixed-size copy of everything the renderer draws
+ *
+ * The simulation fills one snapshot at the end of every tick and hands
+ * it to the render loop through a TripleBuffer. The renderer never
+ * touches live game objects, so it can run at display rate on another
+ * thread without locks.
+ *
+ * Layout rules:
+ * - Plain data only (no pointers, no heap) - safe to copy and share
+ * - Fixed capacities; entities beyond capacity are not drawn
+ * - Enemy and rock slots keep their index for the whole level, so the
+ *   renderer can interpolate slot i between two snapshots
+ * - Terrain is copied only when its generation changed
+ *
+ * @note levelEpoch changes on every level (re)start - never interpolate
+ *       across different epochs
+ */
+struct RenderSnapshot {
+    static const int MAX_ENEMIES = 16;
+    static const int MAX_ROCKS = 24;
+    static const int MAX_POWERUPS = 8;
+    static const int MAX_HARPOONS = 8;
+    static constexpr int MAX_HARPOON_SEGMENTS = 8;
+    static const int MAX_FIRES = 16;
+    static constexpr int MAX_FIRE_TRAIL = 5;
+    static const int MAX_EFFECTS = 4;
+    static const int MESSAGE_LENGTH = 32;
+
+    struct PlayerView {
+        Coordinate position;
+        bool digging;
+        bool speedBoost;
+    };
+
+    struct EnemyView {
+        Coordinate position;
+        EnemyType type;
+        bool active;
+        bool destroyed;
+        bool phasing;
+        float destroyProgress;
+    };
+
+    struct RockView {
+        Coordinate position;
+        bool active;
+        bool falling;
+    };
+
+    struct PowerUpView {
+        Coordinate position;
+        PowerUpType type;
+    };
+
+    struct HarpoonView {
+        Coordinate segments[MAX_HARPOON_SEGMENTS];
+        int segmentCount;
+    };
+
+    struct FireView {
+        Coordinate trail[MAX_FIRE_TRAIL];
+        int trailLength;
+        Direction direction;
+        float progress;     ///< Head's fraction of the way to its next cell
+    };
+
+    struct EffectView {
+        PowerUpType type;
+        float remaining; ///< Seconds left
+    };
+
+    struct HudView {
+        int level;
+        int score;
+        int targetScore;
+        int lives;
+        float levelTimer;
+        bool canFireHarpoon;
+        float harpoonProgress;   ///< Cooldown progress (0.0-1.0)
+        bool hasPowerShot;
+        EffectView effects[MAX_EFFECTS];
+        int effectCount;
+        char message[MESSAGE_LENGTH];
+        float timeSinceMessage;
+    };
+
+    unsigned int tick = 0;           ///< Simulation tick that produced it
+    unsigned int levelEpoch = 0;     ///< Level instance counter
+    double simTime = 0.0;            ///< GameClock time at capture
+    GameState state = GameState::MENU;
+
+    unsigned int terrainGeneration = 0;
+    bool terrainValid = false;       ///< false until terrain first copied
+    bool blocked[Coordinate::WORLD_ROWS][Coordinate::WORLD_COLS] = {};
+
+    PlayerView player{};
+    EnemyView enemies[MAX_ENEMIES]{};
+    int enemyCount = 0;
+    RockView rocks[MAX_ROCKS]{};
+    int rockCount = 0;
+    PowerUpView powerUps[MAX_POWERUPS]{};
+    int powerUpCount = 0;
+    HarpoonView harpoons[MAX_HARPOONS]{};
+    int harpoonCount = 0;
+    FireView fires[MAX_FIRES]{};
+    int fireCount = 0;
+    HudView hud{};
+};
+
+#endif // RENDERSNAPSHOT_H
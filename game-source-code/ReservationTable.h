@@ -0,0 +1,117 @@
+#ifndef RESERVATIONTABLE_H
+#define RESERVATIONTABLE_H
+
+#include "Coordinate.h"
+#include <cstdint>
+
+/**
+ * @file ReservationTable.h
+ * @brief Space-time cell claims so enemies don't stack on one cell
+ */
+
+/**
+ * @class ReservationTable
+ * @brief Who holds each grid cell for each of the next HORIZON ticks
+ *
+ * Cooperative-pathfinding style: before an enemy steps into a cell it
+ * checks the cell is not held by anyone else for the arrival tick and
+ * the one after, then claims it for as long as it will stand there.
+ * Enemies processed later in the tick see those claims and path around.
+ *
+ * Layout and cost:
+ * - One entry per (step, cell) with the same flat cell index as
+ *   BlockGrid (Coordinate::toIndex()); step 0 is the current tick
+ * - claim()/isFree()/ownerAt() touch a single entry: O(1)
+ * - beginTick() forgets every claim in O(1) by bumping a stamp, so the
+ *   table is rebuilt from enemy state each tick and never needs saving
+ *   for rollback or replays
+ *
+ * Conflicts: a claim wins over a lower-priority claim and loses to an
+ * equal or higher one (first come wins ties). HOLD_PRIORITY marks cells
+ * enemies are standing on, which nobody can take.
+ */
+class ReservationTable {
+public:
+    static const int HORIZON = 8;
+    static const int CELLS = Coordinate::WORLD_ROWS * Coordinate::WORLD_COLS;
+    static const int NO_OWNER = -1;
+    static const int HOLD_PRIORITY = 255;
+
+    ReservationTable() : stamp(1) {
+        for (auto& step : entries) {
+            for (auto& entry : step) {
+                entry = Entry{0, NO_OWNER, 0};
+            }
+        }
+    }
+
+    /**
+     * @brief Drop all claims; step 0 becomes the new current tick
+     */
+    void beginTick() {
+        stamp++;
+    }
+
+    /**
+     * @brief Check whether an agent may claim a cell at a step
+     * @param cell Grid cell
+     * @param step Ticks from now (0 to HORIZON-1)
+     * @param owner Asking agent (its own claims count as free)
+     * @param priority Asking agent's priority
+     */
+    bool isFree(Coordinate cell, int step, int owner, int priority) const {
+        const Entry* entry = find(cell, step);
+        if (!entry) return false;
+        return entry->stamp != stamp || entry->owner == owner || entry->priority < priority;
+    }
+
+    /**
+     * @brief Claim a cell for one step
+     * @return true if claimed (false: out of range or held by equal/higher priority)
+     */
+    bool claim(Coordinate cell, int step, int owner, int priority) {
+        if (!isFree(cell, step, owner, priority)) return false;  // also range-checks
+        entries[step][cell.toIndex()] = Entry{stamp, static_cast<std::int16_t>(owner),
+                                              static_cast<std::uint8_t>(priority)};
+        return true;
+    }
+
+    /**
+     * @brief Claim a cell for consecutive steps (clipped to the horizon)
+     * @return int Steps actually claimed
+     */
+    int claimSpan(Coordinate cell, int firstStep, int steps, int owner, int priority) {
+        int claimed = 0;
+        for (int step = firstStep; step < firstStep + steps && step < HORIZON; ++step) {
+            if (claim(cell, step, owner, priority)) {
+                claimed++;
+            }
+        }
+        return claimed;
+    }
+
+    /**
+     * @brief Agent holding a cell at a step (NO_OWNER if none)
+     */
+    int ownerAt(Coordinate cell, int step) const {
+        const Entry* entry = find(cell, step);
+        return (entry && entry->stamp == stamp) ? entry->owner : NO_OWNER;
+    }
+
+private:
+    struct Entry {
+        std::uint32_t stamp;
+        std::int16_t owner;
+        std::uint8_t priority;
+    };
+
+    Entry entries[HORIZON][CELLS];
+    std::uint32_t stamp;
+
+    const Entry* find(Coordinate cell, int step) const {
+        if (step < 0 || step >= HORIZON || !cell.isWithinBounds()) return nullptr;
+        return &entries[step][cell.toIndex()];
+    }
+};
+
+#endif // RESERVATIONTABLE_H
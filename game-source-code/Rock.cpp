@@ -1,7 +1,10 @@
 #include "Rock.h"
+#include "StateSerializer.h"
+#include "GameClock.h"
 #include "Player.h"
 #include "Enemy.h"
 #include "GameConstants.h"
+#include "GameTuning.h"
 #include <raylib-cpp.hpp>
 #include <iostream>
 
@@ -16,7 +19,7 @@ Rock::Rock(Coordinate pos) : GameObject(pos), fallTimer(0.0f), stabilityCheckTim
 
 void Rock::update() {
     if (isFalling) {
-        crushTimer += GetFrameTime();
+        crushTimer += GameClock::frameTime();
     } else {
         crushTimer = 0.0f;
     }
@@ -34,9 +37,9 @@ bool Rock::hasSupport(const BlockGrid& terrain) const {
 }
 
 void Rock::checkStability(const BlockGrid& terrain) {
-    stabilityCheckTimer += GetFrameTime();
+    stabilityCheckTimer += GameClock::frameTime();
     
-    if (stabilityCheckTimer >= ROCK_STABILITY_CHECK_INTERVAL) {
+    if (stabilityCheckTimer >= GameTuning::get().rockStabilityInterval) {
         bool hasSupp = hasSupport(terrain);
         
         if (!hasSupp && !isFalling) {
@@ -53,9 +56,9 @@ void Rock::applyGravity(const BlockGrid& terrain) {
     checkStability(terrain);
     
     if (!hasSupport(terrain) && isFalling) {
-        fallTimer += GetFrameTime();
+        fallTimer += GameClock::frameTime();
         
-        if (fallTimer >= ROCK_FALL_SPEED) {
+        if (fallTimer >= GameTuning::get().rockFallInterval) {
             Coordinate newPos = position + Coordinate(1, 0);
             
             if (newPos.row >= Coordinate::WORLD_ROWS || terrain.isLocationBlocked(newPos)) {
@@ -133,7 +136,7 @@ bool Rock::shouldResetCrushTimer(const Coordinate& playerPos) const {
 void Rock::updatePlayerMovementTracking(const Player& player) {
     if (!isFalling) return;
     
-    float currentTime = GetTime();
+    float currentTime = GameClock::now();
     
     if (currentTime - lastPlayerCheckTime >= ENEMY_MOVE_CHECK_INTERVAL) {
         if (lastPlayerPosition.row != -1) {
@@ -146,7 +149,8 @@ void Rock::updatePlayerMovementTracking(const Player& player) {
 }
 
 float Rock::getActiveCrushDelay() const {
-    return playerIsMovingAway ? ROCK_CRUSH_DELAY : ROCK_STATIONARY_CRUSH_DELAY;
+    const TuningValues& tuning = GameTuning::get();
+    return playerIsMovingAway ? tuning.rockCrushDelay : tuning.rockStationaryCrushDelay;
 }
 
 float Rock::getCrushTimeRemaining() const {
@@ -179,3 +183,29 @@ void Rock::stopFalling() {
         playerIsMovingAway = false;
     }
 }
+
+void Rock::serialize(StateWriter& writer) const {
+    writer.write(position);
+    writer.write(active);
+    writer.write(fallTimer);
+    writer.write(stabilityCheckTimer);
+    writer.write(crushTimer);
+    writer.write(lastPlayerCheckTime);
+    writer.write(lastPlayerPosition);
+    writer.write(isFalling);
+    writer.write(hasLanded);
+    writer.write(playerIsMovingAway);
+}
+
+void Rock::deserialize(StateReader& reader) {
+    reader.readPosition(position);
+    reader.read(active);
+    reader.read(fallTimer);
+    reader.read(stabilityCheckTimer);
+    reader.read(crushTimer);
+    reader.read(lastPlayerCheckTime);
+    reader.readPosition(lastPlayerPosition);
+    reader.read(isFalling);
+    reader.read(hasLanded);
+    reader.read(playerIsMovingAway);
+}
@@ -5,6 +5,9 @@
 #include "Coordinate.h"
 #include "BlockGrid.h"
 
+class StateWriter;
+class StateReader;
+
 class Player;
 class Enemy;
 
@@ -106,6 +109,18 @@ public:
     bool getHasLanded() const { return hasLanded; }
     float getCrushTimeRemaining() const;
 
+    /**
+     * @brief Write rock physics and crush timers to a state snapshot
+     * @param writer Destination
+     */
+    void serialize(StateWriter& writer) const;
+    
+    /**
+     * @brief Restore state written by serialize()
+     * @param reader Source
+     */
+    void deserialize(StateReader& reader);
+
 private:
     void startFalling();
     void stopFalling();
@@ -0,0 +1,182 @@
+#include "RollbackBuffer.h"
+#include "GameSimulation.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    const std::size_t MERGE_GAP = 8;       ///< Unchanged bytes bridged inside one run
+    const std::size_t MAX_RUN = 0xFFFF;
+
+    void appendRun(std::vector<unsigned char>& undo, const unsigned char* source,
+                   std::uint32_t offset, std::size_t length) {
+        while (length > 0) {
+            std::uint16_t chunk = static_cast<std::uint16_t>(std::min(length, MAX_RUN));
+            std::size_t at = undo.size();
+            undo.resize(at + sizeof(offset) + sizeof(chunk) + chunk);
+            std::memcpy(&undo[at], &offset, sizeof(offset));
+            std::memcpy(&undo[at + sizeof(offset)], &chunk, sizeof(chunk));
+            std::memcpy(&undo[at + sizeof(offset) + sizeof(chunk)], source + offset, chunk);
+            offset += chunk;
+            length -= chunk;
+        }
+    }
+}
+
+RollbackBuffer::RollbackBuffer(int capacity)
+    : ring(static_cast<std::size_t>(std::max(1, capacity))), head(0), count(0) {
+}
+
+void RollbackBuffer::reset(const GameSimulation& simulation) {
+    simulation.saveState(current);
+    head = 0;
+    count = 0;
+}
+
+void RollbackBuffer::advance(GameSimulation& simulation, const InputFrame& input) {
+    TickRecord& record = ring[head];
+    record.tick = simulation.getTick();
+    record.input = input;
+    record.previousSize = static_cast<std::uint32_t>(current.size());
+
+    simulation.step(input);
+    simulation.saveState(scratch);
+    encodeUndo(current, scratch, record.undo);
+    current.swap(scratch);
+
+    head = (head + 1) % static_cast<int>(ring.size());
+    count = std::min(count + 1, static_cast<int>(ring.size()));
+}
+
+bool RollbackBuffer::rollback(GameSimulation& simulation, int ticks) {
+    if (ticks <= 0 || ticks > count) {
+        return false;
+    }
+
+    scratch = current;
+    for (int age = 0; age < ticks; ++age) {
+        applyUndo(recordAt(age), scratch);
+    }
+    if (!simulation.restoreState(scratch)) {
+        return false;
+    }
+
+    current.swap(scratch);
+    int size = static_cast<int>(ring.size());
+    head = (head - ticks + size) % size;
+    count -= ticks;
+    return true;
+}
+
+int RollbackBuffer::correctInput(GameSimulation& simulation, unsigned int tick,
+                                 const InputFrame& input) {
+    int age = -1;
+    for (int i = 0; i < count; ++i) {
+        if (recordAt(i).tick == tick) {
+            age = i;
+            break;
+        }
+    }
+    if (age < 0) {
+        return 0;
+    }
+
+    const InputFrame& predicted = recordAt(age).input;
+    if (predicted.held == input.held && predicted.pressed == input.pressed) {
+        return 0;
+    }
+
+    replayInputs.clear();
+    replayInputs.push_back(input);
+    for (int i = age - 1; i >= 0; --i) {
+        replayInputs.push_back(recordAt(i).input);
+    }
+
+    if (!rollback(simulation, age + 1)) {
+        return 0;
+    }
+    for (const InputFrame& replayed : replayInputs) {
+        advance(simulation, replayed);
+        simulation.getEvents().clear();
+    }
+    return static_cast<int>(replayInputs.size());
+}
+
+bool RollbackBuffer::getInput(unsigned int tick, InputFrame& input) const {
+    for (int i = 0; i < count; ++i) {
+        if (recordAt(i).tick == tick) {
+            input = recordAt(i).input;
+            return true;
+        }
+    }
+    return false;
+}
+
+unsigned int RollbackBuffer::getOldestTick() const {
+    return count > 0 ? recordAt(count - 1).tick : 0;
+}
+
+std::size_t RollbackBuffer::getDeltaBytes() const {
+    std::size_t total = 0;
+    for (int i = 0; i < count; ++i) {
+        total += recordAt(i).undo.size();
+    }
+    return total;
+}
+
+RollbackBuffer::TickRecord& RollbackBuffer::recordAt(int age) {
+    int size = static_cast<int>(ring.size());
+    return ring[(head - 1 - age + size * 2) % size];
+}
+
+const RollbackBuffer::TickRecord& RollbackBuffer::recordAt(int age) const {
+    int size = static_cast<int>(ring.size());
+    return ring[(head - 1 - age + size * 2) % size];
+}
+
+void RollbackBuffer::encodeUndo(const std::vector<unsigned char>& before,
+                                const std::vector<unsigned char>& after,
+                                std::vector<unsigned char>& undo) {
+    undo.clear();
+    std::size_t common = std::min(before.size(), after.size());
+
+    std::size_t i = 0;
+    while (i < common) {
+        if (before[i] == after[i]) {
+            ++i;
+            continue;
+        }
+
+        std::size_t start = i;
+        std::size_t end = i + 1;
+        std::size_t scan = end;
+        while (scan < common && scan - end <= MERGE_GAP) {
+            if (before[scan] != after[scan]) {
+                end = scan + 1;
+            }
+            ++scan;
+        }
+        appendRun(undo, before.data(), static_cast<std::uint32_t>(start), end - start);
+        i = end;
+    }
+
+    // Bytes the tick removed (an entity list shrank) are kept verbatim
+    if (before.size() > common) {
+        appendRun(undo, before.data(), static_cast<std::uint32_t>(common),
+                  before.size() - common);
+    }
+}
+
+void RollbackBuffer::applyUndo(const TickRecord& record, std::vector<unsigned char>& state) {
+    state.resize(record.previousSize);
+
+    std::size_t at = 0;
+    while (at < record.undo.size()) {
+        std::uint32_t offset = 0;
+        std::uint16_t length = 0;
+        std::memcpy(&offset, &record.undo[at], sizeof(offset));
+        std::memcpy(&length, &record.undo[at + sizeof(offset)], sizeof(length));
+        at += sizeof(offset) + sizeof(length);
+        std::memcpy(&state[offset], &record.undo[at], length);
+        at += length;
+    }
+}
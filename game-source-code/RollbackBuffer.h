@@ -0,0 +1,135 @@
+#ifndef ROLLBACKBUFFER_H
+#define ROLLBACKBUFFER_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "InputManager.h"
+
+class GameSimulation;
+
+/**
+ * @file RollbackBuffer.h
+ * @brief Per-tick state history for rolling back and resimulating
+ */
+
+/**
+ * @class RollbackBuffer
+ * @brief Ring of the last N ticks stored as byte-level undo deltas
+ *
+ * Instead of a full snapshot per tick, each entry keeps only the bytes
+ * of the serialized state that the tick changed (terrain cells cleared,
+ * entity fields moved) plus the input that drove it:
+ * 1. advance() steps the simulation and saves the new state
+ * 2. The new state is diffed against the previous one; the old bytes of
+ *    each changed run become the tick's undo delta
+ * 3. rollback(k) applies the newest k undo deltas in reverse and
+ *    restores the result into the simulation
+ *
+ * correctInput() builds on this for latency hiding: replace a past
+ * tick's predicted input, roll back to it and replay the stored inputs
+ * up to the present.
+ *
+ * Costs:
+ * - A typical tick changes a few dozen bytes of a ~2 KB state
+ * - Ring slots and scratch buffers are reused, so steady state does
+ *   not allocate
+ *
+ * @note Relies on the deterministic fixed-step tick (GameClock and
+ *       GameRandom are captured by GameSimulation::saveState)
+ */
+class RollbackBuffer {
+public:
+    /**
+     * @brief Construct history ring
+     * @param capacity Maximum ticks that can be rolled back
+     */
+    explicit RollbackBuffer(int capacity);
+
+    /**
+     * @brief Forget history and take the simulation's current state as base
+     * @param simulation Simulation to track
+     */
+    void reset(const GameSimulation& simulation);
+
+    /**
+     * @brief Step the simulation one tick and record its delta
+     * @param simulation Simulation passed to reset()
+     * @param input Input for this tick
+     */
+    void advance(GameSimulation& simulation, const InputFrame& input);
+
+    /**
+     * @brief Rewind the simulation by a number of recorded ticks
+     * @param simulation Simulation passed to reset()
+     * @param ticks Ticks to undo (at most getDepth())
+     * @return true if the state was restored
+     * @note Undone ticks are dropped from the history
+     */
+    bool rollback(GameSimulation& simulation, int ticks);
+
+    /**
+     * @brief Replace the input of a past tick and resimulate to the present
+     * @param simulation Simulation passed to reset()
+     * @param tick Simulation tick whose input was wrong
+     * @param input Confirmed input for that tick
+     * @return Number of ticks resimulated (0 if input already matched
+     *         or the tick is outside the window)
+     * @note Events raised while replaying are discarded - the caller
+     *       already presented them the first time round
+     */
+    int correctInput(GameSimulation& simulation, unsigned int tick,
+                     const InputFrame& input);
+
+    /**
+     * @brief Get input recorded for a tick still in the window
+     * @param tick Simulation tick
+     * @param input Receives the input
+     * @return false if tick is not in the history
+     */
+    bool getInput(unsigned int tick, InputFrame& input) const;
+
+    /**
+     * @brief Get ticks currently available for rollback
+     */
+    int getDepth() const { return count; }
+
+    /**
+     * @brief Get first tick that can be rolled back to
+     */
+    unsigned int getOldestTick() const;
+
+    /**
+     * @brief Get bytes held by all undo deltas (diagnostics)
+     */
+    std::size_t getDeltaBytes() const;
+
+    /**
+     * @brief Get size of the current full state
+     */
+    std::size_t getStateBytes() const { return current.size(); }
+
+private:
+    struct TickRecord {
+        unsigned int tick = 0;             ///< Tick the input was applied on
+        InputFrame input;
+        std::uint32_t previousSize = 0;    ///< State size before the tick
+        std::vector<unsigned char> undo;   ///< Runs of [offset][length][old bytes]
+    };
+
+    std::vector<TickRecord> ring;
+    int head;   ///< Slot of the next record
+    int count;
+    std::vector<unsigned char> current;
+    std::vector<unsigned char> scratch;
+    std::vector<InputFrame> replayInputs;
+
+    TickRecord& recordAt(int age);
+    const TickRecord& recordAt(int age) const;
+    static void encodeUndo(const std::vector<unsigned char>& before,
+                           const std::vector<unsigned char>& after,
+                           std::vector<unsigned char>& undo);
+    static void applyUndo(const TickRecord& record, std::vector<unsigned char>& state);
+};
+
+#endif // ROLLBACKBUFFER_H
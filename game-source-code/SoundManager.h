@@ -22,7 +22,8 @@ enum class SoundEffect {
     PLAYER_HIT,      ///< Player takes damage
     POWERUP_COLLECT, ///< Power-up collected
     ROCK_LAND,       ///< Rock hits ground
-    LEVEL_COMPLETE   ///< Level finished
+    LEVEL_COMPLETE,  ///< Level finished
+    COUNT
 };
 
 /**
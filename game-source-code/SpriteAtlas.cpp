@@ -0,0 +1,238 @@
+#include "SpriteAtlas.h"
+
+namespace {
+    const int SPRITE_COUNT = static_cast<int>(SpriteId::COUNT);
+    const int ATLAS_ROWS = (SPRITE_COUNT + SpriteAtlas::CELLS_PER_ROW - 1) /
+                           SpriteAtlas::CELLS_PER_ROW;
+}
+
+SpriteAtlas::SpriteAtlas() : texture{}, ready(false) {
+}
+
+SpriteAtlas::~SpriteAtlas() {
+    unload();
+}
+
+bool SpriteAtlas::build(const std::string& spriteDirectory) {
+    unload();
+    if (!IsWindowReady()) {
+        return false;
+    }
+
+    Image canvas = GenImageColor(CELLS_PER_ROW * SPRITE_CELL,
+                                 ATLAS_ROWS * SPRITE_CELL, BLANK);
+
+    for (int i = 0; i < SPRITE_COUNT; ++i) {
+        SpriteId id = static_cast<SpriteId>(i);
+        Rectangle cell = getSourceRect(id);
+        std::string file = spriteDirectory + "/" + getSpriteName(id) + ".png";
+
+        if (FileExists(file.c_str())) {
+            Image sprite = LoadImage(file.c_str());
+            Rectangle spriteRect = {0.0f, 0.0f, static_cast<float>(sprite.width),
+                                    static_cast<float>(sprite.height)};
+            ImageDraw(&canvas, sprite, spriteRect, getOverrideRect(id), WHITE);
+            UnloadImage(sprite);
+        } else {
+            bakeSprite(canvas, id, static_cast<int>(cell.x) + SPRITE_CELL / 2,
+                      static_cast<int>(cell.y) + SPRITE_CELL / 2);
+        }
+    }
+
+    texture = LoadTextureFromImage(canvas);
+    UnloadImage(canvas);
+    SetTextureFilter(texture, TEXTURE_FILTER_BILINEAR);
+    ready = texture.id != 0;
+    return ready;
+}
+
+void SpriteAtlas::unload() {
+    if (ready) {
+        UnloadTexture(texture);
+        ready = false;
+    }
+}
+
+Rectangle SpriteAtlas::getSourceRect(SpriteId id) {
+    int index = static_cast<int>(id);
+    return Rectangle{
+        static_cast<float>((index % CELLS_PER_ROW) * SPRITE_CELL),
+        static_cast<float>((index / CELLS_PER_ROW) * SPRITE_CELL),
+        static_cast<float>(SPRITE_CELL),
+        static_cast<float>(SPRITE_CELL)
+    };
+}
+
+Rectangle SpriteAtlas::getSpriteRect(SpriteId id) {
+    Rectangle cell = getSourceRect(id);
+    if (id == SpriteId::PIXEL) {
+        return cell;
+    }
+    // Baked circles of radius r cover the pixels center-r .. center+r
+    float radius = getBaseRadius(id);
+    return Rectangle{
+        cell.x + SPRITE_CELL / 2 - radius,
+        cell.y + SPRITE_CELL / 2 - radius,
+        radius * 2.0f + 1.0f,
+        radius * 2.0f + 1.0f
+    };
+}
+
+Rectangle SpriteAtlas::getOverrideRect(SpriteId id) {
+    // Exactly the region SpriteBatch samples, so nothing of the PNG is cropped
+    return getSpriteRect(id);
+}
+
+float SpriteAtlas::getBaseRadius(SpriteId id) {
+    switch (id) {
+        case SpriteId::PLAYER:           return 16.0f;
+        case SpriteId::ENEMY_RED:
+        case SpriteId::ENEMY_AGGRESSIVE:
+        case SpriteId::ENEMY_DRAGON:     return 15.0f;
+        case SpriteId::ROCK:
+        case SpriteId::ROCK_FALLING:     return 18.0f;
+        case SpriteId::DISC:             return 16.0f;
+        case SpriteId::RING:             return 30.0f;
+        case SpriteId::RING_SMALL:       return 9.0f;
+        case SpriteId::PIXEL:            return SPRITE_CELL / 2.0f;
+        default:                         return 24.0f; // power-ups (outer glow)
+    }
+}
+
+const char* SpriteAtlas::getSpriteName(SpriteId id) {
+    switch (id) {
+        case SpriteId::PLAYER:                   return "player";
+        case SpriteId::ENEMY_RED:                return "enemy_red";
+        case SpriteId::ENEMY_AGGRESSIVE:         return "enemy_aggressive";
+        case SpriteId::ENEMY_DRAGON:             return "enemy_dragon";
+        case SpriteId::ROCK:                     return "rock";
+        case SpriteId::ROCK_FALLING:             return "rock_falling";
+        case SpriteId::POWERUP_EXTRA_LIFE:       return "powerup_extra_life";
+        case SpriteId::POWERUP_SCORE_MULTIPLIER: return "powerup_score";
+        case SpriteId::POWERUP_SPEED_BOOST:      return "powerup_speed";
+        case SpriteId::POWERUP_INVINCIBILITY:    return "powerup_invincibility";
+        case SpriteId::POWERUP_RAPID_FIRE:       return "powerup_rapid_fire";
+        case SpriteId::POWERUP_POWER_SHOT:       return "powerup_power_shot";
+        case SpriteId::DISC:                     return "disc";
+        case SpriteId::RING:                     return "ring";
+        case SpriteId::RING_SMALL:               return "ring_small";
+        case SpriteId::PIXEL:                    return "pixel";
+        case SpriteId::COUNT:                    break;
+    }
+    return "unknown";
+}
+
+SpriteId SpriteAtlas::getEnemySprite(EnemyType type) {
+    switch (type) {
+        case EnemyType::GREEN_DRAGON:       return SpriteId::ENEMY_DRAGON;
+        case EnemyType::AGGRESSIVE_MONSTER: return SpriteId::ENEMY_AGGRESSIVE;
+        default:                            return SpriteId::ENEMY_RED;
+    }
+}
+
+SpriteId SpriteAtlas::getRingSprite(float radius) {
+    return radius < SMALL_RING_LIMIT ? SpriteId::RING_SMALL : SpriteId::RING;
+}
+
+SpriteId SpriteAtlas::getPowerUpSprite(PowerUpType type) {
+    switch (type) {
+        case PowerUpType::EXTRA_LIFE:       return SpriteId::POWERUP_EXTRA_LIFE;
+        case PowerUpType::SCORE_MULTIPLIER: return SpriteId::POWERUP_SCORE_MULTIPLIER;
+        case PowerUpType::SPEED_BOOST:      return SpriteId::POWERUP_SPEED_BOOST;
+        case PowerUpType::INVINCIBILITY:    return SpriteId::POWERUP_INVINCIBILITY;
+        case PowerUpType::RAPID_FIRE:       return SpriteId::POWERUP_RAPID_FIRE;
+        case PowerUpType::POWER_SHOT:       return SpriteId::POWERUP_POWER_SHOT;
+    }
+    return SpriteId::POWERUP_EXTRA_LIFE;
+}
+
+void SpriteAtlas::bakeSprite(Image& canvas, SpriteId id, int x, int y) {
+    switch (id) {
+        case SpriteId::PLAYER:
+            ImageDrawCircle(&canvas, x, y, 16, YELLOW);
+            ImageDrawCircleLines(&canvas, x, y, 16, ORANGE);
+            ImageDrawCircle(&canvas, x - 6, y - 6, 3, BLACK);
+            ImageDrawCircle(&canvas, x + 6, y - 6, 3, BLACK);
+            break;
+        case SpriteId::ENEMY_RED:
+            bakeEnemy(canvas, x, y, RED, false);
+            break;
+        case SpriteId::ENEMY_AGGRESSIVE:
+            bakeEnemy(canvas, x, y, Color{139, 0, 0, 255}, false);
+            break;
+        case SpriteId::ENEMY_DRAGON:
+            bakeEnemy(canvas, x, y, GREEN, true);
+            break;
+        case SpriteId::ROCK:
+            bakeRock(canvas, x, y, PURPLE);
+            break;
+        case SpriteId::ROCK_FALLING:
+            bakeRock(canvas, x, y, RED);
+            break;
+        case SpriteId::POWERUP_EXTRA_LIFE:
+            bakePowerUp(canvas, x, y, Color{0, 255, 100, 255}, "+");
+            break;
+        case SpriteId::POWERUP_SCORE_MULTIPLIER:
+            bakePowerUp(canvas, x, y, GOLD, "$");
+            break;
+        case SpriteId::POWERUP_SPEED_BOOST:
+            bakePowerUp(canvas, x, y, Color{255, 255, 0, 255}, "S");
+            break;
+        case SpriteId::POWERUP_INVINCIBILITY:
+            bakePowerUp(canvas, x, y, WHITE, "?");
+            break;
+        case SpriteId::POWERUP_RAPID_FIRE:
+            bakePowerUp(canvas, x, y, Color{0, 255, 255, 255}, "R");
+            break;
+        case SpriteId::POWERUP_POWER_SHOT:
+            bakePowerUp(canvas, x, y, ORANGE, "P");
+            break;
+        case SpriteId::DISC:
+            ImageDrawCircle(&canvas, x, y, 16, WHITE);
+            break;
+        case SpriteId::RING:
+            // Two pixels thick so the outline survives scaling down to ~20
+            ImageDrawCircleLines(&canvas, x, y, 30, WHITE);
+            ImageDrawCircleLines(&canvas, x, y, 29, WHITE);
+            break;
+        case SpriteId::RING_SMALL:
+            ImageDrawCircleLines(&canvas, x, y, 9, WHITE);
+            break;
+        case SpriteId::PIXEL:
+            ImageDrawRectangle(&canvas, x - SPRITE_CELL / 2, y - SPRITE_CELL / 2,
+                              SPRITE_CELL, SPRITE_CELL, WHITE);
+            break;
+        case SpriteId::COUNT:
+            break;
+    }
+}
+
+void SpriteAtlas::bakeEnemy(Image& canvas, int x, int y, Color body, bool isDragon) {
+    ImageDrawCircle(&canvas, x, y, 15, body);
+    ImageDrawCircleLines(&canvas, x, y, 15, MAROON);
+    ImageDrawCircle(&canvas, x - 5, y - 5, 2, BLACK);
+    ImageDrawCircle(&canvas, x + 5, y - 5, 2, BLACK);
+
+    if (isDragon) {
+        ImageDrawCircle(&canvas, x, y + 8, 3, ORANGE);
+    }
+}
+
+void SpriteAtlas::bakeRock(Image& canvas, int x, int y, Color body) {
+    ImageDrawCircle(&canvas, x, y, 18, body);
+    ImageDrawCircleLines(&canvas, x, y, 18, WHITE);
+    ImageDrawText(&canvas, "ROCK", x - 15, y - 6, 12, WHITE);
+}
+
+void SpriteAtlas::bakePowerUp(Image& canvas, int x, int y, Color body, const char* symbol) {
+    const int symbolSize = 20;
+
+    ImageDrawCircle(&canvas, x, y, 24, ColorAlpha(body, 0.4f));
+    ImageDrawCircle(&canvas, x, y, 21, ColorAlpha(WHITE, 0.3f));
+    ImageDrawCircle(&canvas, x, y, 18, body);
+    ImageDrawCircleLines(&canvas, x, y, 19, WHITE);
+
+    int symbolWidth = MeasureText(symbol, symbolSize);
+    ImageDrawText(&canvas, symbol, x - symbolWidth / 2, y - symbolSize / 2,
+                 symbolSize, BLACK);
+}
@@ -0,0 +1,145 @@
+#ifndef SPRITEATLAS_H
+#define SPRITEATLAS_H
+
+#include <raylib-cpp.hpp>
+#include "PowerUp.h"
+#include "Enemy.h"
+#include <string>
+
+/**
+ * @file SpriteAtlas.h
+ * @brief Single texture atlas holding every entity sprite
+ */
+
+/**
+ * @enum SpriteId
+ * @brief Atlas cells, one per baked entity look
+ */
+enum class SpriteId {
+    PLAYER,
+    ENEMY_RED,
+    ENEMY_AGGRESSIVE,
+    ENEMY_DRAGON,
+    ROCK,
+    ROCK_FALLING,
+    POWERUP_EXTRA_LIFE,
+    POWERUP_SCORE_MULTIPLIER,
+    POWERUP_SPEED_BOOST,
+    POWERUP_INVINCIBILITY,
+    POWERUP_RAPID_FIRE,
+    POWERUP_POWER_SHOT,
+    DISC,  ///< White filled circle, tinted at draw time
+    RING,  ///< White circle outline, tinted at draw time
+    RING_SMALL, ///< RING baked at a small radius for thin outlines
+    PIXEL, ///< White square for lines and bars
+    COUNT
+};
+
+/**
+ * @class SpriteAtlas
+ * @brief Builds and owns the entity sprite texture
+ *
+ * All entity graphics live in one texture so that the renderer can
+ * submit every entity quad without switching textures. The atlas is
+ * built once at startup:
+ * - If resources/sprites/<name>.png exists it is scaled into the
+ *   sprite's drawn square (getOverrideRect), not the whole cell
+ * - Otherwise the cell is baked procedurally from the classic shapes
+ *
+ * Atlas layout:
+ * - Cells: 64×64 pixels, 8 per row
+ * - Sprite centered in its cell
+ * - Base radius per sprite: the bake fits in the square of that radius
+ *   around the cell center, which is the region SpriteBatch draws
+ *
+ * @note Requires an open window (GPU texture); isReady() is false otherwise
+ */
+class SpriteAtlas {
+public:
+    static const int SPRITE_CELL = 64;   ///< Cell edge length in pixels
+    static const int CELLS_PER_ROW = 8;  ///< Atlas columns
+
+private:
+    Texture2D texture;
+    bool ready;
+
+public:
+    SpriteAtlas();
+    ~SpriteAtlas();
+
+    SpriteAtlas(const SpriteAtlas&) = delete;
+    SpriteAtlas& operator=(const SpriteAtlas&) = delete;
+
+    /**
+     * @brief Bake all sprites and upload atlas texture
+     * @param spriteDirectory Directory searched for PNG overrides
+     * @return true if texture created
+     */
+    bool build(const std::string& spriteDirectory = "resources/sprites");
+
+    /**
+     * @brief Release GPU texture
+     */
+    void unload();
+
+    bool isReady() const { return ready; }
+    const Texture2D& getTexture() const { return texture; }
+
+    /**
+     * @brief Get atlas source rectangle of a sprite
+     * @param id Sprite identifier
+     * @return Rectangle Pixel rectangle inside atlas texture
+     */
+    static Rectangle getSourceRect(SpriteId id);
+
+    /**
+     * @brief Get atlas region holding just the sprite (no cell margin)
+     * @param id Sprite identifier
+     * @return Rectangle Square of the base radius around the cell center,
+     *         widened to cover the pixels on the radius itself
+     */
+    static Rectangle getSpriteRect(SpriteId id);
+
+    /**
+     * @brief Get atlas region a PNG override is scaled into
+     * @param id Sprite identifier
+     * @return Rectangle Same as getSpriteRect(), the region drawn
+     */
+    static Rectangle getOverrideRect(SpriteId id);
+
+    /**
+     * @brief Get radius (pixels) the sprite was baked at
+     * @param id Sprite identifier
+     * @return float Radius of the sprite's footprint in its cell
+     */
+    static float getBaseRadius(SpriteId id);
+
+    /**
+     * @brief Get PNG override name (without extension)
+     * @param id Sprite identifier
+     * @return const char* File stem, e.g. "player"
+     */
+    static const char* getSpriteName(SpriteId id);
+
+    static SpriteId getEnemySprite(EnemyType type);
+    static SpriteId getPowerUpSprite(PowerUpType type);
+
+    /**
+     * @brief Pick the ring bake closest in size to a drawn radius
+     * @param radius Radius the ring is drawn at
+     * @return SpriteId RING_SMALL below SMALL_RING_LIMIT, else RING
+     * @note Scaling the large ring down to a few pixels thins its
+     *       outline below a pixel and it breaks up under filtering
+     */
+    static SpriteId getRingSprite(float radius);
+
+    static constexpr float SMALL_RING_LIMIT = 16.0f;
+
+private:
+    static void bakeSprite(Image& canvas, SpriteId id, int centerX, int centerY);
+    static void bakeEnemy(Image& canvas, int x, int y, Color body, bool isDragon);
+    static void bakeRock(Image& canvas, int x, int y, Color body);
+    static void bakePowerUp(Image& canvas, int x, int y, Color body, const char* symbol);
+};
+
+#endif // SPRITEATLAS_H
@@ -0,0 +1,122 @@
+#ifndef SPRITEBATCH_H
+#define SPRITEBATCH_H
+
+#include <raylib-cpp.hpp>
+#include <vector>
+#include "SpriteAtlas.h"
+
+/**
+ * @file SpriteBatch.h
+ * @brief Deferred quad submission for atlas sprites
+ */
+
+/**
+ * @struct SpriteQuad
+ * @brief One textured quad queued for drawing
+ */
+struct SpriteQuad {
+    Rectangle source; ///< Atlas region
+    Rectangle dest;   ///< Screen rectangle
+    Color tint;       ///< Color multiplier (alpha for fades)
+};
+
+/**
+ * @class SpriteBatch
+ * @brief Collects entity quads and submits them in one pass
+ *
+ * Entity draw calls no longer touch raylib immediately. They append
+ * quads to a preallocated buffer and flush() submits them back-to-back
+ * from the single atlas texture, so raylib's internal batcher merges
+ * them into a handful of GPU draw calls regardless of entity count.
+ *
+ * Usage pattern:
+ * 1. add()/addCircle()/addRect() while walking entities
+ * 2. flush(atlas) once after all entity layers
+ *
+ * Submission order equals insertion order, so layering is preserved.
+ *
+ * @note Buffer grows only if more than INITIAL_CAPACITY quads are queued
+ */
+class SpriteBatch {
+public:
+    static const int INITIAL_CAPACITY = 1024; ///< Preallocated quads
+
+private:
+    std::vector<SpriteQuad> quads;
+    int lastFlushCount;
+
+public:
+    SpriteBatch() : lastFlushCount(0) {
+        quads.reserve(INITIAL_CAPACITY);
+    }
+
+    /**
+     * @brief Queue sprite centered at position
+     * @param id Sprite to draw
+     * @param center Screen position of sprite center
+     * @param radius Desired radius in pixels (scaled from base radius)
+     * @param tint Color multiplier
+     */
+    void add(SpriteId id, Vector2 center, float radius, Color tint = WHITE) {
+        // Only the sprite's own square is drawn, not the empty cell margin
+        quads.push_back(SpriteQuad{
+            SpriteAtlas::getSpriteRect(id),
+            Rectangle{center.x - radius, center.y - radius,
+                      radius * 2.0f, radius * 2.0f},
+            tint
+        });
+    }
+
+    /**
+     * @brief Queue solid filled circle
+     */
+    void addCircle(Vector2 center, float radius, Color color) {
+        add(SpriteId::DISC, center, radius, color);
+    }
+
+    /**
+     * @brief Queue circle outline (small radii use the small ring bake)
+     */
+    void addRing(Vector2 center, float radius, Color color) {
+        add(SpriteAtlas::getRingSprite(radius), center, radius, color);
+    }
+
+    /**
+     * @brief Queue solid axis-aligned rectangle
+     * @param dest Screen rectangle
+     * @param color Fill color
+     */
+    void addRect(Rectangle dest, Color color) {
+        Rectangle pixel = SpriteAtlas::getSourceRect(SpriteId::PIXEL);
+        pixel.x += pixel.width * 0.25f;
+        pixel.y += pixel.height * 0.25f;
+        pixel.width *= 0.5f;
+        pixel.height *= 0.5f;
+        quads.push_back(SpriteQuad{pixel, dest, color});
+    }
+
+    /**
+     * @brief Submit all queued quads and clear buffer
+     * @param atlas Atlas texture to sample
+     * @note Quads are discarded without drawing if atlas is not ready
+     */
+    void flush(const SpriteAtlas& atlas) {
+        lastFlushCount = static_cast<int>(quads.size());
+
+        if (atlas.isReady()) {
+            const Texture2D& texture = atlas.getTexture();
+            for (const SpriteQuad& quad : quads) {
+                DrawTexturePro(texture, quad.source, quad.dest,
+                              Vector2{0.0f, 0.0f}, 0.0f, quad.tint);
+            }
+        }
+
+        quads.clear();
+    }
+
+    int getPendingCount() const { return static_cast<int>(quads.size()); }
+    const SpriteQuad& getPendingQuad(int index) const { return quads[index]; }
+    int getLastFlushCount() const { return lastFlushCount; }
+};
+
+#endif // SPRITEBATCH_H
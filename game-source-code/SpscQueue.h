@@ -0,0 +1,73 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <array>
+#include <cstddef>
+
+/**
+ * @file SpscQueue.h
+ * @brief Bounded lock-free single-producer/single-consumer queue
+ */
+
+/**
+ * @class SpscQueue
+ * @brief Fixed-capacity ring buffer shared by exactly two threads
+ *
+ * Used to carry small value types (gameplay events, timestamped input)
+ * between the simulation and window threads. Never allocates; push()
+ * fails instead of blocking when the ring is full.
+ *
+ * @tparam T Trivially copyable element type
+ * @tparam CAPACITY Ring size (one slot is kept free)
+ */
+template <typename T, std::size_t CAPACITY>
+class SpscQueue {
+private:
+    std::array<T, CAPACITY> ring;
+    alignas(64) std::atomic<std::size_t> head{0}; ///< Next slot to read
+    alignas(64) std::atomic<std::size_t> tail{0}; ///< Next slot to write
+
+public:
+    SpscQueue() = default;
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Append value (producer thread only)
+     * @param value Element to copy in
+     * @return false if queue is full
+     */
+    bool push(const T& value) {
+        std::size_t currentTail = tail.load(std::memory_order_relaxed);
+        std::size_t nextTail = (currentTail + 1) % CAPACITY;
+        if (nextTail == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        ring[currentTail] = value;
+        tail.store(nextTail, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove oldest value (consumer thread only)
+     * @param out Receives element
+     * @return false if queue is empty
+     */
+    bool pop(T& out) {
+        std::size_t currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        out = ring[currentHead];
+        head.store((currentHead + 1) % CAPACITY, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return head.load(std::memory_order_acquire) ==
+               tail.load(std::memory_order_acquire);
+    }
+};
+
+#endif // SPSCQUEUE_H
@@ -0,0 +1,241 @@
+#ifndef STATESERIALIZER_H
+#define STATESERIALIZER_H
+
+#include "Coordinate.h"
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @file StateSerializer.h
+ * @brief Compact binary writer/reader for game state snapshots
+ */
+
+/**
+ * @namespace StateFormat
+ * @brief Header constants of the binary state format
+ *
+ * Layout: [magic u32][version u32][payload...]
+ * Values are raw little-endian memory images of fixed-size fields;
+ * containers are a u32 count followed by their elements.
+ *
+ * @note Bump VERSION whenever any serialize() layout changes
+ */
+namespace StateFormat {
+    const std::uint32_t MAGIC = 0x56534444; ///< "DDSV"
+    const std::uint32_t VERSION = 6; ///< 6: player direction buffer
+}
+
+/**
+ * @class StateWriter
+ * @brief Appends fixed-size values to a reusable byte buffer
+ *
+ * The buffer is owned by the caller so repeated checkpoints reuse its
+ * capacity and never allocate after the first save.
+ */
+class StateWriter {
+private:
+    std::vector<unsigned char>& buffer;
+
+public:
+    explicit StateWriter(std::vector<unsigned char>& out) : buffer(out) {}
+
+    /**
+     * @brief Append raw memory image of a trivially copyable value
+     */
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, 
+                      "StateWriter::write needs trivially copyable type");
+        writeBytes(&value, sizeof(T));
+    }
+
+    void writeBytes(const void* bytes, std::size_t length) {
+        const unsigned char* source = static_cast<const unsigned char*>(bytes);
+        buffer.insert(buffer.end(), source, source + length);
+    }
+
+    void writeString(const std::string& text) {
+        write(static_cast<std::uint32_t>(text.size()));
+        writeBytes(text.data(), text.size());
+    }
+
+    /**
+     * @brief Write magic and version
+     */
+    void writeHeader() {
+        write(StateFormat::MAGIC);
+        write(StateFormat::VERSION);
+    }
+
+    std::size_t size() const { return buffer.size(); }
+};
+
+/**
+ * @class StateReader
+ * @brief Reads values written by StateWriter with bounds checking
+ *
+ * Reading past the end never touches invalid memory: the value is
+ * zero-filled and the reader is marked invalid. Callers read the whole
+ * snapshot and check isValid() once at the end.
+ *
+ * Values that would be unsafe to use are checked on the way in, so a
+ * snapshot of the right length but with corrupt contents is rejected too:
+ * - bool: the byte must be 0 or 1 (read(bool&) always checks)
+ * - enums: readEnum() with the last enumerator
+ * - grid positions: readPosition()/readPositions()
+ */
+class StateReader {
+private:
+    const unsigned char* data;
+    std::size_t length;
+    std::size_t offset;
+    bool valid;
+
+public:
+    StateReader(const unsigned char* bytes, std::size_t size)
+        : data(bytes), length(size), offset(0), valid(true) {}
+
+    explicit StateReader(const std::vector<unsigned char>& bytes)
+        : StateReader(bytes.data(), bytes.size()) {}
+
+    template <typename T>
+    void read(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, 
+                      "StateReader::read needs trivially copyable type");
+        readBytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+    T read() {
+        T value{};
+        read(value);
+        return value;
+    }
+
+    /**
+     * @brief Read a bool; any byte other than 0 or 1 fails the reader
+     */
+    void read(bool& value) {
+        unsigned char byte = 0;
+        readBytes(&byte, sizeof(byte));
+        if (byte > 1) {
+            fail();
+        }
+        value = byte == 1;
+    }
+
+    /**
+     * @brief Read an enum whose values run from 0 to last
+     * @param value Destination (first enumerator if out of range)
+     * @param last Last valid enumerator
+     */
+    template <typename E>
+    void readEnum(E& value, E last) {
+        static_assert(std::is_enum<E>::value, "StateReader::readEnum needs an enum");
+        using Raw = typename std::underlying_type<E>::type;
+        long long raw = static_cast<long long>(read<Raw>());
+        if (raw < 0 || raw > static_cast<long long>(last)) {
+            fail();
+            raw = 0;
+        }
+        value = static_cast<E>(raw);
+    }
+
+    /**
+     * @brief Read a grid position
+     *
+     * Playable cells pass isWithinBounds(). The game also stores a few
+     * positions just off the playfield - default (0,0) positions in the
+     * HUD rows, and harpoons or fire that stepped past an edge on their
+     * last tick - so anything within one cell of the world grid is
+     * accepted; everything further out fails the reader.
+     */
+    void readPosition(Coordinate& value) {
+        read(value);
+        if (!isPlausiblePosition(value)) {
+            fail();
+            value = Coordinate();
+        }
+    }
+
+    /**
+     * @brief Read an array of positions written with writeBytes()
+     */
+    void readPositions(Coordinate* values, std::size_t count) {
+        readBytes(values, count * sizeof(Coordinate));
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!isPlausiblePosition(values[i])) {
+                fail();
+                values[i] = Coordinate();
+            }
+        }
+    }
+
+    void readBytes(void* out, std::size_t count) {
+        if (!valid || count > length - offset) {
+            valid = false;
+            std::memset(out, 0, count);
+            return;
+        }
+        std::memcpy(out, data + offset, count);
+        offset += count;
+    }
+
+    std::string readString() {
+        std::uint32_t count = read<std::uint32_t>();
+        if (!valid || count > length - offset) {
+            valid = false;
+            return std::string();
+        }
+        std::string text(reinterpret_cast<const char*>(data + offset), count);
+        offset += count;
+        return text;
+    }
+
+    /**
+     * @brief Read and check magic and version
+     * @return true if header matches this build's format
+     */
+    bool readHeader() {
+        bool matches = read<std::uint32_t>() == StateFormat::MAGIC &&
+                       read<std::uint32_t>() == StateFormat::VERSION;
+        if (!matches) {
+            valid = false;
+        }
+        return matches;
+    }
+
+    /**
+     * @brief Read container element count with sanity limit
+     * @param maxCount Largest count accepted
+     * @return std::uint32_t Count (0 and invalid if over limit)
+     */
+    std::uint32_t readCount(std::uint32_t maxCount) {
+        std::uint32_t count = read<std::uint32_t>();
+        if (count > maxCount) {
+            valid = false;
+            return 0;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Mark the snapshot bad (for checks made by the caller)
+     */
+    void fail() { valid = false; }
+
+    bool isValid() const { return valid; }
+    std::size_t remaining() const { return length - offset; }
+
+private:
+    static bool isPlausiblePosition(Coordinate value) {
+        return value.isWithinBounds() ||
+               (value.row >= -1 && value.row <= Coordinate::WORLD_ROWS &&
+                value.col >= -1 && value.col <= Coordinate::WORLD_COLS);
+    }
+};
+
+#endif // STATESERIALIZER_H
@@ -0,0 +1,96 @@
+#include "TextCache.h"
+#include "MemoryTracker.h"
+#include <cstring>
+
+TextKey::TextKey(const char* str, int size) : fontSize(size) {
+    std::strncpy(text, str, MAX_LENGTH);
+    text[MAX_LENGTH] = '\0';
+}
+
+bool TextKey::operator==(const TextKey& other) const {
+    return fontSize == other.fontSize && std::strcmp(text, other.text) == 0;
+}
+
+std::size_t TextKeyHash::operator()(const TextKey& key) const {
+    std::size_t hash = 2166136261u;
+    for (const char* c = key.text; *c; ++c) {
+        hash = (hash ^ static_cast<unsigned char>(*c)) * 16777619u;
+    }
+    return (hash ^ static_cast<std::size_t>(key.fontSize)) * 16777619u;
+}
+
+TextCache::TextCache() : frame(0), rasterizeCount(0) {
+    MemoryScope memory(MemoryTag::UI_TEXT);
+    entries.reserve(MAX_ENTRIES);
+}
+
+TextCache::~TextCache() {
+    clear();
+}
+
+void TextCache::draw(const char* text, int x, int y, int fontSize, Color color) {
+    Entry& entry = lookup(text, fontSize);
+    if (entry.texture.id != 0) {
+        DrawTexture(entry.texture, x, y, color);
+    }
+}
+
+int TextCache::measure(const char* text, int fontSize) {
+    return lookup(text, fontSize).width;
+}
+
+void TextCache::clear() {
+    for (auto& pair : entries) {
+        release(pair.second);
+    }
+    entries.clear();
+}
+
+TextCache::Entry& TextCache::lookup(const char* text, int fontSize) {
+    TextKey key(text, fontSize);
+    auto found = entries.find(key);
+    if (found != entries.end()) {
+        found->second.lastUsedFrame = frame;
+        return found->second;
+    }
+
+    if (static_cast<int>(entries.size()) >= MAX_ENTRIES) {
+        evictOldest();
+    }
+
+    Entry entry{};
+    entry.lastUsedFrame = frame;
+    rasterizeCount++;
+
+    if (IsWindowReady()) {
+        Image image = ImageText(key.text, fontSize, WHITE);
+        entry.texture = LoadTextureFromImage(image);
+        entry.width = image.width;
+        UnloadImage(image);
+    } else {
+        entry.width = MeasureText(key.text, fontSize);
+    }
+
+    MemoryScope memory(MemoryTag::UI_TEXT);
+    return entries.emplace(key, entry).first->second;
+}
+
+void TextCache::evictOldest() {
+    auto oldest = entries.begin();
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if (it->second.lastUsedFrame < oldest->second.lastUsedFrame) {
+            oldest = it;
+        }
+    }
+    if (oldest != entries.end()) {
+        release(oldest->second);
+        entries.erase(oldest);
+    }
+}
+
+void TextCache::release(Entry& entry) {
+    if (entry.texture.id != 0) {
+        UnloadTexture(entry.texture);
+        entry.texture.id = 0;
+    }
+}
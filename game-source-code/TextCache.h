@@ -0,0 +1,124 @@
+#ifndef TEXTCACHE_H
+#define TEXTCACHE_H
+
+#include <raylib-cpp.hpp>
+#include <unordered_map>
+#include <cstddef>
+
+/**
+ * @file TextCache.h
+ * @brief Pre-rasterized text textures keyed by (string, size)
+ */
+
+/**
+ * @struct TextKey
+ * @brief Fixed-size cache key - no heap allocation per lookup
+ */
+struct TextKey {
+    static const int MAX_LENGTH = 63; ///< Longer strings are truncated
+
+    char text[MAX_LENGTH + 1];
+    int fontSize;
+
+    TextKey(const char* str, int size);
+
+    bool operator==(const TextKey& other) const;
+};
+
+/**
+ * @struct TextKeyHash
+ * @brief FNV-1a hash over key text and font size
+ */
+struct TextKeyHash {
+    std::size_t operator()(const TextKey& key) const;
+};
+
+/**
+ * @class TextCache
+ * @brief Rasterizes each distinct label once and redraws it as a texture
+ *
+ * HUD values change a few times per second at most, yet DrawText lays
+ * out and draws every glyph every frame. TextCache renders a string to
+ * a small white texture the first time it is seen and afterwards only
+ * blits that texture, tinted to the requested color. A new value (e.g.
+ * "Score: 150" → "Score: 250") is one new rasterization; unchanged text
+ * costs one textured quad.
+ *
+ * Cache policy:
+ * - Key: (text, font size); color is applied as tint at draw time
+ * - Width is cached alongside the texture, so measure() is free
+ * - At most MAX_ENTRIES textures; least recently used entries are
+ *   evicted when the limit is hit (old timer values, expired labels)
+ *
+ * Usage pattern:
+ * 1. beginFrame() once per frame
+ * 2. draw()/measure() with char buffers formatted via snprintf
+ *
+ * @note Without an open window entries are tracked but no texture is
+ *       created (headless tests); draw() is then a no-op
+ */
+class TextCache {
+public:
+    static const int MAX_ENTRIES = 96; ///< Texture budget before eviction
+
+private:
+    struct Entry {
+        Texture2D texture;
+        int width;
+        unsigned int lastUsedFrame;
+    };
+
+    std::unordered_map<TextKey, Entry, TextKeyHash> entries;
+    unsigned int frame;
+    int rasterizeCount;
+
+public:
+    TextCache();
+    ~TextCache();
+
+    TextCache(const TextCache&) = delete;
+    TextCache& operator=(const TextCache&) = delete;
+
+    /**
+     * @brief Advance frame counter used for LRU eviction
+     */
+    void beginFrame() { frame++; }
+
+    /**
+     * @brief Draw cached text
+     * @param text Null-terminated string
+     * @param x Screen X
+     * @param y Screen Y
+     * @param fontSize Default-font size
+     * @param color Tint applied to the white glyphs
+     */
+    void draw(const char* text, int x, int y, int fontSize, Color color);
+
+    /**
+     * @brief Get pixel width of text (rasterizes on first use)
+     * @param text Null-terminated string
+     * @param fontSize Default-font size
+     * @return int Width in pixels
+     */
+    int measure(const char* text, int fontSize);
+
+    /**
+     * @brief Release all textures
+     */
+    void clear();
+
+    int getEntryCount() const { return static_cast<int>(entries.size()); }
+
+    /**
+     * @brief Get number of rasterizations since construction
+     * @return int Cache misses
+     */
+    int getRasterizeCount() const { return rasterizeCount; }
+
+private:
+    Entry& lookup(const char* text, int fontSize);
+    void evictOldest();
+    static void release(Entry& entry);
+};
+
+#endif // TEXTCACHE_H
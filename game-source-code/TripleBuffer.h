@@ -0,0 +1,77 @@
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+#include <atomic>
+
+/**
+ * @file TripleBuffer.h
+ * @brief Lock-free single-writer/single-reader latest-value exchange
+ */
+
+/**
+ * @class TripleBuffer
+ * @brief Three slots so writer and reader never wait for each other
+ *
+ * The writer always owns one slot, the reader owns another and the
+ * third ("middle") holds the most recently published value:
+ * 1. Writer fills getWriteSlot(), then publish() swaps it with middle
+ * 2. Reader calls update(); if something new was published it swaps
+ *    its slot with middle and reads getReadSlot()
+ *
+ * Intermediate values are skipped when the reader is slower than the
+ * writer - the reader always sees the newest complete value.
+ *
+ * @tparam T Slot type (reused, never reallocated)
+ * @note Exactly one writer thread and one reader thread
+ */
+template <typename T>
+class TripleBuffer {
+private:
+    static const unsigned int INDEX_MASK = 0x3;
+    static const unsigned int FRESH_BIT = 0x4;
+
+    T slots[3];
+    std::atomic<unsigned int> middle;
+    unsigned int writeIndex;
+    unsigned int readIndex;
+
+public:
+    TripleBuffer() : middle(1), writeIndex(0), readIndex(2) {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /**
+     * @brief Slot the writer may fill (writer thread only)
+     */
+    T& getWriteSlot() { return slots[writeIndex]; }
+
+    /**
+     * @brief Make the write slot visible to the reader (writer thread only)
+     */
+    void publish() {
+        unsigned int previous = middle.exchange(writeIndex | FRESH_BIT,
+                                                std::memory_order_acq_rel);
+        writeIndex = previous & INDEX_MASK;
+    }
+
+    /**
+     * @brief Acquire newest published value if any (reader thread only)
+     * @return true if the read slot changed
+     */
+    bool update() {
+        if ((middle.load(std::memory_order_acquire) & FRESH_BIT) == 0) {
+            return false;
+        }
+        unsigned int previous = middle.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * @brief Current value seen by the reader (reader thread only)
+     */
+    const T& getReadSlot() const { return slots[readIndex]; }
+};
+
+#endif // TRIPLEBUFFER_H
@@ -2,70 +2,73 @@
 #include "Coordinate.h"
 #include <cmath>
 #include <algorithm>
+#include <cstdio>
 
 UIManager::UIManager(int screenW, int screenH, int cellSz) 
     : screenWidth(screenW), screenHeight(screenH), cellSize(cellSz),
       hudHeight(Coordinate::HUD_ROWS * cellSz) {
 }
 
-void UIManager::drawHUD(int level, int score, int targetScore, int lives, 
-                       float levelTimer, const std::vector<PowerUpEffect>& activePowerUps,
-                       bool canFireHarpoon, float harpoonProgress) {
+void UIManager::drawHUD(const RenderSnapshot::HudView& hud) {
+    char buffer[32];
+    
     DrawRectangle(0, 0, screenWidth, 2 * cellSize, Color{40, 40, 40, 255});
     DrawLine(0, 2 * cellSize, screenWidth, 2 * cellSize, WHITE);
     
-    DrawText("UNDERGROUND ADVENTURE", 10, 10, 24, GOLD);
-    DrawText(("Level " + std::to_string(level)).c_str(), 
-             screenWidth - 120, 10, 20, SKYBLUE);
+    textCache.draw("UNDERGROUND ADVENTURE", 10, 10, 24, GOLD);
+    std::snprintf(buffer, sizeof(buffer), "Level %d", hud.level);
+    textCache.draw(buffer, screenWidth - 120, 10, 20, SKYBLUE);
     
     int row2Y = cellSize + 10;
-    DrawText(("Score: " + std::to_string(score)).c_str(), 10, row2Y, 18, GREEN);
-    DrawText(("Target: " + std::to_string(targetScore)).c_str(), 
-             180, row2Y, 18, YELLOW);
+    std::snprintf(buffer, sizeof(buffer), "Score: %d", hud.score);
+    textCache.draw(buffer, 10, row2Y, 18, GREEN);
+    std::snprintf(buffer, sizeof(buffer), "Target: %d", hud.targetScore);
+    textCache.draw(buffer, 180, row2Y, 18, YELLOW);
     
-    Color livesColor = lives > 1 ? Color{255, 100, 100, 255} : RED;
-    DrawText(("Lives: " + std::to_string(lives)).c_str(), 350, row2Y, 18, livesColor);
+    Color livesColor = hud.lives > 1 ? Color{255, 100, 100, 255} : RED;
+    std::snprintf(buffer, sizeof(buffer), "Lives: %d", hud.lives);
+    textCache.draw(buffer, 350, row2Y, 18, livesColor);
     
-    int minutes = static_cast<int>(levelTimer) / 60;
-    int seconds = static_cast<int>(levelTimer) % 60;
-    DrawText(("Time: " + std::to_string(minutes) + ":" + 
-             (seconds < 10 ? "0" : "") + std::to_string(seconds)).c_str(), 
-             480, row2Y, 18, WHITE);
+    int minutes = static_cast<int>(hud.levelTimer) / 60;
+    int seconds = static_cast<int>(hud.levelTimer) % 60;
+    std::snprintf(buffer, sizeof(buffer), "Time: %d:%02d", minutes, seconds);
+    textCache.draw(buffer, 480, row2Y, 18, WHITE);
     
-    drawPowerUpStatus(activePowerUps, 620, row2Y);
+    drawPowerUpStatus(hud, 620, row2Y);
     
-    if (!canFireHarpoon) {
-        drawWeaponCooldown(canFireHarpoon, harpoonProgress, 
+    if (!hud.canFireHarpoon) {
+        drawWeaponCooldown(hud.canFireHarpoon, hud.harpoonProgress, 
                           screenWidth - 100, row2Y + 25);
     }
 }
 
-void UIManager::drawPowerUpStatus(const std::vector<PowerUpEffect>& effects, 
+void UIManager::drawPowerUpStatus(const RenderSnapshot::HudView& hud, 
                                  int startX, int y) {
     int powerupX = startX;
+    char text[32];
     
-    for (const auto& effect : effects) {
-        if (!effect.active) continue;
+    for (int i = 0; i < hud.effectCount; ++i) {
+        const RenderSnapshot::EffectView& effect = hud.effects[i];
         
-        std::string text;
+        const char* label;
         Color color;
-        float timeLeft = effect.getTimeRemaining();
+        float timeLeft = effect.remaining;
         
         switch (effect.type) {
             case PowerUpType::RAPID_FIRE:
-                text = "RAPID " + std::to_string(static_cast<int>(timeLeft)) + "s";
+                label = "RAPID";
                 color = Color{0, 255, 255, 255};
                 break;
             case PowerUpType::POWER_SHOT:
-                text = "POWER " + std::to_string(static_cast<int>(timeLeft)) + "s";
+                label = "POWER";
                 color = ORANGE;
                 break;
             case PowerUpType::SPEED_BOOST:
-                text = "SPEED " + std::to_string(static_cast<int>(timeLeft)) + "s";
+                label = "SPEED";
                 color = Color{255, 255, 0, 255};
                 break;
             case PowerUpType::INVINCIBILITY:
-                text = "INVINCIBLE " + std::to_string(static_cast<int>(timeLeft)) + "s";
+                label = "INVINCIBLE";
                 color = Color{255, 0, 255, 255};
                 break;
             default:
@@ -77,8 +80,10 @@ void UIManager::drawPowerUpStatus(const std::vector<PowerUpEffect>& effects,
             color = ColorAlpha(color, pulse);
         }
         
-        DrawText(text.c_str(), powerupX, y, 14, color);
-        powerupX += text.length() * 8 + 10;
+        int length = std::snprintf(text, sizeof(text), "%s %ds", label, 
+                                   static_cast<int>(timeLeft));
+        textCache.draw(text, powerupX, y, 14, color);
+        powerupX += length * 8 + 10;
     }
 }
 
@@ -88,15 +93,14 @@ void UIManager::drawWeaponCooldown(bool canFire, float progress, int x, int y) {
     
     DrawRectangle(x, y, barWidth, barHeight, GRAY);
     DrawRectangle(x, y, static_cast<int>(barWidth * progress), barHeight, GREEN);
-    DrawText("WEAPON", x - 60, y, 12, WHITE);
+    textCache.draw("WEAPON", x - 60, y, 12, WHITE);
 }
 
-void UIManager::drawPowerUpNotification(const std::string& message, 
-                                       float timeSince) {
-    if (timeSince >= 3.0f || message.empty()) return;
+void UIManager::drawPowerUpNotification(const char* message, float timeSince) {
+    if (timeSince >= 3.0f || message[0] == '\0') return;
     
     float alpha = 1.0f - (timeSince / 3.0f);
-    int textWidth = MeasureText(message.c_str(), 24);
+    int textWidth = textCache.measure(message, 24);
     int x = (screenWidth - textWidth) / 2;
     int y = screenHeight / 2 - 100;
     
@@ -104,70 +108,76 @@ void UIManager::drawPowerUpNotification(const std::string& message,
                  ColorAlpha(BLACK, alpha * 0.7f));
     
     Color textColor = ColorAlpha(GOLD, alpha);
-    DrawText(message.c_str(), x + 1, y + 1, 24, ColorAlpha(BLACK, alpha));
-    DrawText(message.c_str(), x, y, 24, textColor);
+    textCache.draw(message, x + 1, y + 1, 24, ColorAlpha(BLACK, alpha));
+    textCache.draw(message, x, y, 24, textColor);
 }
 
 void UIManager::drawMenu() {
-    DrawText("UNDERGROUND ADVENTURE", screenWidth/2 - 200, 
-             screenHeight/2 - 100, 32, GOLD);
-    DrawText("Press ENTER to Start", screenWidth/2 - 120, 
-             screenHeight/2 - 40, 20, YELLOW);
-    DrawText("Arrow Keys - Move & Dig", screenWidth/2 - 120, 
-             screenHeight/2, 16, LIGHTGRAY);
-    DrawText("SPACE - Fire Harpoon", screenWidth/2 - 110, 
-             screenHeight/2 + 25, 16, LIGHTGRAY);
-    DrawText("P - Pause  |  R - Restart", screenWidth/2 - 120, 
-             screenHeight/2 + 50, 14, GRAY);
+    textCache.draw("UNDERGROUND ADVENTURE", screenWidth/2 - 200, 
+                   screenHeight/2 - 100, 32, GOLD);
+    textCache.draw("Press ENTER to Start", screenWidth/2 - 120, 
+                   screenHeight/2 - 40, 20, YELLOW);
+    textCache.draw("Arrow Keys - Move & Dig", screenWidth/2 - 120, 
+                   screenHeight/2, 16, LIGHTGRAY);
+    textCache.draw("SPACE - Fire Harpoon", screenWidth/2 - 110, 
+                   screenHeight/2 + 25, 16, LIGHTGRAY);
+    textCache.draw("P - Pause  |  R - Restart", screenWidth/2 - 120, 
+                   screenHeight/2 + 50, 14, GRAY);
 }
 
 void UIManager::drawPauseOverlay() {
     DrawRectangle(0, hudHeight, screenWidth, screenHeight - hudHeight, 
                  ColorAlpha(BLACK, 0.7f));
-    DrawText("PAUSED", screenWidth/2 - 60, screenHeight/2, 32, WHITE);
-    DrawText("Press P to Resume", screenWidth/2 - 80, 
-             screenHeight/2 + 40, 16, YELLOW);
+    textCache.draw("PAUSED", screenWidth/2 - 60, screenHeight/2, 32, WHITE);
+    textCache.draw("Press P to Resume", screenWidth/2 - 80, 
+                   screenHeight/2 + 40, 16, YELLOW);
 }
 
 void UIManager::drawGameOverScreen(int score, int level) {
+    char buffer[32];
+    
     DrawRectangle(0, hudHeight, screenWidth, screenHeight - hudHeight, 
                  ColorAlpha(BLACK, 0.8f));
-    DrawText("GAME OVER", screenWidth/2 - 100, screenHeight/2 - 50, 32, RED);
-    DrawText(("Final Score: " + std::to_string(score)).c_str(), 
-             screenWidth/2 - 80, screenHeight/2, 20, WHITE);
-    DrawText(("Level Reached: " + std::to_string(level)).c_str(), 
-             screenWidth/2 - 90, screenHeight/2 + 30, 16, GRAY);
-    DrawText("Press R to Restart", screenWidth/2 - 80, 
-             screenHeight/2 + 60, 16, YELLOW);
-    DrawText("Press ESC to Exit", screenWidth/2 - 75, 
-             screenHeight/2 + 80, 16, YELLOW);
+    textCache.draw("GAME OVER", screenWidth/2 - 100, screenHeight/2 - 50, 32, RED);
+    std::snprintf(buffer, sizeof(buffer), "Final Score: %d", score);
+    textCache.draw(buffer, screenWidth/2 - 80, screenHeight/2, 20, WHITE);
+    std::snprintf(buffer, sizeof(buffer), "Level Reached: %d", level);
+    textCache.draw(buffer, screenWidth/2 - 90, screenHeight/2 + 30, 16, GRAY);
+    textCache.draw("Press R to Restart", screenWidth/2 - 80, 
+                   screenHeight/2 + 60, 16, YELLOW);
+    textCache.draw("Press ESC to Exit", screenWidth/2 - 75, 
+                   screenHeight/2 + 80, 16, YELLOW);
 }
 
 void UIManager::drawLevelCompleteScreen(int score, float levelTimer) {
+    char buffer[32];
+    
     DrawRectangle(0, hudHeight, screenWidth, screenHeight - hudHeight, 
                  ColorAlpha(BLACK, 0.7f));
-    DrawText("LEVEL COMPLETE!", screenWidth/2 - 130, 
-             screenHeight/2 - 50, 28, GREEN);
-    DrawText(("Score: " + std::to_string(score)).c_str(), 
-             screenWidth/2 - 60, screenHeight/2, 20, WHITE);
+    textCache.draw("LEVEL COMPLETE!", screenWidth/2 - 130, 
+                   screenHeight/2 - 50, 28, GREEN);
+    std::snprintf(buffer, sizeof(buffer), "Score: %d", score);
+    textCache.draw(buffer, screenWidth/2 - 60, screenHeight/2, 20, WHITE);
     
     float maxTime = 180.0f;
     float timeRatio = std::max(0.0f, (maxTime - levelTimer) / maxTime);
     int timeBonus = static_cast<int>(1000 * timeRatio);
-    DrawText(("Time Bonus: " + std::to_string(timeBonus)).c_str(), 
-             screenWidth/2 - 80, screenHeight/2 + 30, 16, GOLD);
+    std::snprintf(buffer, sizeof(buffer), "Time Bonus: %d", timeBonus);
+    textCache.draw(buffer, screenWidth/2 - 80, screenHeight/2 + 30, 16, GOLD);
     
-    DrawText("Press ENTER for Next Level", screenWidth/2 - 120, 
-             screenHeight/2 + 60, 16, YELLOW);
+    textCache.draw("Press ENTER for Next Level", screenWidth/2 - 120, 
+                   screenHeight/2 + 60, 16, YELLOW);
 }
 
 void UIManager::drawVictoryScreen(int score) {
+    char buffer[32];
+    
     DrawRectangle(0, 0, screenWidth, screenHeight, ColorAlpha(PURPLE, 0.8f));
-    DrawText("VICTORY!", screenWidth/2 - 80, screenHeight/2 - 80, 40, GOLD);
-    DrawText("You defeated all enemies!", screenWidth/2 - 140, 
-             screenHeight/2 - 30, 20, WHITE);
-    DrawText(("Final Score: " + std::to_string(score)).c_str(), 
-             screenWidth/2 - 80, screenHeight/2 + 10, 18, YELLOW);
-    DrawText("Press R to Play Again", screenWidth/2 - 90, 
-             screenHeight/2 + 50, 16, WHITE);
+    textCache.draw("VICTORY!", screenWidth/2 - 80, screenHeight/2 - 80, 40, GOLD);
+    textCache.draw("You defeated all enemies!", screenWidth/2 - 140, 
+                   screenHeight/2 - 30, 20, WHITE);
+    std::snprintf(buffer, sizeof(buffer), "Final Score: %d", score);
+    textCache.draw(buffer, screenWidth/2 - 80, screenHeight/2 + 10, 18, YELLOW);
+    textCache.draw("Press R to Play Again", screenWidth/2 - 90, 
+                   screenHeight/2 + 50, 16, WHITE);
 }
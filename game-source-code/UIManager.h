@@ -5,6 +5,9 @@
 #include <vector>
 #include <string>
 #include "PowerUp.h"
+#include "TextCache.h"
+#include "RenderSnapshot.h"
+#include "GameClock.h"
 
 /**
  * @file UIManager.h
@@ -21,15 +24,15 @@ struct PowerUpEffect {
     float duration;
     bool active;
     
-    PowerUpEffect(PowerUpType t, float d) : type(t), startTime(GetTime()), 
+    PowerUpEffect(PowerUpType t, float d) : type(t), startTime(GameClock::now()), 
                                            duration(d), active(true) {}
     
     bool isExpired() const {
-        return (GetTime() - startTime) >= duration;
+        return (GameClock::now() - startTime) >= duration;
     }
     
     float getTimeRemaining() const {
-        return duration - (GetTime() - startTime);
+        return duration - (GameClock::now() - startTime);
     }
 };
 
@@ -59,6 +62,10 @@ struct PowerUpEffect {
  * - Centered text layouts
  * - Instruction prompts
  * 
+ * Text rendering:
+ * - Every label goes through a TextCache (rasterized once per value)
+ * - Numbers are formatted into stack buffers, no std::string per frame
+ * 
  * @note UIManager only renders - no game logic
  */
 class UIManager {
@@ -67,6 +74,7 @@ private:
     const int screenHeight;
     const int cellSize;
     const int hudHeight;
+    TextCache textCache;
 
 public:
     /**
@@ -77,27 +85,23 @@ public:
      */
     UIManager(int screenW, int screenH, int cellSz);
     
+    /**
+     * @brief Mark start of a frame for text cache eviction
+     */
+    void beginFrame() { textCache.beginFrame(); }
+    
     /**
      * @brief Draw heads-up display during gameplay
-     * @param level Current level number
-     * @param score Current score
-     * @param targetScore Target score for completion
-     * @param lives Remaining lives
-     * @param levelTimer Time elapsed in level
-     * @param activePowerUps Active timed effects
-     * @param canFireHarpoon true if weapon ready
-     * @param harpoonProgress Cooldown progress (0.0-1.0)
+     * @param hud HUD values captured by the simulation
      */
-    void drawHUD(int level, int score, int targetScore, int lives, 
-                float levelTimer, const std::vector<PowerUpEffect>& activePowerUps,
-                bool canFireHarpoon, float harpoonProgress);
+    void drawHUD(const RenderSnapshot::HudView& hud);
     
     /**
      * @brief Draw power-up collection notification
      * @param message Notification text
      * @param timeSince Time since collection
      */
-    void drawPowerUpNotification(const std::string& message, float timeSince);
+    void drawPowerUpNotification(const char* message, float timeSince);
     
     /**
      * @brief Draw main menu screen
@@ -130,8 +134,7 @@ public:
     void drawVictoryScreen(int score);
     
 private:
-    void drawPowerUpStatus(const std::vector<PowerUpEffect>& effects, 
-                          int startX, int y);
+    void drawPowerUpStatus(const RenderSnapshot::HudView& hud, int startX, int y);
     void drawWeaponCooldown(bool canFire, float progress, int x, int y);
 };
 
@@ -1,468 +1,367 @@
 #include <raylib-cpp.hpp>
 #include <iostream>
-#include <vector>
-#include "Coordinate.h"
-#include "BlockGrid.h"
-#include "Player.h"
-#include "Enemy.h"
-#include "Harpoon.h"
-#include "PowerUp.h"
-#include "Rock.h"
-#include "FireProjectile.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
 #include "RenderManager.h"
 #include "UIManager.h"
 #include "InputManager.h"
-#include "CollisionManager.h"
-#include "LevelManager.h"
-#include "PowerUpManager.h"
-#include "GameState.h"
 #include "ParticleSystem.h"
 #include "ScreenShake.h"
+#include "SoundManager.h"
+#include "GameEvents.h"
+#include "EffectsPresenter.h"
+#include "GameSimulation.h"
+#include "GameClock.h"
+#include "RenderSnapshot.h"
+#include "TripleBuffer.h"
+#include "SpscQueue.h"
 #include "GameConstants.h"
+#include "EnemyArchetypes.h"
+#include "GameTuning.h"
+#include "HotReloadService.h"
+#include "MetricsRegistry.h"
+#include "MetricsExporter.h"
+#include "MemoryTracker.h"
 
 using namespace GameConstants;
 
+/**
+ * @brief Metrics the game records; registered once, then touched only
+ *        through their atomics from the window and simulation threads
+ */
+struct GameMetrics {
+    MetricHistogram& frameTime;
+    MetricHistogram& tickTime;
+    MetricHistogram& inputLatency;
+    MetricCounter& ticks;
+    MetricCounter& pathQueries;
+    MetricCounter& collisionTests;
+    MetricGauge& particles;
+    MetricGauge& enemies;
+    MetricGauge& rocks;
+    MetricGauge& harpoons;
+    MetricGauge& fires;
+    MetricGauge& powerUps;
+    MetricCounter& allocations;
+    MetricGauge* memoryBytes[static_cast<int>(MemoryTag::COUNT)];
+    MetricGauge* memoryPeakBytes[static_cast<int>(MemoryTag::COUNT)];
+    
+    explicit GameMetrics(MetricsRegistry& registry)
+        : frameTime(registry.histogram("digdug_frame_time_seconds", 
+                                       "Time between presented frames", 1e-6)),
+          tickTime(registry.histogram("digdug_tick_time_seconds", 
+                                      "Time spent in one simulation tick", 1e-6)),
+          inputLatency(registry.histogram("digdug_input_latency_seconds", 
+                                          "Movement key event to player cell change", 1e-6)),
+          ticks(registry.counter("digdug_ticks_total", "Simulation ticks run")),
+          pathQueries(registry.counter("digdug_path_queries_total", 
+                                       "Enemy tunnel path queries")),
+          collisionTests(registry.counter("digdug_collision_tests_total", 
+                                          "Collision pair tests and cell probes")),
+          particles(registry.gauge("digdug_particles", "Live particles")),
+          enemies(registry.gauge("digdug_entities", "Live entities", "kind=\"enemy\"")),
+          rocks(registry.gauge("digdug_entities", "Live entities", "kind=\"rock\"")),
+          harpoons(registry.gauge("digdug_entities", "Live entities", "kind=\"harpoon\"")),
+          fires(registry.gauge("digdug_entities", "Live entities", "kind=\"fire\"")),
+          powerUps(registry.gauge("digdug_entities", "Live entities", "kind=\"powerup\"")),
+          allocations(registry.counter("digdug_allocations_total", "Heap allocations")) {
+        for (int i = 0; i < static_cast<int>(MemoryTag::COUNT); ++i) {
+            std::string label = std::string("subsystem=\"") + 
+                                MemoryTracker::tagName(static_cast<MemoryTag>(i)) + "\"";
+            memoryBytes[i] = &registry.gauge("digdug_memory_bytes", "Live heap bytes", label);
+            memoryPeakBytes[i] = &registry.gauge("digdug_memory_peak_bytes", 
+                                                 "High-water mark of heap bytes", label);
+        }
+    }
+};
+
 class DigDugGame {
 private:
     raylib::Window window;
     RenderManager renderer;
     UIManager uiManager;
-    InputManager inputManager;
-    CollisionManager collisionManager;
-    LevelManager levelManager;
-    PowerUpManager powerUpManager;
-    GameStateManager stateManager;
     ParticleSystem particles;
     ScreenShake screenShake;
+    SoundManager soundManager;
+    GameEventQueue events;
+    EffectsPresenter presenter;
+    
+    GameSimulation simulation;
+    InputLatch inputLatch;
+    InputLatencyProbe latencyProbe;
+    TripleBuffer<RenderSnapshot> snapshots;
+    SpscQueue<GameEvent, 512> simulationEvents;
+    std::atomic<bool> quit;
     
-    BlockGrid terrain;
-    Player player;
-    std::vector<Enemy> enemies;
-    std::vector<Harpoon> harpoons;
-    std::vector<PowerUp> powerUps;
-    std::vector<Rock> rocks;
-    std::vector<FireProjectile> fireProjectiles;
+    RenderSnapshot previousSnapshot;
+    RenderSnapshot currentSnapshot;
+    double snapshotArrivalTime;
+    bool threadedSimulation;
+    HotReloadService hotReload;
+    int ticksSinceConfigCheck;
     
-    int score;
-    int enemiesDefeated;
-    int playerLives;
-    float lastHarpoonTime;
-    float levelTimer;
+    MetricsRegistry metricsRegistry;
+    GameMetrics metrics;
+    MetricsExporter metricsExporter;
+    std::uint64_t pathQueriesSeen;
+    std::uint64_t collisionTestsSeen;
+    std::uint64_t allocationsSeen;
+    bool budgetReported[static_cast<int>(MemoryTag::COUNT)];
 
 public:
-    DigDugGame() : window(SCREEN_WIDTH, SCREEN_HEIGHT, "Underground Adventure"),
-                   renderer(CELL_SIZE, SCREEN_WIDTH, SCREEN_HEIGHT),
-                   uiManager(SCREEN_WIDTH, SCREEN_HEIGHT, CELL_SIZE),
-                   player(Coordinate(Coordinate::PLAYABLE_START_ROW, 1)),
-                   score(0), enemiesDefeated(0), playerLives(STARTING_LIVES), 
-                   lastHarpoonTime(0.0f), levelTimer(0.0f) {
-        window.SetTargetFPS(60);
-        initializeNewGame();
+    DigDugGame(bool useSimulationThread, const MetricsExporter::Settings& metricsSettings) 
+        : window(SCREEN_WIDTH, SCREEN_HEIGHT, "Underground Adventure"),
+          renderer(CELL_SIZE, SCREEN_WIDTH, SCREEN_HEIGHT),
+          uiManager(SCREEN_WIDTH, SCREEN_HEIGHT, CELL_SIZE),
+          presenter(particles, screenShake, &soundManager, CELL_SIZE),
+          quit(false), snapshotArrivalTime(0.0), 
+          threadedSimulation(useSimulationThread), ticksSinceConfigCheck(0),
+          metrics(metricsRegistry), metricsExporter(metricsRegistry),
+          pathQueriesSeen(0), collisionTestsSeen(0), allocationsSeen(0), budgetReported{} {
+        window.SetTargetFPS(RENDER_TARGET_FPS);
+        soundManager.loadDefaultSounds();
+        
+        if (metricsSettings.port >= 0 || !metricsSettings.filePath.empty()) {
+            metricsExporter.start(metricsSettings);
+            if (metricsExporter.isServing()) {
+                std::cout << "Metrics on http://127.0.0.1:" << metricsExporter.getPort() 
+                          << "/metrics" << std::endl;
+            }
+        }
     }
     
     void run() {
-        while (!window.ShouldClose()) {
-            update();
-            render();
+        if (threadedSimulation) {
+            runThreaded();
+        } else {
+            runSingleThreaded();
         }
     }
 
 private:
-    void update() {
-        float deltaTime = GetFrameTime();
-        particles.update();
-        screenShake.update();
+    // Window thread: input sampling and drawing. raylib must stay on the
+    // thread that created the window, so the simulation is what moves.
+    void runThreaded() {
+        std::thread simulationThread(&DigDugGame::simulationLoop, this);
         
-        switch (stateManager.getCurrentState()) {
-            case GameState::MENU:
-                handleMenuState();
-                break;
-            case GameState::PLAYING:
-                updateGameplay(deltaTime);
-                break;
-            case GameState::PAUSED:
-                handlePauseState();
-                break;
-            case GameState::GAME_OVER:
-            case GameState::LEVEL_COMPLETE:
-            case GameState::VICTORY:
-                handleEndGameState();
-                break;
-            default:
-                break;
+        while (!quit.load(std::memory_order_acquire)) {
+            if (window.ShouldClose()) {
+                quit.store(true, std::memory_order_release);
+            }
+            inputLatch.sampleKeyboard();
+            handleDiagnosticKeys();
+            present();
         }
         
-        stateManager.update(deltaTime);
+        simulationThread.join();
     }
     
-    void updateGameplay(float deltaTime) {
-        levelTimer += deltaTime;
+    void simulationLoop() {
+        using Clock = std::chrono::steady_clock;
+        const auto tickDuration = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(SIMULATION_TICK));
+        const auto maxLag = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(MAX_FRAME_CATCHUP));
         
-        handleGameInput();
-        updateGameObjects();
-        powerUpManager.update();
-        powerUpManager.applySpeedReset(player);
-        checkAllCollisions();
-        checkLevelProgression();
-        spawnPowerUps();
+        GameClock::setFixedStep(SIMULATION_TICK, GetTime());
+        auto nextTick = Clock::now();
         
-        if (player.getIsDigging()) {
-            Coordinate pos = player.getPosition();
-            Vector2 particlePos = {
-                pos.col * CELL_SIZE + CELL_SIZE / 2.0f,
-                pos.row * CELL_SIZE + CELL_SIZE / 2.0f
-            };
-            particles.emitTrail(particlePos, BROWN);
-        }
-    }
-    
-    void updateGameObjects() {
-        player.update();
-        updateEnemies();
-        updateHarpoons();
-        updatePowerUps();
-        updateRocks();
-        updateFireProjectiles();
-    }
-    
-    void updateEnemies() {
-        for (auto& enemy : enemies) {
-            if (enemy.isActive()) {
-                bool wasDestroyed = enemy.getIsDestroyed();
-                
-                if (!enemy.getIsDestroyed()) {
-                    enemy.moveToward(player.getPosition(), terrain);
-                    
-                    if (enemy.shouldBreatheFire(player.getPosition())) {
-                        Direction fireDir = enemy.getFireDirection(player.getPosition());
-                        fireProjectiles.emplace_back(enemy.getPosition(), fireDir);
-                        
-                        Coordinate pos = enemy.getPosition();
-                        Vector2 particlePos = {
-                            pos.col * CELL_SIZE + CELL_SIZE / 2.0f,
-                            pos.row * CELL_SIZE + CELL_SIZE / 2.0f
-                        };
-                        particles.emit(particlePos, ORANGE, 8);
-                    }
-                }
-                enemy.update();
-                
-                if (!wasDestroyed && enemy.getIsDestroyed()) {
-                    Coordinate pos = enemy.getPosition();
-                    Vector2 particlePos = {
-                        pos.col * CELL_SIZE + CELL_SIZE / 2.0f,
-                        pos.row * CELL_SIZE + CELL_SIZE / 2.0f
-                    };
-                    particles.emitBurst(particlePos, YELLOW, 15);
-                    screenShake.shake(5.0f, 0.2f);
-                }
+        while (!quit.load(std::memory_order_acquire)) {
+            tickSimulation();
+            
+            nextTick += tickDuration;
+            auto now = Clock::now();
+            if (now - nextTick > maxLag) {
+                nextTick = now;
             }
+            std::this_thread::sleep_until(nextTick);
         }
     }
     
-    void updateHarpoons() {
-        harpoons.erase(
-            std::remove_if(harpoons.begin(), harpoons.end(),
-                [](Harpoon& h) { 
-                    if (h.isActive()) {
-                        h.update();
-                        return false;
-                    }
-                    return true;
-                }),
-            harpoons.end()
-        );
-    }
-    
-    void updatePowerUps() {
-        powerUps.erase(
-            std::remove_if(powerUps.begin(), powerUps.end(),
-                [](PowerUp& p) {
-                    if (p.isActive()) {
-                        p.update();
-                        return false;
-                    }
-                    return true;
-                }),
-            powerUps.end()
-        );
-    }
-    
-    void updateRocks() {
-        for (auto& rock : rocks) {
-            if (rock.isActive()) {
-                bool wasFalling = rock.getIsFalling();
-                rock.update();
-                rock.applyGravity(terrain);
-                
-                if (wasFalling && rock.getHasLanded()) {
-                    Coordinate pos = rock.getPosition();
-                    Vector2 particlePos = {
-                        pos.col * CELL_SIZE + CELL_SIZE / 2.0f,
-                        pos.row * CELL_SIZE + CELL_SIZE / 2.0f
-                    };
-                    particles.emit(particlePos, GRAY, 10);
-                    screenShake.shake(8.0f, 0.25f);
-                }
+    // Fallback: same fixed-step simulation driven by an accumulator on
+    // the window thread
+    void runSingleThreaded() {
+        GameClock::setFixedStep(SIMULATION_TICK, GetTime());
+        float accumulator = 0.0f;
+        
+        while (!quit.load(std::memory_order_acquire)) {
+            if (window.ShouldClose()) {
+                quit.store(true, std::memory_order_release);
             }
-        }
-    }
-    
-    void updateFireProjectiles() {
-        for (auto& fire : fireProjectiles) {
-            if (fire.isActive()) {
-                fire.update();
-                
-                if (fire.checkPlayerHit(player.getPosition())) {
-                    playerHitByFire();
-                    fire.setActive(false);
-                }
+            inputLatch.sampleKeyboard();
+            handleDiagnosticKeys();
+            
+            accumulator = std::min(accumulator + GetFrameTime(), MAX_FRAME_CATCHUP);
+            while (accumulator >= SIMULATION_TICK) {
+                tickSimulation();
+                accumulator -= SIMULATION_TICK;
             }
+            
+            present();
         }
-        
-        fireProjectiles.erase(
-            std::remove_if(fireProjectiles.begin(), fireProjectiles.end(),
-                [](const FireProjectile& f) { return !f.isActive(); }),
-            fireProjectiles.end()
-        );
     }
     
-    void handleGameInput() {
-        player.handleMovementWithRocks(terrain, rocks);
-        
-        if (inputManager.isHarpoonPressed() && canFireHarpoon()) {
-            fireHarpoon();
+    void tickSimulation() {
+        // Tick boundary: safe point to swap in edited maps and config.
+        // Notifications are one non-blocking read; timestamp scans run
+        // twice a second.
+        if (hotReload.isEventDriven() || ++ticksSinceConfigCheck >= SIMULATION_TICK_RATE / 2) {
+            ticksSinceConfigCheck = 0;
+            hotReload.applyPending(simulation);
         }
         
-        if (inputManager.isPausePressed()) {
-            stateManager.changeState(GameState::PAUSED);
-        }
+        InputFrame input = inputLatch.consume([this](const InputEvent& event) {
+            latencyProbe.onEvent(event);
+        });
         
-        if (inputManager.isRestartPressed()) {
-            restartGame();
-        }
+        auto tickStart = std::chrono::steady_clock::now();
+        simulation.step(input);
+        metrics.tickTime.record(static_cast<std::uint64_t>(std::chrono::duration_cast<
+            std::chrono::microseconds>(std::chrono::steady_clock::now() - tickStart).count()));
+        recordSimulationMetrics();
         
-        if (inputManager.isExitPressed()) {
-            window.Close();
-        }
-    }
-    
-    void fireHarpoon() {
-        Direction playerDir = player.getLastMoveDirection();
-        if (playerDir != Direction::NONE) {
-            Coordinate playerPos = player.getPosition();
-            harpoons.emplace_back(playerPos, playerDir, &player);
-            lastHarpoonTime = GetTime();
-        }
-    }
-    
-    bool canFireHarpoon() {
-        float currentTime = GetTime();
-        return (currentTime - lastHarpoonTime) >= powerUpManager.getHarpoonCooldown();
-    }
-    
-    void checkAllCollisions() {
-        if (collisionManager.checkPlayerEnemyCollision(player, enemies)) {
-            playerHit();
-            return;
+        GameEventQueue& tickEvents = simulation.getEvents();
+        for (const GameEvent& event : tickEvents) {
+            simulationEvents.push(event);
         }
+        tickEvents.clear();
         
-        collisionManager.checkHarpoonEnemyCollisions(harpoons, enemies, score, 
-                                                   enemiesDefeated, 
-                                                   levelManager.getCurrentLevel());
+        simulation.captureSnapshot(snapshots.getWriteSlot());
+        snapshots.publish();
         
-        bool playerCrushed = false;
-        collisionManager.checkRockCollisions(rocks, player, enemies, playerCrushed);
-        if (playerCrushed) {
-            playerHit();
-            return;
-        }
-        
-        PowerUp* collectedPowerUp = collisionManager.checkPowerUpCollision(player, 
-                                                                          powerUps);
-        if (collectedPowerUp) {
-            Coordinate pos = collectedPowerUp->getPosition();
-            Vector2 particlePos = {
-                pos.col * CELL_SIZE + CELL_SIZE / 2.0f,
-                pos.row * CELL_SIZE + CELL_SIZE / 2.0f
-            };
-            particles.emit(particlePos, GOLD, 12);
-            
-            powerUpManager.collectPowerUp(*collectedPowerUp, player, 
-                                        playerLives, score);
-            collectedPowerUp->collect();
+        if (simulation.isQuitRequested()) {
+            quit.store(true, std::memory_order_release);
         }
     }
     
-    void playerHit() {
-        Coordinate pos = player.getPosition();
-        Vector2 particlePos = {
-            pos.col * CELL_SIZE + CELL_SIZE / 2.0f,
-            pos.row * CELL_SIZE + CELL_SIZE / 2.0f
-        };
-        particles.emitBurst(particlePos, RED, 20);
-        screenShake.shake(15.0f, 0.4f);
-        
-        playerLives--;
+    // Simulation-side totals; the path cache's count restarts when state
+    // is restored, so only forward growth is added
+    void recordSimulationMetrics() {
+        metrics.ticks.add();
         
-        if (playerLives <= 0) {
-            stateManager.changeState(GameState::GAME_OVER);
-        } else {
-            player.reset(Coordinate(Coordinate::PLAYABLE_START_ROW, 1));
+        std::int64_t latencyMicros = 0;
+        if (latencyProbe.onPlayerCell(simulation.getPlayer().getPosition(), 
+                                      InputEvent::nowMicros(), latencyMicros)) {
+            metrics.inputLatency.record(static_cast<std::uint64_t>(latencyMicros));
         }
-    }
-    
-    void playerHitByFire() {
-        Coordinate pos = player.getPosition();
-        Vector2 particlePos = {
-            pos.col * CELL_SIZE + CELL_SIZE / 2.0f,
-            pos.row * CELL_SIZE + CELL_SIZE / 2.0f
-        };
-        particles.emitBurst(particlePos, ORANGE, 15);
-        screenShake.shake(12.0f, 0.3f);
         
-        playerLives--;
-        
-        if (playerLives <= 0) {
-            stateManager.changeState(GameState::GAME_OVER);
-        } else {
-            player.reset(Coordinate(Coordinate::PLAYABLE_START_ROW, 1));
-        }
-    }
-    
-    void checkLevelProgression() {
-        if (levelManager.isLevelComplete(enemies, score)) {
-            stateManager.changeState(GameState::LEVEL_COMPLETE);
-            score += levelManager.calculateTimeBonus(levelTimer, 
-                                                   levelManager.getCurrentLevel());
+        const PathCache::Stats& pathStats = simulation.getPathCache().getStats();
+        std::uint64_t pathQueries = static_cast<std::uint64_t>(
+            pathStats.hits + pathStats.suffixHits + pathStats.misses);
+        if (pathQueries >= pathQueriesSeen) {
+            metrics.pathQueries.add(pathQueries - pathQueriesSeen);
         }
+        pathQueriesSeen = pathQueries;
+        
+        std::uint64_t collisionTests = simulation.getCollisionManager().getTestsPerformed();
+        metrics.collisionTests.add(collisionTests - collisionTestsSeen);
+        collisionTestsSeen = collisionTests;
     }
     
-    void spawnPowerUps() {
-        if (levelManager.shouldSpawnPowerUp(levelTimer)) {
-            powerUps.push_back(levelManager.createRandomPowerUp());
-            levelManager.updatePowerUpSpawnTime(levelTimer);
+    void receiveSimulationOutput() {
+        if (snapshots.update()) {
+            previousSnapshot = currentSnapshot;
+            currentSnapshot = snapshots.getReadSlot();
+            snapshotArrivalTime = GetTime();
+            
+            metrics.enemies.set(currentSnapshot.enemyCount);
+            metrics.rocks.set(currentSnapshot.rockCount);
+            metrics.harpoons.set(currentSnapshot.harpoonCount);
+            metrics.fires.set(currentSnapshot.fireCount);
+            metrics.powerUps.set(currentSnapshot.powerUpCount);
+            
+            if (currentSnapshot.levelEpoch != previousSnapshot.levelEpoch) {
+                particles.clear();
+            }
         }
-    }
-    
-    void handleMenuState() {
-        InputAction action = inputManager.getMenuInput();
-        switch (action) {
-            case InputAction::CONFIRM:
-                stateManager.changeState(GameState::PLAYING);
-                initializeLevel();
-                break;
-            case InputAction::EXIT:
-                window.Close();
-                break;
-            default:
-                break;
+        
+        GameEvent event;
+        while (simulationEvents.pop(event)) {
+            events.push(event.type, event.position, event.value);
         }
     }
     
-    void handlePauseState() {
-        InputAction action = inputManager.getPauseInput();
-        switch (action) {
-            case InputAction::CONFIRM:
-                stateManager.changeState(GameState::PLAYING);
-                break;
-            case InputAction::EXIT:
-                window.Close();
-                break;
-            default:
-                break;
-        }
+    void present() {
+        receiveSimulationOutput();
+        particles.update();
+        screenShake.update();
+        presenter.drain(events);
+        render();
+        
+        metrics.frameTime.record(static_cast<std::uint64_t>(GetFrameTime() * 1e6f));
+        metrics.particles.set(particles.getParticleCount());
+        recordMemoryMetrics();
     }
     
-    void handleEndGameState() {
-        InputAction action = inputManager.getEndGameInput();
-        switch (action) {
-            case InputAction::RESTART:
-                restartGame();
-                break;
-            case InputAction::CONFIRM:
-                if (stateManager.getCurrentState() == GameState::LEVEL_COMPLETE) {
-                    nextLevel();
-                }
-                break;
-            case InputAction::EXIT:
-                window.Close();
-                break;
-            default:
-                break;
+    void handleDiagnosticKeys() {
+        if (IsKeyPressed(KEY_F9)) {
+            std::cout << MemoryTracker::report() << std::flush;
         }
     }
     
-    void initializeNewGame() {
-        levelManager.reset();
-        powerUpManager.reset();
-        score = 0;
-        playerLives = STARTING_LIVES;
-        enemiesDefeated = 0;
-        levelTimer = 0.0f;
-        lastHarpoonTime = 0.0f;
-        particles.clear();
-        initializeLevel();
-    }
-    
-    void initializeLevel() {
-        levelManager.initializeLevel(levelManager.getCurrentLevel(), terrain, 
-                                   player, enemies, powerUps, rocks);
-        levelTimer = 0.0f;
-        harpoons.clear();
-        fireProjectiles.clear();
-        particles.clear();
-        
-        if (!powerUpManager.hasPowerUpEffect(PowerUpType::SPEED_BOOST)) {
-            player.setSpeedMultiplier(1.0f);
+    void recordMemoryMetrics() {
+        for (int i = 0; i < static_cast<int>(MemoryTag::COUNT); ++i) {
+            MemoryTag tag = static_cast<MemoryTag>(i);
+            MemoryTracker::Usage usage = MemoryTracker::usage(tag);
+            metrics.memoryBytes[i]->set(usage.bytes);
+            metrics.memoryPeakBytes[i]->set(usage.peakBytes);
+            
+            if (!budgetReported[i] && MemoryTracker::isOverBudget(tag)) {
+                budgetReported[i] = true;
+                std::cout << "Memory budget exceeded: " << MemoryTracker::tagName(tag) 
+                          << " peaked at " << usage.peakBytes / 1024 << " KiB of " 
+                          << usage.budgetBytes / 1024 << " KiB" << std::endl;
+            }
         }
-    }
-    
-    void nextLevel() {
-        levelManager.nextLevel();
-        powerUpManager.reset();
-        player.setSpeedMultiplier(1.0f);
         
-        if (levelManager.getCurrentLevel() > MAX_LEVELS) {
-            stateManager.changeState(GameState::VICTORY);
-        } else {
-            stateManager.changeState(GameState::PLAYING);
-            initializeLevel();
-        }
+        std::uint64_t allocations = MemoryTracker::total().allocations;
+        metrics.allocations.add(allocations - allocationsSeen);
+        allocationsSeen = allocations;
     }
     
-    void restartGame() {
-        stateManager.changeState(GameState::PLAYING);
-        initializeNewGame();
+    float interpolationAlpha() const {
+        float alpha = static_cast<float>((GetTime() - snapshotArrivalTime) / SIMULATION_TICK);
+        return std::max(0.0f, std::min(1.0f, alpha));
     }
     
     void render() {
+        const RenderSnapshot& snapshot = currentSnapshot;
+        
         BeginDrawing();
         ClearBackground(BLACK);
+        uiManager.beginFrame();
         
         screenShake.apply();
         
-        switch (stateManager.getCurrentState()) {
+        switch (snapshot.state) {
             case GameState::MENU:
                 uiManager.drawMenu();
                 break;
             case GameState::PLAYING:
             case GameState::PAUSED:
                 drawGameScene();
-                if (stateManager.getCurrentState() == GameState::PAUSED) {
+                if (snapshot.state == GameState::PAUSED) {
                     uiManager.drawPauseOverlay();
                 }
                 break;
             case GameState::GAME_OVER:
                 drawGameScene();
-                uiManager.drawGameOverScreen(score, levelManager.getCurrentLevel());
+                uiManager.drawGameOverScreen(snapshot.hud.score, snapshot.hud.level);
                 break;
             case GameState::LEVEL_COMPLETE:
                 drawGameScene();
-                uiManager.drawLevelCompleteScreen(score, levelTimer);
+                uiManager.drawLevelCompleteScreen(snapshot.hud.score, 
+                                                  snapshot.hud.levelTimer);
                 break;
             case GameState::VICTORY:
-                uiManager.drawVictoryScreen(score);
+                uiManager.drawVictoryScreen(snapshot.hud.score);
+                break;
+            default:
                 break;
         }
         
@@ -471,36 +370,70 @@ private:
     }
     
     void drawGameScene() {
-        float harpoonProgress = canFireHarpoon() ? 1.0f : 
-                               (GetTime() - lastHarpoonTime) / 
-                               powerUpManager.getHarpoonCooldown();
+        const RenderSnapshot& snapshot = currentSnapshot;
+        float alpha = interpolationAlpha();
         
-        uiManager.drawHUD(levelManager.getCurrentLevel(), score, 
-                         levelManager.getTargetScore(), playerLives, 
-                         levelTimer, powerUpManager.getActivePowerUps(),
-                         canFireHarpoon(), harpoonProgress);
+        // World layers scroll with the camera; shake moves the camera
+        // because BeginMode2D() discards the pushed shake transform
+        renderer.updateCamera(previousSnapshot, snapshot, alpha, screenShake.getOffset());
+        renderer.beginWorld();
+        renderer.drawTerrain(snapshot);
+        renderer.drawEnemies(previousSnapshot, snapshot, alpha);
+        renderer.drawHarpoons(snapshot);
+        renderer.drawFireProjectiles(snapshot);
+        renderer.drawPowerUps(snapshot);
+        renderer.drawPlayer(previousSnapshot, snapshot, alpha);
+        renderer.drawRocks(previousSnapshot, snapshot, alpha);
+        renderer.flushEntities();
         
-        renderer.drawTerrain(terrain);
-        renderer.drawEnemies(enemies);
-        renderer.drawHarpoons(harpoons, powerUpManager.getHasPowerShot());
-        renderer.drawFireProjectiles(fireProjectiles);
-        renderer.drawPowerUps(powerUps);
-        renderer.drawPlayer(player, 
-                          powerUpManager.hasPowerUpEffect(PowerUpType::SPEED_BOOST),
-                          player.getIsDigging());
-        renderer.drawRocks(rocks, player);
+        particles.draw(renderer.getCamera().getViewRect());
+        renderer.endWorld();
         
-        particles.draw();
-        
-        uiManager.drawPowerUpNotification(powerUpManager.getPowerUpMessage(), 
-                                        powerUpManager.getTimeSinceLastCollection());
+        renderer.drawSky();
+        uiManager.drawHUD(snapshot.hud);
+        uiManager.drawPowerUpNotification(snapshot.hud.message, 
+                                          snapshot.hud.timeSinceMessage);
     }
 };
 
-int main() {
+int main(int argc, char* argv[]) {
+    bool useSimulationThread = true;
+    MetricsExporter::Settings metricsSettings;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--single-thread") == 0) {
+            useSimulationThread = false;
+        } else if (std::strcmp(argv[i], "--metrics-port") == 0 && i + 1 < argc) {
+            const char* port = argv[++i];
+            char* end = nullptr;
+            long value = std::strtol(port, &end, 10);
+            if (end != port && *end == '\0' && value >= 0 && value <= 65535) {
+                metricsSettings.port = static_cast<int>(value);
+            } else {
+                std::cout << "Ignoring metrics port '" << port << "'" << std::endl;
+            }
+        } else if (std::strcmp(argv[i], "--metrics-file") == 0 && i + 1 < argc) {
+            metricsSettings.filePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--memory-budget") == 0 && i + 1 < argc) {
+            // subsystem=KiB, e.g. particles=256
+            std::string budget = argv[++i];
+            std::size_t split = budget.find('=');
+            MemoryTag tag;
+            if (split != std::string::npos && 
+                MemoryTracker::tagFromName(budget.substr(0, split), tag)) {
+                MemoryTracker::setBudget(tag, std::atoll(budget.c_str() + split + 1) * 1024);
+            } else {
+                std::cout << "Ignoring memory budget '" << budget << "'" << std::endl;
+            }
+        }
+    }
+    
+    EnemyArchetypes::load();
+    GameTuning::load();
+    
     try {
-        DigDugGame game;
+        DigDugGame game(useSimulationThread, metricsSettings);
         game.run();
+        std::cout << MemoryTracker::report() << std::flush;
     } catch (const std::exception& e) {
         std::cout << "Error: " << e.what() << std::endl;
         return 1;
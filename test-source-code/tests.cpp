@@ -1,5 +1,12 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
 
 #include "../game-source-code/Coordinate.h"
 #include "../game-source-code/BlockGrid.h"
@@ -7,10 +14,54 @@
 #include "../game-source-code/Enemy.h"
 #include "../game-source-code/EnemyLogic.h"
 #include "../game-source-code/Rock.h"
+#include "../game-source-code/CollisionManager.h"
 #include "../game-source-code/Harpoon.h"
 #include "../game-source-code/LevelManager.h"
 #include "../game-source-code/GameState.h"
 #include "../game-source-code/PowerUpManager.h"
+#include "../game-source-code/GameEvents.h"
+#include "../game-source-code/SpriteBatch.h"
+#include "../game-source-code/TextCache.h"
+#include "../game-source-code/GameClock.h"
+#include "../game-source-code/GameSimulation.h"
+#include "../game-source-code/TripleBuffer.h"
+#include "../game-source-code/SpscQueue.h"
+#include "../game-source-code/GameRandom.h"
+#include "../game-source-code/StateSerializer.h"
+#include "../game-source-code/RollbackBuffer.h"
+#include "../game-source-code/LoopbackSession.h"
+#include "../game-source-code/LevelGenerator.h"
+#include "../game-source-code/LevelEvaluator.h"
+#include "../game-source-code/DistanceField.h"
+#include "../game-source-code/Direction.h"
+#include "../game-source-code/ObjectPool.h"
+#include "../game-source-code/FixedRing.h"
+#include "../game-source-code/FireProjectile.h"
+#include "../game-source-code/ProjectileSystem.h"
+#include "../game-source-code/EnemyArchetypes.h"
+#include "../game-source-code/GameTuning.h"
+#include "../game-source-code/FileWatcher.h"
+#include "../game-source-code/HotReloadService.h"
+#include "../game-source-code/GameCamera.h"
+#include "../game-source-code/BatchEnvironment.h"
+#include "../game-source-code/GameLog.h"
+#include "../game-source-code/FireLookahead.h"
+#include "../game-source-code/ReservationTable.h"
+#include "../game-source-code/AIScheduler.h"
+#include "../game-source-code/HierarchicalPathfinder.h"
+#include "../game-source-code/PathCache.h"
+#include "../game-source-code/MetricsRegistry.h"
+#include "../game-source-code/MetricsExporter.h"
+#include "../game-source-code/MemoryTracker.h"
+#include "../game-source-code/ParticleSystem.h"
+#include "../game-source-code/DirectionBuffer.h"
+
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
 
 TEST_CASE("Coordinate System") {
     SUBCASE("Constructor and member access") {
@@ -876,3 +927,1934 @@ TEST_CASE("Harpoon-Player Connection Mechanics") {
         CHECK(h2.isActive() == true);
     }
 }
+
+TEST_CASE("Gameplay Event Queue") {
+    GameEventQueue events;
+    
+    SUBCASE("Events recorded in order") {
+        events.push(GameEventType::ROCK_LANDED, Coordinate(8, 5));
+        events.push(GameEventType::DIG, Coordinate(4, 2), 1);
+        
+        CHECK(events.size() == 2);
+        CHECK(events.begin()[0].type == GameEventType::ROCK_LANDED);
+        CHECK(events.begin()[1].position == Coordinate(4, 2));
+        CHECK(events.begin()[1].value == 1);
+    }
+    
+    SUBCASE("Clear empties batch") {
+        events.push(GameEventType::PLAYER_HIT, Coordinate(5, 5));
+        events.clear();
+        CHECK(events.empty() == true);
+    }
+    
+    SUBCASE("Overflow is dropped not grown") {
+        for (int i = 0; i < GameEventQueue::CAPACITY + 5; ++i) {
+            events.push(GameEventType::DIG, Coordinate(5, 5));
+        }
+        CHECK(events.size() == GameEventQueue::CAPACITY);
+        CHECK(events.getDroppedCount() == 5);
+    }
+    
+    SUBCASE("Disabled queue ignores events") {
+        events.setEnabled(false);
+        events.push(GameEventType::ENEMY_DESTROYED, Coordinate(6, 6));
+        CHECK(events.empty() == true);
+    }
+}
+
+TEST_CASE("Sprite Atlas Batching") {
+    SpriteBatch batch;
+    SpriteAtlas atlas;
+    
+    SUBCASE("Atlas cells do not overlap") {
+        Rectangle first = SpriteAtlas::getSourceRect(SpriteId::PLAYER);
+        Rectangle wrapped = SpriteAtlas::getSourceRect(
+            static_cast<SpriteId>(SpriteAtlas::CELLS_PER_ROW));
+        
+        CHECK(first.x == 0.0f);
+        CHECK(first.width == SpriteAtlas::SPRITE_CELL);
+        CHECK(wrapped.x == 0.0f);
+        CHECK(wrapped.y == SpriteAtlas::SPRITE_CELL);
+    }
+    
+    SUBCASE("Quad scales with requested radius") {
+        batch.add(SpriteId::PLAYER, Vector2{100.0f, 100.0f}, 32.0f);
+        CHECK(batch.getPendingCount() == 1);
+        const SpriteQuad& player = batch.getPendingQuad(0);
+        CHECK(player.dest.x == doctest::Approx(68.0f));
+        CHECK(player.dest.y == doctest::Approx(68.0f));
+        CHECK(player.dest.width == doctest::Approx(64.0f));
+        CHECK(player.dest.height == doctest::Approx(64.0f));
+        
+        batch.addCircle(Vector2{0.0f, 0.0f}, 8.0f, RED);
+        CHECK(batch.getPendingCount() == 2);
+        CHECK(batch.getPendingQuad(1).dest.width == doctest::Approx(16.0f));
+        
+        batch.addRing(Vector2{50.0f, 50.0f}, 9.0f, WHITE);
+        const SpriteQuad& ring = batch.getPendingQuad(2);
+        CHECK(ring.dest.width == doctest::Approx(18.0f));
+        CHECK(ring.dest.height == doctest::Approx(18.0f));
+    }
+    
+    SUBCASE("Quads sample only the sprite, inside its cell") {
+        for (int i = 0; i < static_cast<int>(SpriteId::COUNT); ++i) {
+            SpriteId id = static_cast<SpriteId>(i);
+            Rectangle cell = SpriteAtlas::getSourceRect(id);
+            Rectangle sprite = SpriteAtlas::getSpriteRect(id);
+            CHECK(sprite.x >= cell.x);
+            CHECK(sprite.y >= cell.y);
+            CHECK(sprite.x + sprite.width <= cell.x + cell.width);
+            CHECK(sprite.y + sprite.height <= cell.y + cell.height);
+        }
+    }
+    
+    SUBCASE("PNG overrides land inside the sampled rectangle") {
+        for (int i = 0; i < static_cast<int>(SpriteId::COUNT); ++i) {
+            SpriteId id = static_cast<SpriteId>(i);
+            Rectangle target = SpriteAtlas::getOverrideRect(id);
+            batch.add(id, Vector2{0.0f, 0.0f}, 10.0f);
+            Rectangle sampled = batch.getPendingQuad(batch.getPendingCount() - 1).source;
+            CHECK(target.x >= sampled.x);
+            CHECK(target.y >= sampled.y);
+            CHECK(target.x + target.width <= sampled.x + sampled.width);
+            CHECK(target.y + target.height <= sampled.y + sampled.height);
+        }
+    }
+    
+    SUBCASE("Small rings use the small ring bake") {
+        CHECK(SpriteAtlas::getRingSprite(8.0f) == SpriteId::RING_SMALL);
+        CHECK(SpriteAtlas::getRingSprite(24.0f) == SpriteId::RING);
+        
+        batch.addRing(Vector2{0.0f, 0.0f}, 8.0f, YELLOW);
+        batch.addRing(Vector2{0.0f, 0.0f}, 24.0f, YELLOW);
+        Rectangle small = SpriteAtlas::getSpriteRect(SpriteId::RING_SMALL);
+        Rectangle large = SpriteAtlas::getSpriteRect(SpriteId::RING);
+        CHECK(batch.getPendingQuad(0).source.x == small.x);
+        CHECK(batch.getPendingQuad(1).source.x == large.x);
+        CHECK(batch.getPendingQuad(1).source.y == large.y);
+    }
+    
+    SUBCASE("Flush submits and clears batch") {
+        for (int i = 0; i < 50; ++i) {
+            batch.addCircle(Vector2{i * 1.0f, 0.0f}, 4.0f, WHITE);
+        }
+        batch.flush(atlas);
+        
+        CHECK(batch.getLastFlushCount() == 50);
+        CHECK(batch.getPendingCount() == 0);
+    }
+}
+
+TEST_CASE("HUD Text Cache") {
+    TextCache cache;
+    
+    SUBCASE("Unchanged text is rasterized once") {
+        for (int frame = 0; frame < 10; ++frame) {
+            cache.beginFrame();
+            cache.draw("Score: 150", 10, 10, 18, GREEN);
+        }
+        CHECK(cache.getRasterizeCount() == 1);
+        CHECK(cache.getEntryCount() == 1);
+    }
+    
+    SUBCASE("Size is part of the key") {
+        cache.measure("Lives: 3", 18);
+        cache.measure("Lives: 3", 24);
+        cache.measure("Lives: 3", 18);
+        CHECK(cache.getRasterizeCount() == 2);
+    }
+    
+    SUBCASE("Least recently used entries are evicted") {
+        char buffer[32];
+        cache.beginFrame();
+        cache.measure("WEAPON", 12);
+        
+        for (int i = 0; i < TextCache::MAX_ENTRIES; ++i) {
+            cache.beginFrame();
+            std::snprintf(buffer, sizeof(buffer), "Time: %d", i);
+            cache.measure(buffer, 18);
+        }
+        CHECK(cache.getEntryCount() == TextCache::MAX_ENTRIES);
+        
+        int before = cache.getRasterizeCount();
+        cache.measure("WEAPON", 12);
+        CHECK(cache.getRasterizeCount() == before + 1);
+    }
+}
+
+TEST_CASE("Simulation Snapshots and Thread Handoff") {
+    SUBCASE("Fixed-step clock advances only on tick") {
+        GameClock::setFixedStep(0.5f, 10.0);
+        CHECK(GameClock::now() == doctest::Approx(10.0));
+        CHECK(GameClock::frameTime() == doctest::Approx(0.5f));
+        GameClock::advance();
+        CHECK(GameClock::now() == doctest::Approx(10.5));
+        GameClock::useRealTime();
+        CHECK(GameClock::isFixedStep() == false);
+    }
+    
+    SUBCASE("Terrain generation tracks changes") {
+        BlockGrid terrain;
+        unsigned int before = terrain.getGeneration();
+        
+        terrain.clearPassageAt(Coordinate(10, 10));
+        CHECK(terrain.getGeneration() == before + 1);
+        
+        terrain.clearPassageAt(Coordinate(10, 10));
+        CHECK(terrain.getGeneration() == before + 1);
+    }
+    
+    SUBCASE("Simulation steps headless and captures snapshot") {
+        GameClock::setFixedStep(1.0f / 60.0f, 100.0);
+        GameSimulation simulation;
+        RenderSnapshot snapshot;
+        
+        InputFrame start;
+        start.pressed = InputFrame::bit(InputButton::CONFIRM);
+        simulation.step(start);
+        for (int i = 0; i < 30; ++i) {
+            simulation.step(InputFrame());
+        }
+        simulation.captureSnapshot(snapshot);
+        GameClock::useRealTime();
+        
+        CHECK(simulation.getTick() == 31);
+        CHECK(snapshot.state == GameState::PLAYING);
+        CHECK(snapshot.tick == 31);
+        CHECK(snapshot.terrainValid == true);
+        CHECK(snapshot.enemyCount == static_cast<int>(simulation.getEnemies().size()));
+        CHECK(snapshot.player.position == simulation.getPlayer().getPosition());
+    }
+    
+    SUBCASE("Triple buffer delivers newest value") {
+        TripleBuffer<int> buffer;
+        CHECK(buffer.update() == false);
+        
+        buffer.getWriteSlot() = 1;
+        buffer.publish();
+        buffer.getWriteSlot() = 2;
+        buffer.publish();
+        
+        CHECK(buffer.update() == true);
+        CHECK(buffer.getReadSlot() == 2);
+        CHECK(buffer.update() == false);
+    }
+    
+    SUBCASE("SPSC queue is FIFO and bounded") {
+        SpscQueue<int, 4> queue;
+        CHECK(queue.push(1));
+        CHECK(queue.push(2));
+        CHECK(queue.push(3));
+        CHECK(queue.push(4) == false);
+        
+        int value = 0;
+        CHECK(queue.pop(value));
+        CHECK(value == 1);
+    }
+    
+    SUBCASE("Input latch keeps presses until consumed") {
+        InputLatch latch;
+        latch.record(0, InputFrame::bit(InputButton::FIRE));
+        latch.record(InputFrame::bit(InputButton::LEFT), 0);
+        
+        InputFrame frame = latch.consume();
+        CHECK(frame.wasPressed(InputButton::FIRE));
+        CHECK(frame.isHeld(InputButton::LEFT));
+        CHECK(latch.consume().pressed == 0);
+    }
+}
+
+namespace {
+    InputFrame scriptedInput(int step) {
+        InputFrame frame;
+        const InputButton moves[] = {InputButton::LEFT, InputButton::DOWN, 
+                                     InputButton::RIGHT, InputButton::UP};
+        frame.held = InputFrame::bit(moves[(step / 20) % 4]);
+        if (step % 25 == 0) {
+            frame.pressed = InputFrame::bit(InputButton::FIRE);
+        }
+        return frame;
+    }
+    
+    std::vector<int> recordTrace(GameSimulation& simulation, int steps) {
+        std::vector<int> trace;
+        for (int i = 0; i < steps; ++i) {
+            simulation.step(scriptedInput(i));
+            trace.push_back(simulation.getPlayer().getPosition().row);
+            trace.push_back(simulation.getPlayer().getPosition().col);
+            trace.push_back(simulation.getScore());
+            for (const auto& enemy : simulation.getEnemies()) {
+                trace.push_back(enemy.getPosition().row * 100 + enemy.getPosition().col);
+            }
+        }
+        return trace;
+    }
+}
+
+TEST_CASE("Game State Save and Restore") {
+    SUBCASE("Seeded random sequence is reproducible") {
+        GameRandom::seed(42);
+        int first = GameRandom::nextInt(1000);
+        std::uint64_t state = GameRandom::getState();
+        int second = GameRandom::nextInt(1000);
+        
+        GameRandom::seed(42);
+        CHECK(GameRandom::nextInt(1000) == first);
+        GameRandom::setState(state);
+        CHECK(GameRandom::nextInt(1000) == second);
+    }
+    
+    SUBCASE("Restored simulation replays identically") {
+        GameClock::setFixedStep(1.0f / 60.0f, 50.0);
+        GameRandom::seed(7);
+        GameSimulation simulation;
+        
+        InputFrame start;
+        start.pressed = InputFrame::bit(InputButton::CONFIRM);
+        simulation.step(start);
+        recordTrace(simulation, 40);
+        
+        std::vector<unsigned char> saved;
+        simulation.saveState(saved);
+        std::vector<int> original = recordTrace(simulation, 200);
+        
+        CHECK(simulation.restoreState(saved));
+        std::vector<int> replayed = recordTrace(simulation, 200);
+        GameClock::useRealTime();
+        
+        CHECK(saved.size() < 4096);
+        CHECK(replayed == original);
+    }
+    
+    SUBCASE("Bad or truncated data is rejected without side effects") {
+        GameClock::setFixedStep(1.0f / 60.0f, 50.0);
+        GameSimulation simulation;
+        InputFrame start;
+        start.pressed = InputFrame::bit(InputButton::CONFIRM);
+        simulation.step(start);
+        
+        std::vector<unsigned char> saved;
+        simulation.saveState(saved);
+        std::vector<unsigned char> truncated(saved.begin(), saved.begin() + saved.size() / 2);
+        std::vector<unsigned char> badMagic = saved;
+        badMagic[0] ^= 0xFF;
+        
+        unsigned int tickBefore = simulation.getTick();
+        CHECK(simulation.restoreState(truncated) == false);
+        CHECK(simulation.restoreState(badMagic) == false);
+        CHECK(simulation.getTick() == tickBefore);
+        CHECK(simulation.getState() == GameState::PLAYING);
+        GameClock::useRealTime();
+    }
+    
+    SUBCASE("Full-length snapshots with corrupt values are rejected") {
+        GameClock::setFixedStep(1.0f / 60.0f, 50.0);
+        GameSimulation simulation;
+        InputFrame start;
+        start.pressed = InputFrame::bit(InputButton::CONFIRM);
+        simulation.step(start);
+        REQUIRE_FALSE(simulation.getEnemies().empty());
+        
+        std::vector<unsigned char> saved;
+        simulation.saveState(saved);
+        
+        // Locate the first enemy's record: position, active flag, then type
+        std::vector<unsigned char> enemyBytes;
+        StateWriter enemyWriter(enemyBytes);
+        simulation.getEnemies().front().serialize(enemyWriter);
+        auto found = std::search(saved.begin(), saved.end(), enemyBytes.begin(), enemyBytes.end());
+        REQUIRE(found != saved.end());
+        std::size_t record = static_cast<std::size_t>(found - saved.begin());
+        std::size_t typeOffset = record + sizeof(Coordinate) + sizeof(bool);
+        
+        std::vector<unsigned char> badType = saved;
+        badType[typeOffset] = 0x7F;
+        std::vector<unsigned char> badFlag = saved;
+        badFlag[record + sizeof(Coordinate)] = 2;
+        std::vector<unsigned char> badPosition = saved;
+        badPosition[record + 1] = 0x40;   // Row far below the grid
+        
+        unsigned int tickBefore = simulation.getTick();
+        Coordinate enemyBefore = simulation.getEnemies().front().getPosition();
+        CHECK(simulation.restoreState(badType) == false);
+        CHECK(simulation.restoreState(badFlag) == false);
+        CHECK(simulation.restoreState(badPosition) == false);
+        CHECK(simulation.getTick() == tickBefore);
+        CHECK(simulation.getEnemies().front().getPosition() == enemyBefore);
+        CHECK(simulation.restoreState(saved));
+        GameClock::useRealTime();
+    }
+}
+
+TEST_CASE("Rollback and Resimulation") {
+    InputFrame start;
+    start.pressed = InputFrame::bit(InputButton::CONFIRM);
+    
+    SUBCASE("Rolling back restores the exact earlier state") {
+        GameClock::setFixedStep(1.0f / 60.0f, 20.0);
+        GameSimulation simulation;
+        simulation.step(start);
+        
+        RollbackBuffer history(16);
+        history.reset(simulation);
+        std::vector<unsigned char> checkpoint;
+        for (int i = 0; i < 12; ++i) {
+            if (i == 4) simulation.saveState(checkpoint);
+            history.advance(simulation, scriptedInput(i));
+        }
+        
+        CHECK(history.getDepth() == 12);
+        CHECK(history.getDeltaBytes() < history.getStateBytes() * 12 / 4);
+        CHECK(history.rollback(simulation, 8));
+        CHECK(history.getDepth() == 4);
+        
+        std::vector<unsigned char> restored;
+        simulation.saveState(restored);
+        GameClock::useRealTime();
+        CHECK(restored == checkpoint);
+        CHECK(history.rollback(simulation, 5) == false);
+    }
+    
+    SUBCASE("Correcting a past input matches a run with the right input") {
+        GameClock::setFixedStep(1.0f / 60.0f, 20.0);
+        GameRandom::seed(3);
+        GameSimulation simulation;
+        simulation.step(start);
+        std::vector<unsigned char> base;
+        simulation.saveState(base);
+        
+        InputFrame right;
+        right.held = InputFrame::bit(InputButton::RIGHT);
+        InputFrame down;
+        down.held = InputFrame::bit(InputButton::DOWN);
+        
+        RollbackBuffer history(16);
+        history.reset(simulation);
+        for (int i = 0; i < 10; ++i) history.advance(simulation, right);
+        unsigned int wrongTick = history.getOldestTick() + 3;
+        CHECK(history.correctInput(simulation, wrongTick, down) == 7);
+        std::vector<unsigned char> corrected;
+        simulation.saveState(corrected);
+        
+        CHECK(simulation.restoreState(base));
+        for (int i = 0; i < 10; ++i) simulation.step(i == 3 ? down : right);
+        std::vector<unsigned char> expected;
+        simulation.saveState(expected);
+        GameClock::useRealTime();
+        
+        CHECK(corrected == expected);
+        CHECK(history.correctInput(simulation, 99999, down) == 0);
+    }
+    
+    SUBCASE("Delayed peer converges after mispredictions") {
+        LoopbackSession session(4, 30.0);
+        session.step(start);
+        for (int i = 0; i < 150; ++i) {
+            session.step(scriptedInput(i));
+        }
+        session.flush();
+        GameClock::useRealTime();
+        
+        CHECK(session.getCorrections() > 0);
+        CHECK(session.isSynchronized());
+        CHECK(session.getRemote().getState() == GameState::PLAYING);
+    }
+}
+
+TEST_CASE("Procedural Level Generation") {
+    SUBCASE("Same seed gives the same valid layout") {
+        LevelLayout first = LevelGenerator::generate(5, 1234);
+        LevelLayout second = LevelGenerator::generate(5, 1234);
+        
+        CHECK(std::memcmp(first.blocked, second.blocked, sizeof(first.blocked)) == 0);
+        CHECK(first.enemySpawns == second.enemySpawns);
+        CHECK(first.rockSpawns == second.rockSpawns);
+        CHECK(first.enemySpawns.size() == 8);
+        CHECK(first.enemyTypes.size() == first.enemySpawns.size());
+        CHECK(first.rockSpawns.size() <= 6);
+        CHECK(first.isOpen(Coordinate(Coordinate::PLAYABLE_START_ROW, 1)));
+        
+        for (const auto& spawn : first.enemySpawns) {
+            CHECK(first.isOpen(spawn));
+        }
+        for (const auto& rock : first.rockSpawns) {
+            CHECK(first.blocked[rock.row + 1][rock.col]);
+        }
+    }
+    
+    SUBCASE("Best candidate does not depend on worker count") {
+        LevelEvaluator::Settings settings;
+        settings.candidates = 6;
+        settings.rollouts = 1;
+        settings.rolloutTicks = 300;
+        
+        GameRandom::seed(77);
+        std::uint64_t callerRandom = GameRandom::getState();
+        
+        settings.workers = 1;
+        LevelLayout serial = LevelEvaluator::selectBest(4, 99, settings);
+        settings.workers = 3;
+        LevelLayout parallel = LevelEvaluator::selectBest(4, 99, settings);
+        
+        CHECK(serial.seed == parallel.seed);
+        CHECK(serial.score == doctest::Approx(parallel.score));
+        CHECK(serial.score > 0.0f);
+        CHECK(GameRandom::getState() == callerRandom);
+    }
+    
+    SUBCASE("Simulation plays generated layouts") {
+        GameClock::setFixedStep(1.0f / 60.0f, 0.0);
+        LevelLayout layout = LevelGenerator::generate(3, 42);
+        GameSimulation simulation;
+        simulation.startTrial(3, layout);
+        
+        CHECK(simulation.getState() == GameState::PLAYING);
+        CHECK(simulation.getLevel() == 3);
+        CHECK(simulation.getEnemies().size() == layout.enemySpawns.size());
+        CHECK(simulation.getTerrain().isLocationBlocked(layout.enemySpawns[0]) == false);
+        
+        simulation.prepareLevelAhead(4);
+        for (int i = 0; i < 500 && !simulation.isLevelLayoutReady(4); ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        CHECK(simulation.isLevelLayoutReady(4));
+        CHECK(simulation.isLevelLayoutReady(1) == false);
+        GameClock::useRealTime();
+    }
+}
+
+TEST_CASE("Tunnel Connectivity Index") {
+    SUBCASE("Digging merges separate tunnels") {
+        LevelLayout layout;
+        for (int row = Coordinate::PLAYABLE_START_ROW; row < LevelLayout::ROWS; ++row) {
+            for (int col = 0; col < LevelLayout::COLS; ++col) {
+                layout.blocked[row][col] = true;
+            }
+        }
+        layout.blocked[10][5] = false;
+        layout.blocked[10][6] = false;
+        layout.blocked[10][9] = false;
+        
+        BlockGrid terrain;
+        terrain.applyLayout(layout);
+        CHECK(terrain.areConnected(Coordinate(10, 5), Coordinate(10, 6)));
+        CHECK(terrain.areConnected(Coordinate(10, 5), Coordinate(10, 9)) == false);
+        CHECK(terrain.getTunnelSize(Coordinate(10, 5)) == 2);
+        CHECK(terrain.getTunnelId(Coordinate(11, 5)) == -1);
+        
+        terrain.clearPassageAt(Coordinate(10, 7));
+        CHECK(terrain.areConnected(Coordinate(10, 5), Coordinate(10, 9)) == false);
+        terrain.clearPassageAt(Coordinate(10, 8));
+        CHECK(terrain.areConnected(Coordinate(10, 5), Coordinate(10, 9)));
+        CHECK(terrain.getTunnelSize(Coordinate(10, 9)) == 5);
+    }
+    
+    SUBCASE("Enemy follows a shared tunnel instead of phasing") {
+        BlockGrid terrain;
+        Coordinate enemyPos(Coordinate::PLAYABLE_START_ROW + 1, 1);
+        Coordinate playerPos(Coordinate::WORLD_ROWS - 1, 10);
+        REQUIRE(terrain.areConnected(enemyPos, playerPos));
+        
+        EnemyLogic logic;
+        CHECK(logic.shouldPhaseThrough(enemyPos, playerPos, terrain) == false);
+        std::vector<Coordinate> path = logic.findPathToPlayer(enemyPos, playerPos, terrain);
+        REQUIRE(path.empty() == false);
+        for (const auto& step : path) {
+            CHECK(terrain.isLocationBlocked(step) == false);
+        }
+        
+        Coordinate buried(12, 20);
+        CHECK(logic.shouldPhaseThrough(buried, playerPos, terrain));
+    }
+}
+
+TEST_CASE("Distance Field") {
+    SUBCASE("Incremental sources match brute-force nearest distance") {
+        std::vector<Coordinate> sources = {Coordinate(5, 5), Coordinate(12, 20), Coordinate(18, 2)};
+        DistanceField field;
+        CHECK(field.get(Coordinate(10, 10), DistanceMetric::MANHATTAN) == DistanceField::LARGE_DISTANCE);
+        for (const auto& source : sources) {
+            field.addSource(source);
+        }
+        
+        for (int row = 0; row < Coordinate::WORLD_ROWS; row += 3) {
+            for (int col = 0; col < Coordinate::WORLD_COLS; col += 4) {
+                Coordinate cell(row, col);
+                int manhattan = 1000, chebyshev = 1000, squared = 1000;
+                for (const auto& source : sources) {
+                    manhattan = std::min(manhattan, cell.manhattanDistance(source));
+                    chebyshev = std::min(chebyshev, cell.chebyshevDistance(source));
+                    squared = std::min(squared, cell.distanceSquared(source));
+                }
+                CHECK(field.get(cell, DistanceMetric::MANHATTAN) == manhattan);
+                CHECK(field.get(cell, DistanceMetric::CHEBYSHEV) == chebyshev);
+                CHECK(field.get(cell, DistanceMetric::EUCLIDEAN_SQUARED) == squared);
+            }
+        }
+    }
+    
+    SUBCASE("Candidate lists only hold cells outside the radius") {
+        DistanceField field;
+        field.addSource(Coordinate(10, 10));
+        std::vector<Coordinate> cells;
+        field.collectCellsBeyond(DistanceMetric::EUCLIDEAN_SQUARED, 16,
+                                 Coordinate(5, 5), Coordinate(15, 15), cells);
+        CHECK(cells.empty() == false);
+        for (const auto& cell : cells) {
+            CHECK(cell.distanceSquared(Coordinate(10, 10)) > 16);
+        }
+        
+        field.addSource(Coordinate(5, 5));
+        size_t before = cells.size();
+        field.discardCellsWithin(cells, DistanceMetric::EUCLIDEAN_SQUARED, 16);
+        CHECK(cells.size() < before);
+        for (const auto& cell : cells) {
+            CHECK(cell.distanceSquared(Coordinate(5, 5)) > 16);
+        }
+    }
+}
+
+// Compile-time checks: these fail the build rather than a test run
+static_assert(Coordinate(4, 7).manhattanDistance(Coordinate(1, 3)) == 7, "manhattan is constexpr");
+static_assert(Coordinate(4, 7).chebyshevDistance(Coordinate(1, 3)) == 4, "chebyshev is constexpr");
+static_assert(Coordinate(4, 7).distanceSquared(Coordinate(1, 3)) == 25, "squared distance is constexpr");
+static_assert(Coordinate(0, 0).isWithinRange(Coordinate(3, 4), 5) &&
+              !Coordinate(0, 0).isWithinRange(Coordinate(3, 4), 4), "range check without sqrt");
+static_assert(Coordinate(-5, 40).clampToBounds() == Coordinate(Coordinate::PLAYABLE_START_ROW, Coordinate::WORLD_COLS - 1),
+              "clamp is constexpr");
+static_assert(Coordinate::fromIndex(Coordinate(7, 13).toIndex()) == Coordinate(7, 13), "index round trip");
+
+TEST_CASE("Constexpr Coordinate and Direction Math") {
+    SUBCASE("Direction offsets step one cell and opposites undo them") {
+        for (Direction direction : DirectionTable::CARDINALS) {
+            Coordinate start(10, 10);
+            Coordinate moved = start + directionOffset(direction);
+            CHECK(moved.manhattanDistance(start) == 1);
+            CHECK(moved + directionOffset(oppositeDirection(direction)) == start);
+        }
+        CHECK(directionOffset(Direction::NONE) == Coordinate(0, 0));
+    }
+
+    SUBCASE("Packed form is unique and survives out-of-world values") {
+        std::vector<std::uint32_t> keys;
+        for (int row = -1; row <= Coordinate::WORLD_ROWS; ++row) {
+            for (int col = -1; col <= Coordinate::WORLD_COLS; ++col) {
+                Coordinate cell(row, col);
+                CHECK(Coordinate::unpack(cell.pack()) == cell);
+                keys.push_back(cell.pack());
+            }
+        }
+        std::sort(keys.begin(), keys.end());
+        CHECK(std::adjacent_find(keys.begin(), keys.end()) == keys.end());
+    }
+
+    SUBCASE("Bounds and squared range agree with the sqrt-based versions") {
+        for (int row = -2; row < Coordinate::WORLD_ROWS + 2; ++row) {
+            for (int col = -2; col < Coordinate::WORLD_COLS + 2; ++col) {
+                Coordinate cell(row, col);
+                bool expected = row >= Coordinate::PLAYABLE_START_ROW && row < Coordinate::WORLD_ROWS &&
+                                col >= 0 && col < Coordinate::WORLD_COLS;
+                CHECK(cell.isWithinBounds() == expected);
+                CHECK(cell.isWithinRange(Coordinate(10, 15), 6) ==
+                      (cell.calculateDistance(Coordinate(10, 15)) <= 6.0f));
+            }
+        }
+    }
+}
+
+TEST_CASE("Harpoon Ray Representation") {
+    GameClock::setFixedStep(0.25f, 0.0);
+
+    SUBCASE("covers() matches the cell list for every state") {
+        Player player(Coordinate(10, 10));
+        BlockGrid terrain;
+        for (Direction direction : DirectionTable::CARDINALS) {
+            Harpoon harpoon(player.getPosition(), direction, &player);
+            for (int tick = 0; tick < 12 && harpoon.isActive(); ++tick) {
+                harpoon.update();
+                std::vector<Coordinate> cells = harpoon.getSegments();
+                REQUIRE(static_cast<int>(cells.size()) == harpoon.getSegmentCount());
+                CHECK(cells.front() == player.getPosition());
+                for (int row = 0; row < Coordinate::WORLD_ROWS; ++row) {
+                    for (int col = 0; col < Coordinate::WORLD_COLS; ++col) {
+                        Coordinate cell(row, col);
+                        bool listed = std::find(cells.begin(), cells.end(), cell) != cells.end();
+                        CHECK(harpoon.covers(cell) == listed);
+                    }
+                }
+            }
+        }
+    }
+
+    SUBCASE("Player movement shifts the harpoon and clips it at the edge") {
+        Player player(Coordinate(10, 27));
+        Harpoon harpoon(player.getPosition(), Direction::RIGHT, &player);
+        harpoon.update();
+        REQUIRE(harpoon.getSegmentCount() == 2);
+        CHECK(harpoon.getSegment(1) == Coordinate(10, 28));
+
+        player.setPosition(Coordinate(10, 29));
+        harpoon.updatePlayerConnection();
+        CHECK(harpoon.getSegmentCount() == 1);
+        CHECK(harpoon.getState() == HarpoonState::RETRACTING);
+        CHECK(harpoon.covers(Coordinate(10, 29)));
+    }
+
+    SUBCASE("Occupancy collision matches brute force over many harpoons") {
+        GameRandom::seed(99);
+        std::vector<Enemy> enemies;
+        for (int i = 0; i < 40; ++i) {
+            enemies.emplace_back(Coordinate(Coordinate::PLAYABLE_START_ROW + GameRandom::nextInt(Coordinate::PLAYABLE_ROWS),
+                                            GameRandom::nextInt(Coordinate::WORLD_COLS)));
+        }
+        enemies[3].destroy();
+
+        std::vector<Player> players;
+        for (int i = 0; i < 12; ++i) {
+            players.emplace_back(Coordinate(Coordinate::PLAYABLE_START_ROW + GameRandom::nextInt(Coordinate::PLAYABLE_ROWS),
+                                            GameRandom::nextInt(Coordinate::WORLD_COLS)));
+        }
+        std::vector<Harpoon> harpoons;
+        for (int i = 0; i < 12; ++i) {
+            harpoons.emplace_back(players[i].getPosition(), DirectionTable::CARDINALS[i % 4], &players[i]);
+            harpoons.back().update();
+            harpoons.back().update();
+        }
+
+        std::vector<bool> expected(enemies.size(), false);
+        for (const auto& harpoon : harpoons) {
+            if (!harpoon.isActive()) continue;
+            for (size_t e = 0; e < enemies.size(); ++e) {
+                if (!enemies[e].getIsDestroyed() && harpoon.covers(enemies[e].getPosition())) {
+                    expected[e] = true;
+                }
+            }
+        }
+
+        CollisionManager collisions;
+        int score = 0, defeated = 0;
+        collisions.checkHarpoonEnemyCollisions(harpoons, enemies, score, defeated, 1);
+
+        int expectedDefeated = 0;
+        for (size_t e = 0; e < enemies.size(); ++e) {
+            if (e == 3) continue;
+            CHECK(enemies[e].getIsDestroyed() == expected[e]);
+            if (expected[e]) expectedDefeated++;
+        }
+        CHECK(defeated == expectedDefeated);
+        CHECK(expectedDefeated > 0);
+    }
+
+    GameClock::useRealTime();
+}
+
+TEST_CASE("Projectile Pools and Inline Trails") {
+    SUBCASE("Pool fills to capacity and compacts in spawn order") {
+        ObjectPool<FireProjectile, 4> pool;
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(pool.emplace(Coordinate(5, i), Direction::RIGHT) != nullptr);
+        }
+        CHECK(pool.full());
+        CHECK(pool.emplace(Coordinate(5, 9), Direction::RIGHT) == nullptr);
+
+        pool[1].setActive(false);
+        CHECK(pool.removeIf([](const FireProjectile& f) { return !f.isActive(); }) == 1);
+        REQUIRE(pool.size() == 3);
+        CHECK(pool[0].getPosition() == Coordinate(5, 0));
+        CHECK(pool[1].getPosition() == Coordinate(5, 2));
+        CHECK(pool[2].getPosition() == Coordinate(5, 3));
+
+        ObjectPool<FireProjectile, 4> copy = pool;
+        pool.clear();
+        CHECK(copy.size() == 3);
+        CHECK(copy[2].getPosition() == Coordinate(5, 3));
+        CHECK(pool.emplace(Coordinate(6, 0), Direction::LEFT) != nullptr);
+    }
+
+    SUBCASE("Ring keeps only the newest values, oldest first") {
+        FixedRing<int, 3> ring;
+        for (int i = 1; i <= 5; ++i) ring.push(i);
+        REQUIRE(ring.size() == 3);
+        CHECK(ring[0] == 3);
+        CHECK(ring[1] == 4);
+        CHECK(ring.back() == 5);
+    }
+
+    SUBCASE("Fire trail holds the last five cells and survives save/restore") {
+        GameClock::setFixedStep(0.34f, 0.0);
+        FireProjectile fire(Coordinate(10, 2), Direction::RIGHT);
+        for (int i = 0; i < 5; ++i) fire.update();
+        GameClock::useRealTime();
+
+        const auto& trail = fire.getTrail();
+        REQUIRE(trail.size() == FireProjectile::TRAIL_LENGTH);
+        CHECK(trail.back() == fire.getPosition());
+        CHECK(trail[0] == Coordinate(10, 3));
+
+        std::vector<unsigned char> bytes;
+        StateWriter writer(bytes);
+        fire.serialize(writer);
+        FireProjectile restored(Coordinate(), Direction::NONE);
+        StateReader reader(bytes);
+        restored.deserialize(reader);
+        REQUIRE(reader.isValid());
+        REQUIRE(restored.getTrail().size() == trail.size());
+        for (std::size_t i = 0; i < trail.size(); ++i) {
+            CHECK(restored.getTrail()[i] == trail[i]);
+        }
+    }
+}
+
+TEST_CASE("Projectile Kinematics") {
+    const float dt = 1.0f / 60.0f;
+
+    SUBCASE("Motion does not depend on how many projectiles are alive") {
+        std::vector<FireProjectile> alone = {FireProjectile(Coordinate(10, 2), Direction::RIGHT)};
+        std::vector<FireProjectile> crowd;
+        crowd.emplace_back(Coordinate(10, 2), Direction::RIGHT);
+        for (int i = 0; i < 24; ++i) {
+            crowd.emplace_back(Coordinate(4 + i % 12, 15), i % 2 ? Direction::UP : Direction::DOWN);
+        }
+
+        for (int t = 0; t < 90; ++t) {
+            ProjectileSystem::step(alone, dt);
+            ProjectileSystem::step(crowd, dt);
+            REQUIRE(alone[0].getPosition() == crowd[0].getPosition());
+            CHECK(alone[0].getMoveProgress() == doctest::Approx(crowd[0].getMoveProgress()));
+        }
+        CHECK(alone[0].getPosition().col > 2);
+    }
+
+    SUBCASE("Sub-cell progress rises between steps and the exact position is continuous") {
+        FireProjectile fire(Coordinate(10, 2), Direction::RIGHT);
+        float lastRow = 0.0f, lastCol = 0.0f;
+        ProjectileSystem::exactPosition(fire, lastRow, lastCol);
+        for (int t = 0; t < 60; ++t) {
+            fire.advance(dt);
+            float row = 0.0f, col = 0.0f;
+            ProjectileSystem::exactPosition(fire, row, col);
+            CHECK(row == doctest::Approx(10.0f));
+            CHECK(col > lastCol);
+            CHECK(col - lastCol < 0.1f);
+            CHECK(fire.getMoveProgress() < 1.0f);
+            lastCol = col;
+        }
+    }
+
+    SUBCASE("A long step keeps the remainder instead of dropping it") {
+        FireProjectile fire(Coordinate(10, 2), Direction::RIGHT);
+        fire.advance(0.7f);
+        CHECK(fire.getPosition() == Coordinate(10, 4));
+        CHECK(fire.getMoveProgress() == doctest::Approx(0.1f).epsilon(0.01));
+        CHECK(fire.getTrail().size() == 3);
+    }
+}
+
+TEST_CASE("Enemy Archetype Table") {
+    SUBCASE("Shipped config matches the built-in defaults") {
+        std::ifstream file(EnemyArchetypes::DEFAULT_PATH);
+        REQUIRE(file.is_open());
+        EnemyArchetypes::Table table;
+        std::string error;
+        REQUIRE(EnemyArchetypes::parse(file, table, error));
+        for (int i = 0; i < EnemyArchetypes::TYPE_COUNT; ++i) {
+            const EnemyArchetype& a = table.rows[i];
+            const EnemyArchetype& b = EnemyArchetypes::defaults().rows[i];
+            CHECK(a.moveCooldown == doctest::Approx(b.moveCooldown));
+            CHECK(a.health == b.health);
+            CHECK(a.baseScore == b.baseScore);
+            CHECK(a.fireRange == b.fireRange);
+            CHECK(a.spawnWeight == b.spawnWeight);
+            CHECK(a.minLevel == b.minLevel);
+            CHECK(a.aggressive == b.aggressive);
+            CHECK(a.breathesFire == b.breathesFire);
+        }
+    }
+
+    SUBCASE("Invalid tables are rejected with a reason") {
+        EnemyArchetypes::Table table;
+        std::string error;
+        std::istringstream missing("RED_MONSTER 0.4 1 100 0 0 0 0 40 1\n");
+        CHECK_FALSE(EnemyArchetypes::parse(missing, table, error));
+        CHECK(error.find("missing") != std::string::npos);
+
+        error.clear();
+        std::istringstream badHealth(
+            "RED_MONSTER 0.4 0 100 0 0 0 0 40 1\nAGGRESSIVE_MONSTER 0.25 2 200 1 0 0 0 30 1\n"
+            "FAST_MONSTER 0.15 1 150 0 0 0 0 10 4\nGREEN_DRAGON 0.35 2 100 0 1 2.5 8 30 1\n");
+        CHECK_FALSE(EnemyArchetypes::parse(badHealth, table, error));
+        CHECK(error.find("line 1") != std::string::npos);
+    }
+
+    SUBCASE("Installed tables drive spawns, stats and score; edits hot-reload") {
+        std::string path = "test_enemies.cfg";
+        auto writeConfig = [&](int redHealth, int redScore) {
+            std::ofstream out(path);
+            out << "# test\n"
+                << "RED_MONSTER 0.40 " << redHealth << " " << redScore << " 0 0 0.0 0 40 1\n"
+                << "AGGRESSIVE_MONSTER 0.25 2 200 1 0 0.0 0 30 1\n"
+                << "FAST_MONSTER 0.15 1 150 0 0 0.0 0 100 1\n"
+                << "GREEN_DRAGON 0.35 2 100 0 1 2.5 8 30 1\n";
+        };
+        writeConfig(3, 500);
+        REQUIRE(EnemyArchetypes::load(path));
+
+        Enemy red(Coordinate(10, 10), EnemyType::RED_MONSTER);
+        CHECK(red.getHealth() == 3);
+        CHECK(EnemyArchetypes::get(EnemyType::RED_MONSTER).baseScore == 500);
+
+        GameRandom::seed(5);
+        bool sawFast = false;
+        for (int i = 0; i < 50; ++i) {
+            sawFast = sawFast || EnemyArchetypes::pickSpawnType(1) == EnemyType::FAST_MONSTER;
+        }
+        CHECK(sawFast);
+
+        CHECK_FALSE(EnemyArchetypes::reloadIfChanged());
+        writeConfig(4, 700);
+        auto stamp = std::filesystem::last_write_time(path);
+        std::filesystem::last_write_time(path, stamp + std::chrono::seconds(2));
+        CHECK(EnemyArchetypes::reloadIfChanged());
+        CHECK(EnemyArchetypes::get(EnemyType::RED_MONSTER).baseScore == 700);
+
+        // A broken edit keeps the last good table
+        { std::ofstream out(path); out << "RED_MONSTER nonsense\n"; }
+        std::filesystem::last_write_time(path, stamp + std::chrono::seconds(4));
+        CHECK_FALSE(EnemyArchetypes::reloadIfChanged());
+        CHECK(EnemyArchetypes::get(EnemyType::RED_MONSTER).baseScore == 700);
+
+        EnemyArchetypes::resetToDefaults();
+        std::filesystem::remove(path);
+        CHECK(EnemyArchetypes::get(EnemyType::RED_MONSTER).baseScore == 100);
+    }
+
+    SUBCASE("FAST_MONSTER only joins random spawns from its min level") {
+        GameRandom::seed(11);
+        for (int i = 0; i < 200; ++i) {
+            CHECK(EnemyArchetypes::pickSpawnType(1) != EnemyType::FAST_MONSTER);
+        }
+        bool sawFast = false;
+        for (int i = 0; i < 200; ++i) {
+            sawFast = sawFast || EnemyArchetypes::pickSpawnType(4) == EnemyType::FAST_MONSTER;
+        }
+        CHECK(sawFast);
+    }
+}
+
+TEST_CASE("Hot Reload of Maps and Tuning") {
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / "digdug_hot_reload";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir / "config");
+    std::filesystem::create_directories(dir / "maps");
+
+    SUBCASE("Tuning file is validated before it goes live") {
+        std::ifstream shipped(GameTuning::DEFAULT_PATH);
+        REQUIRE(shipped.is_open());
+        TuningValues values;
+        std::string error;
+        CHECK(GameTuning::parse(shipped, values, error));
+        CHECK(values.harpoonCooldown == doctest::Approx(TuningValues().harpoonCooldown));
+
+        std::istringstream unknown("harpoon_cooldwn = 0.5\n");
+        CHECK_FALSE(GameTuning::parse(unknown, values, error));
+        CHECK(error.find("line 1") != std::string::npos);
+        std::istringstream outOfRange("# comment\nharpoon_range = 40\n");
+        CHECK_FALSE(GameTuning::parse(outOfRange, values, error));
+        CHECK(error.find("line 2") != std::string::npos);
+    }
+
+    SUBCASE("Map validation accepts shipped maps and rejects broken ones") {
+        std::string error;
+        CHECK(BlockGrid::validateMapFile("resources/maps/level1.txt", error));
+        CHECK(BlockGrid::validateMapFile("resources/maps/level2.txt", error));
+        CHECK_FALSE(BlockGrid::validateMapFile((dir / "missing.txt").string(), error));
+
+        std::string row(Coordinate::WORLD_COLS, '1');
+        { std::ofstream out(dir / "no_player.txt"); out << row << "\n" << row << "\n"; }
+        CHECK_FALSE(BlockGrid::validateMapFile((dir / "no_player.txt").string(), error));
+        { std::ofstream out(dir / "short.txt"); out << "P" << row.substr(0, 10) << "\n"; }
+        CHECK_FALSE(BlockGrid::validateMapFile((dir / "short.txt").string(), error));
+        { std::ofstream out(dir / "bad_char.txt"); out << "P" << row.substr(1, 5) << "x" << row << "\n"; }
+        CHECK_FALSE(BlockGrid::validateMapFile((dir / "bad_char.txt").string(), error));
+    }
+
+    SUBCASE("Watcher reports each written file once") {
+        FileWatcher watcher;
+        watcher.watchDirectory((dir / "config").string());
+        CHECK(watcher.poll().empty());
+        { std::ofstream out(dir / "config" / "tuning.cfg"); out << "harpoon_speed = 5\n"; }
+        std::vector<std::string> changed = watcher.poll();
+        REQUIRE(changed.size() == 1);
+        CHECK(changed[0].find("tuning.cfg") != std::string::npos);
+        CHECK(watcher.poll().empty());
+    }
+
+    SUBCASE("Service applies tuning and restarts the level being played") {
+        GameClock::setFixedStep(1.0f / 60.0f, 100.0);
+        GameSimulation simulation(false);
+        HotReloadService service(dir.string());
+        InputFrame start;
+        start.pressed = InputFrame::bit(InputButton::CONFIRM);
+        simulation.step(start);
+        InputFrame right;
+        right.held = InputFrame::bit(InputButton::RIGHT);
+        for (int i = 0; i < 30; ++i) {
+            simulation.step(right);
+        }
+        Coordinate spawn(Coordinate::PLAYABLE_START_ROW, 1);
+        CHECK(simulation.getPlayer().getPosition() != spawn);
+
+        { std::ofstream out(dir / "config" / "tuning.cfg"); out << "harpoon_cooldown = 0.5\n"; }
+        std::filesystem::copy_file("resources/maps/level1.txt", dir / "maps" / "level1.txt");
+        CHECK(service.applyPending(simulation) == 2);
+        CHECK(GameTuning::get().harpoonCooldown == doctest::Approx(0.5f));
+        CHECK(simulation.getPlayer().getPosition() == spawn);
+        CHECK(simulation.getState() == GameState::PLAYING);
+
+        // A broken edit is reported and changes nothing
+        { std::ofstream out(dir / "maps" / "level2.txt"); out << "garbage\n"; }
+        { std::ofstream out(dir / "config" / "enemies.cfg"); out << "RED_MONSTER nonsense\n"; }
+        CHECK(service.applyPending(simulation) == 0);
+        CHECK_FALSE(service.getLastError().empty());
+        CHECK(EnemyArchetypes::get(EnemyType::RED_MONSTER).baseScore == 100);
+        GameClock::useRealTime();
+    }
+
+    GameTuning::resetToDefaults();
+    EnemyArchetypes::resetToDefaults();
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Scrolling Camera and View Culling") {
+    const int cell = 40;
+
+    SUBCASE("World the size of the screen never scrolls") {
+        GameCamera camera(1200, 800, Coordinate::WORLD_COLS * cell, Coordinate::WORLD_ROWS * cell);
+        camera.snapTo(Vector2{1100.0f, 700.0f});
+        CHECK(camera.getViewRect().x == doctest::Approx(0.0f));
+        CHECK(camera.getViewRect().y == doctest::Approx(0.0f));
+        CHECK(camera.visibleCells(cell, Coordinate::WORLD_ROWS, Coordinate::WORLD_COLS).cellCount() ==
+              Coordinate::WORLD_ROWS * Coordinate::WORLD_COLS);
+    }
+
+    SUBCASE("Large world: view follows, clamps and culls") {
+        const int rows = 200, cols = 300;
+        GameCamera camera(1200, 800, cols * cell, rows * cell);
+        camera.snapTo(Vector2{6000.0f, 4000.0f});
+        Rectangle view = camera.getViewRect();
+        CHECK(view.x == doctest::Approx(5400.0f));
+        CHECK(view.y == doctest::Approx(3600.0f));
+
+        // Terrain work is bounded by the screen, not the 60000-cell world
+        CHECK(camera.visibleCells(cell, rows, cols).cellCount() <= 31 * 21);
+        CHECK(camera.isVisible(Vector2{6000.0f, 4000.0f}, 20.0f));
+        CHECK_FALSE(camera.isVisible(Vector2{100.0f, 100.0f}, 20.0f));
+        CHECK(camera.isVisible(Vector2{5390.0f, 3700.0f}, 20.0f));
+
+        camera.snapTo(Vector2{0.0f, 0.0f});
+        CHECK(camera.getViewRect().x == doctest::Approx(0.0f));
+        camera.snapTo(Vector2{1.0e6f, 1.0e6f});
+        CHECK(camera.getViewRect().x == doctest::Approx(cols * cell - 1200.0f));
+        CHECK(camera.visibleCells(cell, rows, cols).endCol == cols);
+
+        // Easing moves part way toward the goal, never past it
+        camera.snapTo(Vector2{6000.0f, 4000.0f});
+        camera.follow(Vector2{7000.0f, 4000.0f}, 1.0f / 60.0f);
+        CHECK(camera.getViewRect().x > 5400.0f);
+        CHECK(camera.getViewRect().x < 6400.0f);
+        for (int i = 0; i < 600; ++i) {
+            camera.follow(Vector2{7000.0f, 4000.0f}, 1.0f / 60.0f);
+        }
+        CHECK(camera.getViewRect().x == doctest::Approx(6400.0f));
+    }
+}
+
+TEST_CASE("Batch Environment") {
+    using namespace ObservationLayout;
+    GameLog::setQuiet(true);
+    std::uint64_t callerRandom = GameRandom::getState();
+
+    SUBCASE("Reset fills one contiguous observation per world") {
+        BatchEnvironment::Settings settings;
+        settings.worlds = 4;
+        settings.workers = 2;
+        BatchEnvironment env(settings);
+        std::vector<std::uint64_t> seeds = {1, 2, 3, 4};
+        env.reset(seeds);
+
+        CHECK(env.observations().size() == static_cast<size_t>(4 * WORLD_SIZE));
+        for (int w = 0; w < env.size(); ++w) {
+            std::span<const float> obs = env.observation(w);
+            CHECK(env.dones()[w] == 0);
+            CHECK(obs[SCALAR_OFFSET + PLAYING] == 1.0f);
+            CHECK(obs[SCALAR_OFFSET + LEVEL] == 1.0f);
+            Coordinate spawn(Coordinate::PLAYABLE_START_ROW, 1);
+            CHECK(obs[PLAYER * PLANE_SIZE + spawn.toIndex()] == 1.0f);
+            float enemies = 0.0f;
+            for (int i = 0; i < PLANE_SIZE; ++i) {
+                enemies += obs[MONSTER * PLANE_SIZE + i] + obs[DRAGON * PLANE_SIZE + i];
+            }
+            CHECK(enemies >= 2.0f);
+        }
+        CHECK(GameRandom::getState() == callerRandom);
+    }
+
+    SUBCASE("Same seeds and actions give the same worlds for any worker count") {
+        auto run = [](int workers) {
+            BatchEnvironment::Settings settings;
+            settings.worlds = 3;
+            settings.workers = workers;
+            BatchEnvironment env(settings);
+            std::vector<std::uint64_t> seeds = {7, 7, 9};
+            env.reset(seeds);
+            std::vector<int> actions(3);
+            for (int t = 0; t < 240; ++t) {
+                for (int w = 0; w < 3; ++w) {
+                    actions[w] = (t / 20 + (w == 2 ? 3 : 0)) % BatchEnvironment::ACTION_COUNT;
+                }
+                env.step(actions);
+            }
+            return std::vector<float>(env.observations().begin(), env.observations().end());
+        };
+        std::vector<float> serial = run(1);
+        std::vector<float> parallel = run(3);
+        CHECK(serial == parallel);
+        CHECK(std::equal(serial.begin(), serial.begin() + WORLD_SIZE, 
+                         serial.begin() + WORLD_SIZE));
+    }
+
+    SUBCASE("Moving digs and shows up in the observation") {
+        BatchEnvironment::Settings settings;
+        settings.worlds = 1;
+        BatchEnvironment env(settings);
+        std::vector<std::uint64_t> seeds = {5};
+        env.reset(seeds);
+        std::vector<int> actions = {BatchEnvironment::DOWN};
+        for (int t = 0; t < 30; ++t) {
+            env.step(actions);
+        }
+        Coordinate position = env.simulation(0).getPlayer().getPosition();
+        CHECK(position.row > Coordinate::PLAYABLE_START_ROW);
+        CHECK(env.observation(0)[PLAYER * PLANE_SIZE + position.toIndex()] == 1.0f);
+        CHECK(env.observation(0)[EARTH * PLANE_SIZE + position.toIndex()] == 0.0f);
+
+        env.resetWorld(0, 5);
+        CHECK(env.simulation(0).getPlayer().getPosition() == 
+              Coordinate(Coordinate::PLAYABLE_START_ROW, 1));
+    }
+
+    SUBCASE("Warmed-up steps make no heap allocations") {
+        BatchEnvironment::Settings settings;
+        settings.worlds = 4;
+        settings.workers = 2;
+        BatchEnvironment env(settings);
+        std::vector<std::uint64_t> seeds = {1, 2, 3, 4};
+        env.reset(seeds);
+        std::vector<int> actions(4);
+        auto play = [&](int from, int ticks) {
+            for (int t = from; t < from + ticks; ++t) {
+                for (int w = 0; w < 4; ++w) {
+                    actions[w] = (t / 15 + w) % BatchEnvironment::ACTION_COUNT;
+                }
+                env.step(actions);
+            }
+        };
+        play(0, 300);
+
+        std::uint64_t before = MemoryTracker::total().allocations;
+        play(300, 600);
+        CHECK(MemoryTracker::total().allocations - before == 0);
+    }
+    GameLog::setQuiet(false);
+}
+
+TEST_CASE("Dragon Fire Lookahead") {
+    const float tick = 1.0f / 60.0f;
+    BlockGrid terrain;
+    REQUIRE(terrain.isLocationBlocked(Coordinate(10, 7)));
+    terrain.clearArea(Coordinate(10, 2), Coordinate(10, 6));
+    Coordinate dragon(10, 2);
+
+    SUBCASE("Local view copies the window and blocks what it cannot see") {
+        LocalWorldView view = LocalWorldView::capture(terrain, dragon, Coordinate(10, 5), 
+                                                      Direction::NONE, 0.12f);
+        CHECK_FALSE(view.isBlocked(Coordinate(10, 4)));
+        CHECK(view.isBlocked(Coordinate(10, 7)));
+        CHECK(view.isBlocked(Coordinate(10, 2 + LocalWorldView::RADIUS + 1)));
+        CHECK(view.isBlocked(Coordinate(10, -1)));
+        LocalWorldView copy = view;
+        CHECK_FALSE(copy.isBlocked(Coordinate(10, 3)));
+    }
+
+    SUBCASE("Fires down an open tunnel, holds fire through earth") {
+        FireLookahead search;
+        LocalWorldView open = LocalWorldView::capture(terrain, dragon, Coordinate(10, 6), 
+                                                      Direction::NONE, 0.12f);
+        CHECK(search.chooseDirection(open, dragon, tick) == Direction::RIGHT);
+
+        // Player in range but behind earth: the old range check fired here
+        LocalWorldView walled = LocalWorldView::capture(terrain, dragon, Coordinate(10, 8), 
+                                                        Direction::NONE, 0.12f);
+        CHECK(search.chooseDirection(walled, dragon, tick) == Direction::NONE);
+        LocalWorldView offAxis = LocalWorldView::capture(terrain, dragon, Coordinate(12, 5), 
+                                                         Direction::NONE, 0.12f);
+        CHECK(search.chooseDirection(offAxis, dragon, tick) == Direction::NONE);
+    }
+
+    SUBCASE("Predicts a player walking into the line of fire") {
+        terrain.clearArea(Coordinate(8, 5), Coordinate(9, 5));
+        FireLookahead search;
+        LocalWorldView still = LocalWorldView::capture(terrain, dragon, Coordinate(8, 5), 
+                                                       Direction::NONE, 0.5f);
+        CHECK(search.chooseDirection(still, dragon, tick) == Direction::NONE);
+        // Reaches (10, 5) after 1 s, as the fireball does
+        LocalWorldView walking = LocalWorldView::capture(terrain, dragon, Coordinate(8, 5), 
+                                                         Direction::DOWN, 0.5f);
+        CHECK(search.chooseDirection(walking, dragon, tick) == Direction::RIGHT);
+        // Too quick: already past the tunnel when the fireball gets there
+        LocalWorldView hurrying = LocalWorldView::capture(terrain, dragon, Coordinate(8, 5), 
+                                                          Direction::DOWN, 0.12f);
+        CHECK(search.chooseDirection(hurrying, dragon, tick) == Direction::NONE);
+    }
+
+    SUBCASE("Budget caps work per tick and refills") {
+        FireLookahead search(10);
+        LocalWorldView open = LocalWorldView::capture(terrain, dragon, Coordinate(10, 6), 
+                                                      Direction::NONE, 0.12f);
+        CHECK_FALSE(search.predictsHit(open, dragon, Direction::RIGHT, tick));
+        CHECK(search.getStepsLeft() == 0);
+        search.beginTick();
+        CHECK(search.getStepsLeft() == 10);
+    }
+
+    SUBCASE("Live fireballs burn out on earth") {
+        std::vector<FireProjectile> fires = {FireProjectile(dragon, Direction::RIGHT)};
+        for (int i = 0; i < 120 && fires[0].isActive(); ++i) {
+            ProjectileSystem::step(fires, tick, terrain);
+        }
+        CHECK_FALSE(fires[0].isActive());
+        CHECK(fires[0].getPosition() == Coordinate(10, 6));
+    }
+}
+
+TEST_CASE("Enemy Cell Reservations") {
+    GameClock::setFixedStep(1.0f / 60.0f, 100.0);
+
+    SUBCASE("Claims are per cell and step, priority wins, ticks forget") {
+        ReservationTable table;
+        Coordinate cell(10, 5);
+        CHECK(table.claim(cell, 0, 1, 10));
+        CHECK(table.ownerAt(cell, 0) == 1);
+        CHECK(table.ownerAt(cell, 1) == ReservationTable::NO_OWNER);
+        CHECK(table.isFree(cell, 0, 1, 0));           // own claim
+        CHECK_FALSE(table.isFree(cell, 0, 2, 10));    // tie: first come wins
+        CHECK(table.claim(cell, 0, 2, 11));           // higher priority takes it
+        CHECK(table.ownerAt(cell, 0) == 2);
+        CHECK_FALSE(table.claim(Coordinate(-1, 5), 0, 1, 10));
+        CHECK(table.claimSpan(cell, 4, 10, 3, 10) == ReservationTable::HORIZON - 4);
+
+        table.beginTick();
+        CHECK(table.ownerAt(cell, 0) == ReservationTable::NO_OWNER);
+        CHECK(table.isFree(cell, 0, 7, 0));
+    }
+
+    SUBCASE("Enemy detours around a held cell, waits when boxed in") {
+        BlockGrid terrain;
+        terrain.clearArea(Coordinate(10, 2), Coordinate(10, 12));
+        ReservationTable table;
+        table.beginTick();
+        Coordinate start(10, 5);
+        Coordinate ahead(10, 6);
+        table.claimSpan(ahead, 0, 2, 1, ReservationTable::HOLD_PRIORITY);
+
+        Enemy enemy(start, EnemyType::RED_MONSTER);
+        EnemyMoveContext context(terrain);
+        context.reservations = &table;
+        context.agent = 0;
+        context.priority = 100;
+        CHECK(enemy.moveToward(Coordinate(10, 12), context));
+        CHECK(enemy.getPosition() != ahead);
+        CHECK(enemy.getPosition().manhattanDistance(start) == 1);
+        CHECK(table.ownerAt(enemy.getPosition(), 0) == 0);
+
+        Enemy boxed(start, EnemyType::RED_MONSTER);
+        table.beginTick();
+        for (Direction dir : DirectionTable::CARDINALS) {
+            table.claimSpan(start + directionOffset(dir), 0, 2, 1, ReservationTable::HOLD_PRIORITY);
+        }
+        CHECK_FALSE(boxed.moveToward(Coordinate(10, 12), context));
+        CHECK(boxed.getPosition() == start);
+        CHECK(boxed.getTimeUntilMove() == doctest::Approx(0.0f));
+    }
+
+    SUBCASE("Chasing enemies never share a cell") {
+        GameLog::setQuiet(true);
+        GameSimulation simulation;
+        InputFrame confirm;
+        confirm.pressed = InputFrame::bit(InputButton::CONFIRM);
+        simulation.step(confirm);
+        REQUIRE(simulation.getState() == GameState::PLAYING);
+
+        bool stacked = false;
+        for (int tick = 0; tick < 600 && !stacked; ++tick) {
+            simulation.step(InputFrame{});
+            const auto& enemies = simulation.getEnemies();
+            for (size_t a = 0; a < enemies.size(); ++a) {
+                for (size_t b = a + 1; b < enemies.size(); ++b) {
+                    if (enemies[a].isActive() && !enemies[a].getIsDestroyed() &&
+                        enemies[b].isActive() && !enemies[b].getIsDestroyed() &&
+                        enemies[a].getPosition() == enemies[b].getPosition()) {
+                        stacked = true;
+                    }
+                }
+            }
+        }
+        CHECK_FALSE(stacked);
+        GameLog::setQuiet(false);
+    }
+}
+
+TEST_CASE("AI Level of Detail Scheduling") {
+    GameClock::setFixedStep(1.0f / 60.0f, 100.0);
+    BlockGrid terrain;
+    terrain.clearArea(Coordinate(10, 2), Coordinate(10, 20));
+    Coordinate player(10, 2);
+
+    SUBCASE("Tiers follow tunnel distance, off-tunnel cells use Manhattan") {
+        AIScheduler scheduler;
+        std::vector<Enemy> none;
+        scheduler.beginTick(none, terrain, player);
+        CHECK(scheduler.pathDistance(Coordinate(10, 7)) == 5);
+        CHECK(scheduler.pathDistance(Coordinate(10, 20)) == 18);
+        CHECK(scheduler.pathDistance(Coordinate(14, 2)) == 4);
+        CHECK(scheduler.tierFor(scheduler.pathDistance(Coordinate(10, 7))) == AITier::NEAR);
+        CHECK(scheduler.tierFor(scheduler.pathDistance(Coordinate(10, 14))) == AITier::MID);
+        CHECK(scheduler.tierFor(scheduler.pathDistance(Coordinate(10, 20))) == AITier::FAR);
+        CHECK(scheduler.intervalFor(AITier::NEAR) == 1);
+    }
+
+    SUBCASE("Budget caps plans per tick and rotates round-robin") {
+        AIScheduler::Settings settings;
+        settings.budgetMicros = 30;
+        settings.planCostMicros = 10;
+        AIScheduler scheduler(settings);
+        std::vector<Enemy> enemies;
+        for (int col = 3; col < 13; ++col) {
+            enemies.emplace_back(Coordinate(10, col));
+        }
+
+        scheduler.beginTick(enemies, terrain, player);
+        CHECK(scheduler.getPlansGranted() == 3);
+        CHECK(scheduler.getPlansDeferred() == 7);
+        CHECK(scheduler.shouldReplan(0));
+        CHECK(scheduler.shouldReplan(2));
+        CHECK_FALSE(scheduler.shouldReplan(3));
+
+        scheduler.beginTick(enemies, terrain, player);
+        CHECK_FALSE(scheduler.shouldReplan(0));
+        CHECK(scheduler.shouldReplan(3));
+        CHECK(scheduler.shouldReplan(5));
+        CHECK_FALSE(scheduler.shouldReplan(6));
+    }
+
+    SUBCASE("Far enemies reuse their direction between plans") {
+        AIScheduler scheduler;
+        std::vector<Enemy> enemies;
+        enemies.emplace_back(Coordinate(10, 20));
+        EnemyMoveContext context(terrain);
+
+        scheduler.beginTick(enemies, terrain, player);
+        REQUIRE(scheduler.shouldReplan(0));
+        context.replan = true;
+        REQUIRE(enemies[0].moveToward(player, context));
+        CHECK(enemies[0].getLogic().getMovesSincePlan() == 0);
+
+        GameClock::setTime(GameClock::now() + 2.0);
+        scheduler.beginTick(enemies, terrain, player);
+        CHECK_FALSE(scheduler.shouldReplan(0));
+        Direction planned = enemies[0].getCurrentDirection();
+        context.replan = false;
+        enemies[0].moveToward(player, context);
+        CHECK(enemies[0].getCurrentDirection() == planned);
+        CHECK(enemies[0].getLogic().getMovesSincePlan() == 1);
+    }
+
+    SUBCASE("Huge crowds stay within the per-tick budget") {
+        AIScheduler scheduler;
+        std::vector<Enemy> crowd;
+        for (int i = 0; i < 2000; ++i) {
+            crowd.emplace_back(Coordinate(12 + i % 8, i % Coordinate::WORLD_COLS));
+        }
+        scheduler.beginTick(crowd, terrain, player);
+        const auto& settings = scheduler.getSettings();
+        CHECK(scheduler.getPlansGranted() == settings.budgetMicros / settings.planCostMicros);
+        CHECK(scheduler.getPlansGranted() + scheduler.getPlansDeferred() == 2000);
+    }
+}
+
+TEST_CASE("Hierarchical Pathfinding") {
+    BlockGrid terrain;
+    auto isWalkablePath = [&](Coordinate start, const std::vector<Coordinate>& path) {
+        Coordinate previous = start;
+        for (const auto& cell : path) {
+            if (terrain.isLocationBlocked(cell) || cell.manhattanDistance(previous) != 1) {
+                return false;
+            }
+            previous = cell;
+        }
+        return true;
+    };
+
+    SUBCASE("Terrain logs dug cells until the map is replaced") {
+        unsigned int since = terrain.getGeneration();
+        std::vector<Coordinate> changed;
+        CHECK(terrain.getChangesSince(since, changed));
+        CHECK(changed.empty());
+
+        terrain.clearPassageAt(Coordinate(7, 7));
+        terrain.clearPassageAt(Coordinate(7, 8));
+        terrain.clearPassageAt(Coordinate(7, 8));  // Already clear: not a change
+        REQUIRE(terrain.getChangesSince(since, changed));
+        REQUIRE(changed.size() == 2);
+        CHECK(changed[0] == Coordinate(7, 7));
+        CHECK(changed[1] == Coordinate(7, 8));
+
+        for (int col = 1; col < 28; ++col) {
+            for (int row = 4; row < 7; ++row) {
+                terrain.clearPassageAt(Coordinate(row, col));
+            }
+        }
+        CHECK_FALSE(terrain.getChangesSince(since, changed));  // Log overflowed
+
+        since = terrain.getGeneration();
+        terrain.initializeDefaultMap();
+        CHECK_FALSE(terrain.getChangesSince(since, changed));
+    }
+
+    SUBCASE("Routes follow tunnels and refine lazily") {
+        HierarchicalPathfinder router;
+        router.rebuild(terrain);
+        CHECK(router.getNodeCount() > 0);
+
+        std::vector<Coordinate> waypoints;
+        Coordinate start(3, 0);
+        Coordinate goal(19, 29);
+        REQUIRE(router.findPath(terrain, start, goal, waypoints));
+        CHECK(waypoints.back() == goal);
+        CHECK(waypoints.size() < 20);
+
+        std::vector<Coordinate> steps;
+        REQUIRE(router.findSteps(terrain, start, goal, 1000, steps));
+        CHECK(isWalkablePath(start, steps));
+        CHECK(steps.back() == goal);
+        CHECK(steps.size() <= static_cast<size_t>(start.manhattanDistance(goal) + 4));
+
+        REQUIRE(router.findSteps(terrain, start, goal, 8, steps));
+        CHECK(steps.size() == 8);
+        CHECK(isWalkablePath(start, steps));
+
+        CHECK_FALSE(router.findPath(terrain, Coordinate(11, 10), start, waypoints));
+        CHECK_FALSE(router.findPath(terrain, Coordinate(8, 8), start, waypoints));
+    }
+
+    SUBCASE("Digging repairs only the chunks it touches") {
+        HierarchicalPathfinder router;
+        CHECK(router.sync(terrain) == HierarchicalPathfinder::CHUNKS);
+        CHECK(router.sync(terrain) == 0);
+
+        REQUIRE(terrain.isLocationBlocked(Coordinate(7, 7)));
+        terrain.clearPassageAt(Coordinate(7, 7));  // Inside one chunk
+        CHECK(router.sync(terrain) == 1);
+        terrain.clearPassageAt(Coordinate(10, 12));  // Top edge of its chunk
+        CHECK(router.sync(terrain) == 2);
+
+        // Join the middle tunnels to the outer ones
+        std::vector<Coordinate> steps;
+        CHECK_FALSE(router.findSteps(terrain, Coordinate(11, 10), Coordinate(19, 0), 1000, steps));
+        terrain.clearArea(Coordinate(12, 10), Coordinate(18, 10));
+        CHECK(router.sync(terrain) < HierarchicalPathfinder::CHUNKS);
+        REQUIRE(router.findSteps(terrain, Coordinate(11, 10), Coordinate(19, 0), 1000, steps));
+        CHECK(isWalkablePath(Coordinate(11, 10), steps));
+        CHECK(steps.back() == Coordinate(19, 0));
+
+        terrain.initializeDefaultMap();
+        CHECK(router.sync(terrain) == HierarchicalPathfinder::CHUNKS);
+    }
+
+    SUBCASE("Incremental repair matches a fresh build") {
+        GameRandom::seed(46);
+        HierarchicalPathfinder incremental;
+        incremental.rebuild(terrain);
+        std::vector<Coordinate> repaired;
+        std::vector<Coordinate> fresh;
+        bool allMatch = true;
+        for (int dig = 0; dig < 60; ++dig) {
+            terrain.clearPassageAt(Coordinate(Coordinate::PLAYABLE_START_ROW + GameRandom::nextInt(17),
+                                              GameRandom::nextInt(Coordinate::WORLD_COLS)));
+            HierarchicalPathfinder rebuilt;
+            rebuilt.rebuild(terrain);
+            Coordinate from(19, 0);
+            Coordinate to(Coordinate::PLAYABLE_START_ROW + GameRandom::nextInt(17),
+                          GameRandom::nextInt(Coordinate::WORLD_COLS));
+            bool found = incremental.findPath(terrain, from, to, repaired);
+            allMatch = allMatch && found == rebuilt.findPath(terrain, from, to, fresh) &&
+                       repaired == fresh;
+        }
+        CHECK(allMatch);
+    }
+}
+
+TEST_CASE("Enemy Path Cache") {
+    BlockGrid terrain;
+    std::vector<Coordinate> path;
+    std::vector<Coordinate> corridor;
+    for (int col = 1; col <= 8; ++col) {
+        corridor.push_back(Coordinate(19, col));
+    }
+    Coordinate start(19, 0);
+    Coordinate goal(19, 12);
+
+    SUBCASE("Exact and suffix hits, misses elsewhere") {
+        PathCache cache;
+        CHECK_FALSE(cache.lookup(terrain, start, goal, path));
+        cache.store(terrain, start, goal, corridor);
+
+        REQUIRE(cache.lookup(terrain, start, goal, path));
+        CHECK(path == corridor);
+
+        // One step further along, player moved within the same region
+        REQUIRE(cache.lookup(terrain, Coordinate(19, 1), Coordinate(19, 13), path));
+        CHECK(path.size() == corridor.size() - 1);
+        CHECK(path.front() == Coordinate(19, 2));
+
+        CHECK_FALSE(cache.lookup(terrain, Coordinate(19, 1), Coordinate(3, 0), path));
+        CHECK(cache.getStats().hits == 1);
+        CHECK(cache.getStats().suffixHits == 1);
+        CHECK(cache.getStats().misses == 2);
+        CHECK(cache.getStats().hitRate() == doctest::Approx(0.5f));
+    }
+
+    SUBCASE("Only paths near dug cells are invalidated") {
+        PathCache cache;
+        cache.store(terrain, start, goal, corridor);
+        std::vector<Coordinate> column = {Coordinate(4, 0), Coordinate(5, 0)};
+        cache.store(terrain, Coordinate(3, 0), Coordinate(10, 0), column);
+
+        terrain.clearPassageAt(Coordinate(12, 20));  // Far from both
+        CHECK(cache.lookup(terrain, start, goal, path));
+        CHECK(cache.size() == 2);
+
+        terrain.clearPassageAt(Coordinate(18, 4));  // Next to the corridor
+        CHECK_FALSE(cache.lookup(terrain, start, goal, path));
+        CHECK(cache.lookup(terrain, Coordinate(3, 0), Coordinate(10, 0), path));
+        CHECK(cache.getStats().invalidations == 1);
+
+        terrain.initializeDefaultMap();
+        CHECK_FALSE(cache.lookup(terrain, Coordinate(3, 0), Coordinate(10, 0), path));
+        CHECK(cache.size() == 0);
+    }
+
+    SUBCASE("Least recently used entry is evicted") {
+        PathCache cache;
+        std::vector<Coordinate> step = {Coordinate(5, 0)};
+        Coordinate far(10, 29);
+        auto startOf = [](int i) { return Coordinate(19 - i / 30, i % 30); };
+        for (int i = 0; i < PathCache::CAPACITY; ++i) {
+            cache.store(terrain, startOf(i), far, step);
+        }
+        CHECK(cache.lookup(terrain, startOf(0), far, path));  // Refresh the oldest
+        cache.store(terrain, start, goal, corridor);
+        CHECK(cache.size() == PathCache::CAPACITY);
+        CHECK(cache.getStats().evictions == 1);
+        CHECK(cache.lookup(terrain, startOf(0), far, path));
+        CHECK_FALSE(cache.lookup(terrain, startOf(1), far, path));
+    }
+
+    SUBCASE("Entries are saved only while they match the terrain") {
+        PathCache cache;
+        cache.store(terrain, start, goal, corridor);
+        std::vector<unsigned char> bytes;
+        StateWriter writer(bytes);
+        cache.serialize(writer, terrain);
+
+        PathCache restored;
+        StateReader reader(bytes.data(), bytes.size());
+        restored.deserialize(reader);
+        CHECK(reader.isValid());
+        restored.adopt(terrain);
+        REQUIRE(restored.lookup(terrain, start, goal, path));
+        CHECK(path == corridor);
+
+        terrain.clearPassageAt(Coordinate(18, 4));  // Not yet synced
+        std::vector<unsigned char> stale;
+        StateWriter staleWriter(stale);
+        cache.serialize(staleWriter, terrain);
+        PathCache empty;
+        StateReader staleReader(stale.data(), stale.size());
+        empty.deserialize(staleReader);
+        CHECK(empty.size() == 0);
+    }
+}
+
+TEST_CASE("Metrics Registry") {
+    SUBCASE("Histogram buckets stay within one sub-bucket of the sample") {
+        for (std::uint64_t sample : {0ull, 7ull, 15ull, 16ull, 17ull, 100ull, 1023ull, 
+                                     16667ull, 1000000ull, 123456789ull}) {
+            int bucket = MetricHistogram::bucketFor(sample);
+            CHECK(bucket >= 0);
+            CHECK(bucket < MetricHistogram::BUCKETS);
+            std::uint64_t upper = MetricHistogram::bucketUpperEdge(bucket);
+            CHECK(upper >= sample);
+            CHECK(upper - sample <= sample / MetricHistogram::SUB_BUCKETS);
+        }
+        CHECK(MetricHistogram::bucketFor(MetricHistogram::MAX_VALUE) == MetricHistogram::BUCKETS - 1);
+        CHECK(MetricHistogram::bucketFor(~0ull) == MetricHistogram::BUCKETS - 1);
+    }
+
+    SUBCASE("Percentiles, sum and max") {
+        MetricHistogram histogram;
+        CHECK(histogram.percentile(0.5) == 0);
+        for (int i = 1; i <= 1000; ++i) {
+            histogram.record(static_cast<std::uint64_t>(i));
+        }
+        CHECK(histogram.getCount() == 1000);
+        CHECK(histogram.getSum() == 500500);
+        CHECK(histogram.getMax() == 1000);
+        std::uint64_t median = histogram.percentile(0.5);
+        CHECK(median >= 500);
+        CHECK(median <= 500 + 500 / MetricHistogram::SUB_BUCKETS);
+        CHECK(histogram.percentile(1.0) == 1000);
+        histogram.reset();
+        CHECK(histogram.getCount() == 0);
+    }
+
+    SUBCASE("Concurrent recording loses nothing") {
+        MetricHistogram histogram;
+        MetricCounter counter;
+        std::vector<std::thread> writers;
+        for (int t = 0; t < 4; ++t) {
+            writers.emplace_back([&] {
+                for (int i = 0; i < 10000; ++i) {
+                    histogram.record(static_cast<std::uint64_t>(i % 300));
+                    counter.add();
+                }
+            });
+        }
+        for (auto& writer : writers) writer.join();
+        CHECK(histogram.getCount() == 40000);
+        CHECK(counter.get() == 40000);
+        CHECK(histogram.getMax() == 299);
+    }
+
+    SUBCASE("Prometheus text groups labelled families") {
+        MetricsRegistry registry;
+        MetricCounter& ticks = registry.counter("digdug_ticks_total", "Ticks run");
+        registry.gauge("digdug_entities", "Live entities", "kind=\"enemy\"").set(4);
+        registry.gauge("digdug_entities", "Live entities", "kind=\"rock\"").set(2);
+        MetricHistogram& frames = registry.histogram("digdug_frame_time_seconds", "Frame time", 1e-6);
+        ticks.add(3);
+        frames.record(16000);
+
+        CHECK(&registry.counter("digdug_ticks_total", "Ticks run") == &ticks);
+        CHECK(registry.size() == 4);
+
+        std::string text = registry.renderPrometheus();
+        CHECK(text.find("# TYPE digdug_ticks_total counter\ndigdug_ticks_total 3\n") != std::string::npos);
+        CHECK(text.find("# TYPE digdug_entities gauge\n"
+                        "digdug_entities{kind=\"enemy\"} 4\n"
+                        "digdug_entities{kind=\"rock\"} 2\n") != std::string::npos);
+        CHECK(text.find("# TYPE digdug_frame_time_seconds summary") != std::string::npos);
+        CHECK(text.find("digdug_frame_time_seconds{quantile=\"0.99\"} 0.016") != std::string::npos);
+        CHECK(text.find("digdug_frame_time_seconds_sum 0.016\n") != std::string::npos);
+        CHECK(text.find("digdug_frame_time_seconds_count 1\n") != std::string::npos);
+
+        std::size_t first = text.find("# HELP digdug_entities");
+        CHECK(text.find("# HELP digdug_entities", first + 1) == std::string::npos);
+    }
+
+    SUBCASE("File dump") {
+        MetricsRegistry registry;
+        registry.counter("digdug_ticks_total", "Ticks run").add(7);
+        std::filesystem::path path = std::filesystem::temp_directory_path() / "digdug_metrics.prom";
+        std::filesystem::remove(path);
+
+        MetricsExporter exporter(registry);
+        MetricsExporter::Settings settings;
+        settings.filePath = path.string();
+        settings.dumpIntervalSeconds = 60.0;
+        REQUIRE(exporter.start(settings));
+        CHECK(exporter.isRunning());
+        CHECK_FALSE(exporter.isServing());
+        exporter.stop();   // Final dump on stop
+
+        std::ifstream file(path);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        CHECK(contents.str() == registry.renderPrometheus());
+        CHECK_FALSE(std::filesystem::exists(path.string() + ".tmp"));
+        std::filesystem::remove(path);
+
+        MetricsExporter idle(registry);
+        CHECK_FALSE(idle.start(MetricsExporter::Settings()));
+
+        // Out-of-range ports are refused, not truncated to 16 bits
+        MetricsExporter::Settings outOfRange;
+        outOfRange.port = 65536 + 9100;
+        CHECK_FALSE(idle.start(outOfRange));
+        CHECK_FALSE(idle.isServing());
+    }
+
+#ifdef __linux__
+    SUBCASE("Scrape endpoint") {
+        MetricsRegistry registry;
+        registry.counter("digdug_ticks_total", "Ticks run").add(5);
+        MetricsExporter exporter(registry);
+        MetricsExporter::Settings settings;
+        settings.port = 0;
+        if (!exporter.start(settings)) {
+            return;   // No loopback networking in this environment
+        }
+        REQUIRE(exporter.getPort() > 0);
+
+        auto fetch = [&](const std::string& request) {
+            int handle = socket(AF_INET, SOCK_STREAM, 0);
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            address.sin_port = htons(static_cast<std::uint16_t>(exporter.getPort()));
+            std::string response;
+            if (connect(handle, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+                send(handle, request.data(), request.size(), 0);
+                char buffer[4096];
+                ssize_t got;
+                while ((got = recv(handle, buffer, sizeof(buffer), 0)) > 0) {
+                    response.append(buffer, static_cast<std::size_t>(got));
+                }
+            }
+            close(handle);
+            return response;
+        };
+
+        std::string response = fetch("GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+        CHECK(response.rfind("HTTP/1.1 200 OK", 0) == 0);
+        CHECK(response.find("text/plain; version=0.0.4") != std::string::npos);
+        CHECK(response.find("digdug_ticks_total 5\n") != std::string::npos);
+        CHECK(exporter.getScrapesServed() == 1);
+
+        CHECK(fetch("GET / HTTP/1.1\r\n\r\n").rfind("HTTP/1.1 404", 0) == 0);
+        exporter.stop();
+        CHECK_FALSE(exporter.isServing());
+    }
+#endif
+
+    SUBCASE("Collision tests are counted") {
+        CollisionManager collisions;
+        Player player(Coordinate(5, 5));
+        std::vector<Enemy> enemies;
+        enemies.emplace_back(Coordinate(10, 10), EnemyType::RED_MONSTER);
+        enemies.emplace_back(Coordinate(12, 12), EnemyType::RED_MONSTER);
+        CHECK(collisions.getTestsPerformed() == 0);
+        collisions.checkPlayerEnemyCollision(player, enemies);
+        CHECK(collisions.getTestsPerformed() == 2);
+    }
+}
+
+TEST_CASE("Memory Accounting") {
+    SUBCASE("Allocations are charged to the innermost scope") {
+        CHECK(MemoryTracker::currentTag() == MemoryTag::GENERAL);
+        MemoryTracker::Usage before = MemoryTracker::usage(MemoryTag::UI_TEXT);
+        {
+            MemoryScope outer(MemoryTag::UI_TEXT);
+            std::vector<char> text(1000);
+            {
+                MemoryScope inner(MemoryTag::PROJECTILES);
+                CHECK(MemoryTracker::currentTag() == MemoryTag::PROJECTILES);
+            }
+            CHECK(MemoryTracker::currentTag() == MemoryTag::UI_TEXT);
+            MemoryTracker::Usage during = MemoryTracker::usage(MemoryTag::UI_TEXT);
+            CHECK(during.bytes == before.bytes + 1000);
+            CHECK(during.allocations == before.allocations + 1);
+            CHECK(during.peakBytes >= during.bytes);
+        }
+        CHECK(MemoryTracker::currentTag() == MemoryTag::GENERAL);
+        MemoryTracker::Usage after = MemoryTracker::usage(MemoryTag::UI_TEXT);
+        CHECK(after.bytes == before.bytes);
+        CHECK(after.frees == before.frees + 1);
+    }
+
+    SUBCASE("Frees go back to the allocating subsystem from any thread") {
+        MemoryTracker::Usage before = MemoryTracker::usage(MemoryTag::PROJECTILES);
+        std::vector<int>* block = nullptr;
+        {
+            MemoryScope scope(MemoryTag::PROJECTILES);
+            block = new std::vector<int>(256);
+        }
+        CHECK(MemoryTracker::usage(MemoryTag::PROJECTILES).bytes > before.bytes);
+        std::thread([block] {
+            CHECK(MemoryTracker::currentTag() == MemoryTag::GENERAL);
+            delete block;
+        }).join();
+        CHECK(MemoryTracker::usage(MemoryTag::PROJECTILES).bytes == before.bytes);
+    }
+
+    SUBCASE("High-water marks and budgets") {
+        MemoryTracker::resetPeaks();
+        std::int64_t base = MemoryTracker::usage(MemoryTag::UI_TEXT).bytes;
+        {
+            MemoryScope scope(MemoryTag::UI_TEXT);
+            std::vector<char> big(64 * 1024);
+        }
+        MemoryTracker::Usage usage = MemoryTracker::usage(MemoryTag::UI_TEXT);
+        CHECK(usage.bytes == base);
+        CHECK(usage.peakBytes >= base + 64 * 1024);
+
+        MemoryTracker::setBudget(MemoryTag::UI_TEXT, base + 1024);
+        CHECK(MemoryTracker::isOverBudget(MemoryTag::UI_TEXT));
+        CHECK(MemoryTracker::report().find("OVER BUDGET") != std::string::npos);
+        MemoryTracker::setBudget(MemoryTag::UI_TEXT, 0);
+        CHECK_FALSE(MemoryTracker::isOverBudget(MemoryTag::UI_TEXT));
+
+        MemoryTracker::resetPeaks();
+        CHECK(MemoryTracker::usage(MemoryTag::UI_TEXT).peakBytes == base);
+    }
+
+    SUBCASE("Subsystems tag their own allocations") {
+        MemoryTracker::Usage particlesBefore = MemoryTracker::usage(MemoryTag::PARTICLES);
+        ParticleSystem particles;
+        particles.emitBurst(Vector2{10.0f, 10.0f}, RED, 40);
+        CHECK(MemoryTracker::usage(MemoryTag::PARTICLES).bytes > particlesBefore.bytes);
+        particles.clear();
+
+        std::int64_t terrainBefore = MemoryTracker::usage(MemoryTag::TERRAIN).inlineBytes;
+        std::int64_t projectilesBefore = MemoryTracker::usage(MemoryTag::PROJECTILES).inlineBytes;
+        {
+            GameSimulation simulation;
+            CHECK(MemoryTracker::usage(MemoryTag::ENEMIES).bytes > 0);
+            CHECK(MemoryTracker::usage(MemoryTag::TERRAIN).inlineBytes - terrainBefore == 
+                  static_cast<std::int64_t>(sizeof(BlockGrid)));
+            CHECK(MemoryTracker::usage(MemoryTag::PROJECTILES).inlineBytes > projectilesBefore);
+
+            // A second live simulation adds its own storage rather than replacing the first
+            GameSimulation second;
+            CHECK(MemoryTracker::usage(MemoryTag::TERRAIN).inlineBytes - terrainBefore == 
+                  2 * static_cast<std::int64_t>(sizeof(BlockGrid)));
+        }
+        CHECK(MemoryTracker::usage(MemoryTag::TERRAIN).inlineBytes == terrainBefore);
+        CHECK(MemoryTracker::usage(MemoryTag::PROJECTILES).inlineBytes == projectilesBefore);
+    }
+
+    SUBCASE("Names and report") {
+        MemoryTag tag = MemoryTag::GENERAL;
+        CHECK(MemoryTracker::tagFromName("particles", tag));
+        CHECK(tag == MemoryTag::PARTICLES);
+        CHECK_FALSE(MemoryTracker::tagFromName("sound", tag));
+        std::string report = MemoryTracker::report();
+        for (int i = 0; i < static_cast<int>(MemoryTag::COUNT); ++i) {
+            CHECK(report.find(MemoryTracker::tagName(static_cast<MemoryTag>(i))) != std::string::npos);
+        }
+        CHECK(report.find("total") != std::string::npos);
+    }
+}
+
+TEST_CASE("Buffered and Timestamped Input") {
+    SUBCASE("Direction buffer keeps order, merges repeats and expires") {
+        DirectionBuffer buffer;
+        buffer.push(Direction::UP, 1.0f);
+        buffer.push(Direction::UP, 1.1f);
+        buffer.push(Direction::LEFT, 1.2f);
+        CHECK(buffer.size() == 2);
+        buffer.push(Direction::DOWN, 1.3f);   // Full: oldest dropped
+        CHECK(buffer.take(1.35f, 0.25f) == Direction::LEFT);
+        CHECK(buffer.take(1.35f, 0.25f) == Direction::DOWN);
+        CHECK(buffer.take(1.35f, 0.25f) == Direction::NONE);
+
+        buffer.push(Direction::RIGHT, 2.0f);
+        CHECK(buffer.take(2.5f, 0.25f) == Direction::NONE);
+        CHECK(buffer.empty());
+    }
+
+    SUBCASE("A tap during the move cooldown is played when the cooldown ends") {
+        GameClock::setFixedStep(1.0f / 60.0f, 100.0);
+        BlockGrid terrain;
+        std::vector<Rock> noRocks;
+        Player player(Coordinate(10, 10));
+
+        CHECK(player.handleMovementWithRocks(Direction::RIGHT, terrain, noRocks));
+        CHECK(player.getPosition() == Coordinate(10, 11));
+
+        GameClock::advance();
+        player.queueDirection(Direction::UP);   // Pressed and released within the cooldown
+        CHECK_FALSE(player.handleMovementWithRocks(Direction::NONE, terrain, noRocks));
+        CHECK(player.getQueuedMoveCount() == 1);
+
+        bool moved = false;
+        for (int tick = 0; tick < 12 && !moved; ++tick) {
+            GameClock::advance();
+            moved = player.handleMovementWithRocks(Direction::NONE, terrain, noRocks);
+        }
+        CHECK(moved);
+        CHECK(player.getPosition() == Coordinate(9, 11));
+        CHECK(player.getQueuedMoveCount() == 0);
+
+        // A stale tap does not fire long after the fact
+        player.queueDirection(Direction::LEFT);
+        for (int tick = 0; tick < 30; ++tick) GameClock::advance();
+        CHECK_FALSE(player.handleMovementWithRocks(Direction::NONE, terrain, noRocks));
+        CHECK(player.getPosition() == Coordinate(9, 11));
+
+        // Queued taps are part of the saved player state
+        player.queueDirection(Direction::DOWN);
+        std::vector<unsigned char> bytes;
+        StateWriter writer(bytes);
+        player.serialize(writer);
+        Player restored;
+        StateReader reader(bytes.data(), bytes.size());
+        restored.deserialize(reader);
+        CHECK(reader.isValid());
+        CHECK(restored.getQueuedMoveCount() == 1);
+        GameClock::useRealTime();
+    }
+
+    SUBCASE("Latch emits ordered, timestamped press and release events") {
+        InputLatch latch;
+        latch.record(0, InputFrame::bit(InputButton::FIRE), 10);    // Tap inside one sample
+        latch.record(InputFrame::bit(InputButton::LEFT), 0, 20);
+        latch.record(InputFrame::bit(InputButton::LEFT), 0, 25);    // Still held: no event
+        latch.record(0, 0, 30);
+
+        std::vector<InputEvent> seen;
+        InputFrame frame = latch.consume([&](const InputEvent& event) { seen.push_back(event); });
+        REQUIRE(seen.size() == 4);
+        CHECK((seen[0].button == InputButton::FIRE && seen[0].down && seen[0].timeMicros == 10));
+        CHECK((seen[1].button == InputButton::FIRE && !seen[1].down && seen[1].timeMicros == 10));
+        CHECK((seen[2].button == InputButton::LEFT && seen[2].down && seen[2].timeMicros == 20));
+        CHECK((seen[3].button == InputButton::LEFT && !seen[3].down && seen[3].timeMicros == 30));
+        CHECK(frame.wasPressed(InputButton::FIRE));
+        CHECK(frame.held == 0);
+
+        // Overflowing the queue loses timestamps, never presses
+        for (int i = 0; i < InputLatch::EVENT_CAPACITY; ++i) {
+            latch.record(0, InputFrame::bit(InputButton::UP), i);
+        }
+        CHECK(latch.getDroppedEvents() > 0);
+        CHECK(latch.consume().wasPressed(InputButton::UP));
+    }
+
+    SUBCASE("Latency runs from the movement press to the cell change") {
+        InputLatencyProbe probe;
+        std::int64_t latency = 0;
+        CHECK_FALSE(probe.onPlayerCell(Coordinate(5, 5), 0, latency));
+
+        probe.onEvent(InputEvent{InputButton::FIRE, true, 500});    // Not a movement key
+        probe.onEvent(InputEvent{InputButton::LEFT, true, 1000});
+        probe.onEvent(InputEvent{InputButton::UP, true, 1500});     // Oldest press is kept
+        CHECK_FALSE(probe.onPlayerCell(Coordinate(5, 5), 2000, latency));
+        CHECK(probe.onPlayerCell(Coordinate(5, 4), 9000, latency));
+        CHECK(latency == 8000);
+        CHECK_FALSE(probe.onPlayerCell(Coordinate(5, 3), 10000, latency));
+
+        probe.onEvent(InputEvent{InputButton::DOWN, true, 20000});
+        CHECK_FALSE(probe.onPlayerCell(Coordinate(5, 3), 20000 + InputLatencyProbe::STALE_MICROS + 1, latency));
+        CHECK_FALSE(probe.onPlayerCell(Coordinate(6, 3), 20000 + InputLatencyProbe::STALE_MICROS + 2, latency));
+    }
+}